@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "admission_controller.hpp"
+
+#include "logging.hpp"
+#include "status.hpp"
+
+namespace ovms {
+// weight of the newest sample in moving average is 1/2^SERVICE_TIME_SMOOTHING_SHIFT
+static constexpr uint64_t SERVICE_TIME_SMOOTHING_SHIFT = 3;
+
+AdmissionController::AdmissionController(uint32_t maxPendingRequests, uint32_t maxQueueWaitMs) :
+    maxPendingRequests(maxPendingRequests),
+    maxQueueWaitMs(maxQueueWaitMs) {}
+
+void AdmissionController::setLimits(uint32_t maxPendingRequests, uint32_t maxQueueWaitMs) {
+    this->maxPendingRequests.store(maxPendingRequests, std::memory_order_relaxed);
+    this->maxQueueWaitMs.store(maxQueueWaitMs, std::memory_order_relaxed);
+}
+
+uint64_t AdmissionController::getEstimatedWaitUs(uint32_t pendingRequests, size_t streamsCount) const {
+    if (streamsCount == 0) {
+        return 0;
+    }
+    return averageServiceTimeUs.load(std::memory_order_relaxed) * pendingRequests / streamsCount;
+}
+
+Status AdmissionController::admit(uint32_t pendingRequests, size_t streamsCount) const {
+    const uint32_t maxPending = maxPendingRequests.load(std::memory_order_relaxed);
+    if (maxPending > 0 && pendingRequests >= maxPending) {
+        SPDLOG_DEBUG("Rejecting request since {} requests are already waiting, limit: {}", pendingRequests, maxPending);
+        return StatusCode::SERVABLE_OVERLOADED;
+    }
+    const uint64_t maxWaitUs = static_cast<uint64_t>(maxQueueWaitMs.load(std::memory_order_relaxed)) * 1000;
+    if (maxWaitUs > 0) {
+        const uint64_t estimatedWaitUs = getEstimatedWaitUs(pendingRequests, streamsCount);
+        if (estimatedWaitUs > maxWaitUs) {
+            SPDLOG_DEBUG("Rejecting request since estimated wait time {} us exceeds limit: {} us", estimatedWaitUs, maxWaitUs);
+            return StatusCode::SERVABLE_OVERLOADED;
+        }
+    }
+    return StatusCode::OK;
+}
+
+void AdmissionController::recordServiceTime(uint64_t serviceTimeUs) {
+    // updates from concurrent callers may be lost, which is acceptable for an estimate
+    const uint64_t average = averageServiceTimeUs.load(std::memory_order_relaxed);
+    if (average == 0) {
+        averageServiceTimeUs.store(serviceTimeUs, std::memory_order_relaxed);
+        return;
+    }
+    const int64_t delta = static_cast<int64_t>(serviceTimeUs) - static_cast<int64_t>(average);
+    averageServiceTimeUs.store(static_cast<uint64_t>(static_cast<int64_t>(average) + delta / (1 << SERVICE_TIME_SMOOTHING_SHIFT)), std::memory_order_relaxed);
+}
+}  // namespace ovms
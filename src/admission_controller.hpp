@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ovms {
+class Status;
+
+/**
+ * @brief Rejects requests upfront when servable is overloaded instead of letting them wait for idle stream.
+ *
+ * Limits are checked against number of callers already waiting and estimated wait time.
+ * Wait time is estimated from moving average of time stream is held by single request.
+ * Thread safe, limits are soft since concurrent callers may pass the check at the same time.
+ */
+class AdmissionController {
+public:
+    AdmissionController(uint32_t maxPendingRequests = 0, uint32_t maxQueueWaitMs = 0);
+
+    void setLimits(uint32_t maxPendingRequests, uint32_t maxQueueWaitMs);
+
+    bool isEnabled() const {
+        return maxPendingRequests.load(std::memory_order_relaxed) > 0 || maxQueueWaitMs.load(std::memory_order_relaxed) > 0;
+    }
+
+    /**
+     * @brief Checks if new request can wait for idle stream
+     *
+     * @param pendingRequests number of requests already waiting for idle stream
+     * @param streamsCount number of requests served in parallel
+     * @return Status OK or SERVABLE_OVERLOADED
+     */
+    Status admit(uint32_t pendingRequests, size_t streamsCount) const;
+
+    /**
+     * @brief Records time single request held the stream, used to estimate wait time
+     */
+    void recordServiceTime(uint64_t serviceTimeUs);
+
+    uint64_t getEstimatedWaitUs(uint32_t pendingRequests, size_t streamsCount) const;
+
+private:
+    std::atomic<uint32_t> maxPendingRequests;
+    std::atomic<uint32_t> maxQueueWaitMs;
+    std::atomic<uint64_t> averageServiceTimeUs{0};
+};
+}  // namespace ovms
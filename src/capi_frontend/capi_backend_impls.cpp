@@ -53,6 +53,6 @@ template Status serializePredictResponse(
     InferenceResponse* response,
     outputNameChooser_t outputNameChooser,
     bool useSharedOutputContent);
-template Status modelInferAsync<InferenceRequest, InferenceResponse>(ModelInstance& instance, const InferenceRequest*, std::unique_ptr<ModelInstanceUnloadGuard>&);
-template Status infer<InferenceRequest, InferenceResponse>(ModelInstance& instance, const InferenceRequest*, InferenceResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&);
+template Status modelInferAsync<InferenceRequest, InferenceResponse>(ModelInstance& instance, const InferenceRequest*, std::unique_ptr<ModelInstanceUnloadGuard>&, std::optional<std::chrono::steady_clock::time_point>);
+template Status infer<InferenceRequest, InferenceResponse>(ModelInstance& instance, const InferenceRequest*, InferenceResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&, std::optional<std::chrono::steady_clock::time_point>);
 }  // namespace ovms
@@ -241,6 +241,7 @@ struct ServerSettingsImpl {
     std::string grpcChannelArguments;
     uint32_t filesystemPollWaitMilliseconds = 1000;
     uint32_t resourcesCleanerPollWaitSeconds = 300;
+    uint32_t modelLoadWorkers = 1;
     std::string cacheDir;
     bool withPython = false;
     bool startedWithCLI = false;
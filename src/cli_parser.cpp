@@ -141,6 +141,10 @@ std::variant<bool, std::pair<int, std::string>> CLIParser::parse(int argc, char*
                 "Time interval between two consecutive resources cleanup scans. Default is 300. Zero value disables resources cleaner.",
                 cxxopts::value<uint32_t>()->default_value("300"),
                 "CUSTOM_NODE_RESOURCES_CLEANER_INTERVAL_SECONDS")
+            ("model_load_workers",
+                "Maximum number of models and MediaPipe graphs loaded concurrently on start and config reload. Default 1.",
+                cxxopts::value<uint32_t>()->default_value("1"),
+                "MODEL_LOAD_WORKERS")
             ("cache_dir",
                 "Overrides model cache directory. By default cache files are saved into"
 #ifdef __linux__
@@ -570,6 +574,7 @@ void CLIParser::prepareServer(ServerSettingsImpl& serverSettings) {
 
     serverSettings.resourcesCleanerPollWaitSeconds = result->operator[]("custom_node_resources_cleaner_interval_seconds").as<uint32_t>();
     serverSettings.grpcWorkers = result->operator[]("grpc_workers").as<uint32_t>();
+    serverSettings.modelLoadWorkers = result->operator[]("model_load_workers").as<uint32_t>();
 
     if (result->count("log_level"))
         serverSettings.logLevel = result->operator[]("log_level").as<std::string>();
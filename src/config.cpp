@@ -289,6 +289,10 @@ bool Config::validate() {
             std::cerr << "grpc_workers count should be from 1 to CPU core count : " << AVAILABLE_CORES << std::endl;
             return false;
         }
+        if (modelLoadWorkers() < 1) {
+            std::cerr << "model_load_workers has to be greater than 0" << std::endl;
+            return false;
+        }
         // metrics on rest port
         if (metricsEnabled() && restPort() == 0) {
             std::cerr << "rest_port setting is missing, metrics are enabled on rest port" << std::endl;
@@ -432,6 +436,7 @@ const std::string& Config::tracePath() const { return this->serverSettings.trace
 const std::string& Config::grpcChannelArguments() const { return this->serverSettings.grpcChannelArguments; }
 uint32_t Config::filesystemPollWaitMilliseconds() const { return this->serverSettings.filesystemPollWaitMilliseconds; }
 uint32_t Config::resourcesCleanerPollWaitSeconds() const { return this->serverSettings.resourcesCleanerPollWaitSeconds; }
+uint32_t Config::modelLoadWorkers() const { return this->serverSettings.modelLoadWorkers; }
 bool Config::allowCredentials() const { return this->serverSettings.allowCredentials; }
 const std::string& Config::allowedOrigins() const { return this->serverSettings.allowedOrigins; }
 const std::string& Config::allowedMethods() const { return this->serverSettings.allowedMethods; }
@@ -312,6 +312,13 @@ public:
      */
     uint32_t resourcesCleanerPollWaitSeconds() const;
 
+    /**
+     * @brief Get the maximum number of servables loaded concurrently
+     * 
+     * @return uint32_t
+     */
+    uint32_t modelLoadWorkers() const;
+
     bool allowCredentials() const;
     const std::string& allowedOrigins() const;
     const std::string& allowedMethods() const;
@@ -51,7 +51,8 @@ Status getAllModelsStatuses(ModelsStatuses& modelsStatuses, ModelInstanceProvide
                     modelVersion,
                     status.getState(),
                     status.getErrorCode(),
-                    status.getErrorMsg()};
+                    status.getErrorMsg(),
+                    status.getWarmupTimeUs()};
                 versions.push_back(std::move(details));
             }
         } else {
@@ -123,8 +124,11 @@ Status serializeModelsStatuses2Json(const ModelsStatuses& modelsStatuses, std::s
                 outputTmp += "   \"status\": {\n";
                 outputTmp += "    \"error_code\": \"" + ModelVersionStatusErrorCodeToString(v.errorCode) + "\",\n";
                 outputTmp += "    \"error_message\": \"" + jsonEscapeStringValue(v.errorMessage) + "\"\n";
-                outputTmp += "   }\n";
-                outputTmp += "  }";
+                outputTmp += "   }";
+                if (v.warmupTimeUs > 0) {
+                    outputTmp += ",\n   \"warmup_time_us\": " + std::to_string(v.warmupTimeUs);
+                }
+                outputTmp += "\n  }";
             }
             outputTmp += "\n ]\n}";
         }
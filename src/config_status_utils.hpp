@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -33,6 +34,7 @@ struct ModelVersionStatusDetails {
     ModelVersionState state;
     ModelVersionStatusErrorCode errorCode;
     std::string errorMessage;
+    uint64_t warmupTimeUs = 0;
 };
 
 using ModelsStatuses = std::map<std::string, std::vector<ModelVersionStatusDetails>>;
@@ -57,6 +57,17 @@ struct CustomNodeParam {
     const char *key, *value;
 };
 
+/**
+ * @brief Allocator of buffers owned by the server.
+ * Output tensor data allocated with it is returned to the server pool after use and is never passed to release.
+ * Buffers which are not returned as output tensor data must be given back with deallocate.
+ */
+struct CustomNodeBufferAllocator {
+    void* (*allocate)(uint64_t bytes, void* context);
+    void (*deallocate)(void* ptr, void* context);
+    void* context;
+};
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -80,6 +91,12 @@ DLL_PUBLIC int execute(const struct CustomNodeTensor* inputs, int inputsCount, s
 DLL_PUBLIC int getInputsInfo(struct CustomNodeTensorInfo** info, int* infoCount, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager);
 DLL_PUBLIC int getOutputsInfo(struct CustomNodeTensorInfo** info, int* infoCount, const struct CustomNodeParam* params, int paramsCount, void* customNodeLibraryInternalManager);
 DLL_PUBLIC int release(void* ptr, void* customNodeLibraryInternalManager);
+/**
+ * @brief Custom node library setBufferAllocator receives server allocator right after library is loaded.
+ * Implementing it is optional. Allocator stays valid as long as the library is loaded.
+ * Using it for output tensor data lets the server reuse the buffers between predictions.
+ */
+DLL_PUBLIC int setBufferAllocator(const struct CustomNodeBufferAllocator* allocator);
 
 #ifdef __cplusplus
 }
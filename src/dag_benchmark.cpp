@@ -0,0 +1,260 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Latency benchmark of DAG pipelines executed through C-API.
+// Default config contains sequential pipeline and pipeline with demultiplexer
+// and gather, served by model with fewer infer requests than demultiplexed
+// sessions, so that deferred node sessions are exercised.
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <sysexits.h>
+
+#include "ovms.h"  // NOLINT
+
+namespace {
+using signed_shape_t = std::vector<int64_t>;
+
+struct PipelineInput {
+    std::string name;
+    signed_shape_t shape;
+};
+
+bool printIfError(OVMS_Status* status, const std::string& context) {
+    if (status == nullptr) {
+        return false;
+    }
+    uint32_t code = 0;
+    const char* details = nullptr;
+    OVMS_StatusCode(status, &code);
+    OVMS_StatusDetails(status, &details);
+    std::cerr << context << " failed. Code: " << code << "; details: " << details << std::endl;
+    OVMS_StatusDelete(status);
+    return true;
+}
+
+bool getPipelineInput(OVMS_Server* server, const std::string& pipelineName, int64_t demultiplyCount, PipelineInput& input) {
+    OVMS_ServableMetadata* metadata = nullptr;
+    if (printIfError(OVMS_GetServableMetadata(server, pipelineName.c_str(), 0, &metadata), "Getting metadata of " + pipelineName)) {
+        return false;
+    }
+    const char* name;
+    OVMS_DataType datatype;
+    size_t dimCount;
+    int64_t* shapeMin;
+    int64_t* shapeMax;
+    OVMS_ServableMetadataInput(metadata, 0, &name, &datatype, &dimCount, &shapeMin, &shapeMax);
+    if (datatype != OVMS_DATATYPE_FP32) {
+        std::cerr << "Pipeline: " << pipelineName << " input is not FP32" << std::endl;
+        OVMS_ServableMetadataDelete(metadata);
+        return false;
+    }
+    input.name = name;
+    input.shape.clear();
+    for (size_t i = 0; i < dimCount; ++i) {
+        // dynamic dimension is expected only for demultiplexed entry
+        input.shape.push_back(shapeMin[i] > 0 ? shapeMin[i] : demultiplyCount);
+    }
+    OVMS_ServableMetadataDelete(metadata);
+    return true;
+}
+
+double percentile(const std::vector<uint64_t>& sorted, double p) {
+    size_t index = std::min(sorted.size() - 1, static_cast<size_t>(p * sorted.size()));
+    return static_cast<double>(sorted[index]);
+}
+
+bool benchmarkPipeline(OVMS_Server* server, const std::string& pipelineName, uint32_t threadsCount, uint32_t niter, int64_t demultiplyCount) {
+    PipelineInput input;
+    if (!getPipelineInput(server, pipelineName, demultiplyCount, input)) {
+        return false;
+    }
+    const auto elementsCount = std::accumulate(input.shape.begin(), input.shape.end(), int64_t{1}, std::multiplies<int64_t>());
+    std::vector<float> data(elementsCount, 1.0f);
+    std::vector<std::vector<uint64_t>> latencies(threadsCount);
+    std::atomic<bool> start{false};
+    std::atomic<bool> failed{false};
+    std::vector<std::thread> threads;
+    for (uint32_t t = 0; t < threadsCount; ++t) {
+        threads.emplace_back([&, t]() {
+            OVMS_InferenceRequest* request = nullptr;
+            OVMS_InferenceRequestNew(&request, server, pipelineName.c_str(), 0);
+            OVMS_InferenceRequestAddInput(request, input.name.c_str(), OVMS_DATATYPE_FP32, input.shape.data(), input.shape.size());
+            OVMS_InferenceRequestInputSetData(request, input.name.c_str(), data.data(), data.size() * sizeof(float), OVMS_BUFFERTYPE_CPU, 0);
+            latencies[t].reserve(niter);
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint32_t i = 0; i < niter && !failed.load(); ++i) {
+                OVMS_InferenceResponse* response = nullptr;
+                auto begin = std::chrono::steady_clock::now();
+                auto* status = OVMS_Inference(server, request, &response);
+                auto end = std::chrono::steady_clock::now();
+                if (printIfError(status, "Inference on " + pipelineName)) {
+                    failed = true;
+                    break;
+                }
+                OVMS_InferenceResponseDelete(response);
+                latencies[t].push_back(std::chrono::duration_cast<std::chrono::microseconds>(end - begin).count());
+            }
+            OVMS_InferenceRequestDelete(request);
+        });
+    }
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    if (failed) {
+        return false;
+    }
+    std::vector<uint64_t> all;
+    for (const auto& threadLatencies : latencies) {
+        all.insert(all.end(), threadLatencies.begin(), threadLatencies.end());
+    }
+    std::sort(all.begin(), all.end());
+    double seconds = std::chrono::duration<double>(end - begin).count();
+    double mean = std::accumulate(all.begin(), all.end(), 0.0) / all.size();
+    std::stringstream shape;
+    for (size_t i = 0; i < input.shape.size(); ++i) {
+        shape << (i ? "," : "") << input.shape[i];
+    }
+    std::cout << std::setw(32) << pipelineName
+              << std::setw(12) << shape.str()
+              << std::setw(12) << std::fixed << std::setprecision(0) << mean
+              << std::setw(12) << percentile(all, 0.5)
+              << std::setw(12) << percentile(all, 0.9)
+              << std::setw(12) << percentile(all, 0.99)
+              << std::setw(12) << std::setprecision(1) << all.size() / seconds << std::endl;
+    return true;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "DAG pipelines latency benchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("config_path",
+            "Config file path for OVMS to read",
+            cxxopts::value<std::string>()->default_value("/ovms/src/test/configs/config_dag_benchmark.json"),
+            "CONFIG_PATH")
+        ("pipelines",
+            "comma separated list of pipelines to benchmark",
+            cxxopts::value<std::string>()->default_value("dummy_sequential,dummy_demultiplexer_gather"),
+            "PIPELINES")
+        ("niter",
+            "number of inferences per thread",
+            cxxopts::value<uint32_t>()->default_value("1000"),
+            "NITER")
+        ("nthreads",
+            "number of concurrent clients",
+            cxxopts::value<uint32_t>()->default_value("1"),
+            "NTHREADS")
+        ("demultiply_count",
+            "size of dynamic demultiplexed dimension of pipeline input",
+            cxxopts::value<int64_t>()->default_value("8"),
+            "DEMULTIPLY_COUNT")
+        ("log_level",
+            "serving log level - one of TRACE, DEBUG, INFO, WARNING, ERROR",
+            cxxopts::value<std::string>()->default_value("ERROR"),
+            "LOG_LEVEL");
+    // clang-format on
+    std::string configPath, pipelines, logLevelParam;
+    uint32_t niter, threadsCount;
+    int64_t demultiplyCount;
+    try {
+        auto result = options.parse(argc, argv);
+        if (result.count("help")) {
+            std::cout << options.help() << std::endl;
+            return EX_OK;
+        }
+        configPath = result["config_path"].as<std::string>();
+        pipelines = result["pipelines"].as<std::string>();
+        niter = result["niter"].as<uint32_t>();
+        threadsCount = result["nthreads"].as<uint32_t>();
+        demultiplyCount = result["demultiply_count"].as<int64_t>();
+        logLevelParam = result["log_level"].as<std::string>();
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (niter == 0 || threadsCount == 0 || demultiplyCount <= 0) {
+        std::cerr << "niter, nthreads and demultiply_count have to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+    OVMS_LogLevel logLevel;
+    if (logLevelParam == "TRACE") {
+        logLevel = OVMS_LOG_TRACE;
+    } else if (logLevelParam == "DEBUG") {
+        logLevel = OVMS_LOG_DEBUG;
+    } else if (logLevelParam == "INFO") {
+        logLevel = OVMS_LOG_INFO;
+    } else if (logLevelParam == "WARNING") {
+        logLevel = OVMS_LOG_WARNING;
+    } else if (logLevelParam == "ERROR") {
+        logLevel = OVMS_LOG_ERROR;
+    } else {
+        std::cerr << "Invalid log level: " << logLevelParam << std::endl;
+        return EX_USAGE;
+    }
+
+    OVMS_ServerSettings* serverSettings = nullptr;
+    OVMS_ModelsSettings* modelsSettings = nullptr;
+    OVMS_Server* server = nullptr;
+    OVMS_ServerSettingsNew(&serverSettings);
+    OVMS_ModelsSettingsNew(&modelsSettings);
+    OVMS_ServerNew(&server);
+    OVMS_ServerSettingsSetGrpcPort(serverSettings, 9179);
+    OVMS_ServerSettingsSetLogLevel(serverSettings, logLevel);
+    OVMS_ModelsSettingsSetConfigPath(modelsSettings, configPath.c_str());
+    int ret = EX_OK;
+    if (printIfError(OVMS_ServerStartFromConfigurationFile(server, serverSettings, modelsSettings), "Starting server")) {
+        ret = EX_CONFIG;
+    } else {
+        std::cout << "clients: " << threadsCount << "; iterations per client: " << niter << "; demultiply count: " << demultiplyCount << std::endl;
+        std::cout << std::setw(32) << "pipeline"
+                  << std::setw(12) << "shape"
+                  << std::setw(12) << "mean [us]"
+                  << std::setw(12) << "p50 [us]"
+                  << std::setw(12) << "p90 [us]"
+                  << std::setw(12) << "p99 [us]"
+                  << std::setw(12) << "req/s" << std::endl;
+        std::stringstream pipelinesStream(pipelines);
+        std::string pipelineName;
+        while (std::getline(pipelinesStream, pipelineName, ',')) {
+            if (!benchmarkPipeline(server, pipelineName, threadsCount, niter, demultiplyCount)) {
+                ret = EX_SOFTWARE;
+                break;
+            }
+        }
+    }
+    OVMS_ServerDelete(server);
+    OVMS_ModelsSettingsDelete(modelsSettings);
+    OVMS_ServerSettingsDelete(serverSettings);
+    return ret;
+}
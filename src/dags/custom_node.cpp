@@ -45,7 +45,7 @@ CustomNode::CustomNode(
     customNodeLibraryInternalManager(std::move(customNodeLibraryInternalManager)) {
 }
 
-Status CustomNode::execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) {
+Status CustomNode::execute(const session_key_t& sessionKey, PipelineEventQueue& notifyEndQueue) {
     auto& nodeSession = getNodeSession(sessionKey);
     auto& customNodeSession = static_cast<CustomNodeSession&>(nodeSession);
     return customNodeSession.execute(notifyEndQueue, *this, this->library, this->libraryParameters, this->parameters.size(), getCNLIMWrapperPtr(customNodeLibraryInternalManager));
@@ -69,7 +69,7 @@ Status CustomNode::fetchResults(NodeSession& nodeSession, SessionResults& nodeSe
         nodeSession.getSessionKey());
 }
 
-Status CustomNode::fetchResults(TensorWithSourceMap& outputs, session_key_t sessionKey) {
+Status CustomNode::fetchResults(TensorWithSourceMap& outputs, const session_key_t& sessionKey) {
     auto& session = static_cast<CustomNodeSession&>(this->getNodeSession(sessionKey));
     session.clearInputs();
 
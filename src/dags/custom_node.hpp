@@ -49,10 +49,10 @@ public:
         std::set<std::string> gatherFromNode = {},
         std::shared_ptr<CNLIMWrapper> customNodeLibraryInternalManager = nullptr);
 
-    Status execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) override;
+    Status execute(const session_key_t& sessionKey, PipelineEventQueue& notifyEndQueue) override;
 
     Status fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) override;
-    Status fetchResults(TensorWithSourceMap& outputs, session_key_t sessionKey);
+    Status fetchResults(TensorWithSourceMap& outputs, const session_key_t& sessionKey);
 
     const std::string& getRealOutputName(const std::string& alias) const {
         auto it = nodeOutputNameAlias.find(alias);
@@ -0,0 +1,160 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "custom_node_buffer_arena.hpp"
+
+#include <new>
+
+#include "../logging.hpp"
+#include "../metrics/metric.hpp"
+#include "../model_metric_reporter.hpp"
+
+namespace ovms {
+
+static void* allocateCallback(uint64_t bytes, void* context) {
+    return static_cast<CustomNodeBufferArena*>(context)->allocate(bytes);
+}
+
+static void deallocateCallback(void* ptr, void* context) {
+    if (!static_cast<CustomNodeBufferArena*>(context)->deallocate(ptr)) {
+        SPDLOG_LOGGER_ERROR(dag_executor_logger, "Custom node library tried to deallocate buffer not allocated by server");
+    }
+}
+
+static void* allocateAligned(size_t bytes) {
+    return ::operator new(bytes, std::align_val_t(CustomNodeBufferArena::BUFFER_ALIGNMENT), std::nothrow);
+}
+
+static void freeAligned(void* ptr) {
+    ::operator delete(ptr, std::align_val_t(CustomNodeBufferArena::BUFFER_ALIGNMENT));
+}
+
+CustomNodeBufferArena::CustomNodeBufferArena(size_t maxCachedBytes) :
+    maxCachedBytes(maxCachedBytes),
+    allocator{allocateCallback, deallocateCallback, this} {}
+
+CustomNodeBufferArena::~CustomNodeBufferArena() {
+    for (auto& [sizeClass, buffers] : freeBuffers) {
+        for (void* buffer : buffers) {
+            freeAligned(buffer);
+        }
+    }
+    if (!usedBuffers.empty()) {
+        SPDLOG_LOGGER_WARN(dag_executor_logger, "Custom node buffer arena destroyed with {} buffers still in use", usedBuffers.size());
+    }
+}
+
+CustomNodeBufferArena& CustomNodeBufferArena::instance() {
+    // never destroyed, libraries and tensors may still hold buffers during static destruction
+    static CustomNodeBufferArena* instance = new CustomNodeBufferArena();
+    return *instance;
+}
+
+size_t CustomNodeBufferArena::getSizeClass(size_t bytes) {
+    size_t sizeClass = MIN_BUFFER_BYTES;
+    while (sizeClass < bytes) {
+        sizeClass <<= 1;
+    }
+    return sizeClass;
+}
+
+void* CustomNodeBufferArena::allocate(size_t bytes) {
+    if (bytes == 0) {
+        return nullptr;
+    }
+    const size_t sizeClass = getSizeClass(bytes);
+    std::unique_lock lock(mtx);
+    void* buffer = nullptr;
+    auto it = freeBuffers.find(sizeClass);
+    if (it != freeBuffers.end() && !it->second.empty()) {
+        buffer = it->second.back();
+        it->second.pop_back();
+        cachedBytes -= sizeClass;
+        ++hits;
+        if (reporter) {
+            INCREMENT_IF_ENABLED(reporter->hits);
+        }
+    } else {
+        buffer = allocateAligned(sizeClass);
+        if (buffer == nullptr) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Custom node buffer arena failed to allocate {} bytes", sizeClass);
+            return nullptr;
+        }
+        ++misses;
+        if (reporter) {
+            INCREMENT_IF_ENABLED(reporter->misses);
+        }
+    }
+    usedBuffers.emplace(buffer, sizeClass);
+    reportCachedBytes();
+    return buffer;
+}
+
+bool CustomNodeBufferArena::deallocate(void* ptr) {
+    if (ptr == nullptr) {
+        return false;
+    }
+    std::unique_lock lock(mtx);
+    auto it = usedBuffers.find(ptr);
+    if (it == usedBuffers.end()) {
+        return false;
+    }
+    const size_t sizeClass = it->second;
+    usedBuffers.erase(it);
+    if (cachedBytes + sizeClass > maxCachedBytes) {
+        freeAligned(ptr);
+        return true;
+    }
+    freeBuffers[sizeClass].push_back(ptr);
+    cachedBytes += sizeClass;
+    reportCachedBytes();
+    return true;
+}
+
+void CustomNodeBufferArena::setMetricReporter(CustomNodeBufferArenaMetricReporter* reporter) {
+    std::unique_lock lock(mtx);
+    this->reporter = reporter;
+    reportCachedBytes();
+}
+
+void CustomNodeBufferArena::resetMetricReporter(CustomNodeBufferArenaMetricReporter* reporter) {
+    std::unique_lock lock(mtx);
+    if (this->reporter == reporter) {
+        this->reporter = nullptr;
+    }
+}
+
+void CustomNodeBufferArena::reportCachedBytes() {
+    if (reporter) {
+        SET_IF_ENABLED(reporter->cachedBytes, cachedBytes);
+    }
+}
+
+uint64_t CustomNodeBufferArena::getHits() const {
+    std::unique_lock lock(mtx);
+    return hits;
+}
+
+uint64_t CustomNodeBufferArena::getMisses() const {
+    std::unique_lock lock(mtx);
+    return misses;
+}
+
+size_t CustomNodeBufferArena::getCachedBytes() const {
+    std::unique_lock lock(mtx);
+    return cachedBytes;
+}
+
+}  // namespace ovms
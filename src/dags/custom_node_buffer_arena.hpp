@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "../custom_node_interface.h"  // NOLINT
+
+namespace ovms {
+
+class CustomNodeBufferArenaMetricReporter;
+
+/**
+ * @brief Server owned pool of buffers handed out to custom node libraries through CustomNodeBufferAllocator.
+ *
+ * Buffers are rounded up to power of two size classes. Buffers released by the server after pipeline
+ * execution are kept in per size class free lists and reused by following requests, up to the cached bytes limit.
+ */
+class CustomNodeBufferArena {
+public:
+    static const size_t MIN_BUFFER_BYTES = 4096;
+    static const size_t DEFAULT_MAX_CACHED_BYTES = 512 * 1024 * 1024;
+    static const size_t BUFFER_ALIGNMENT = 64;
+
+    explicit CustomNodeBufferArena(size_t maxCachedBytes = DEFAULT_MAX_CACHED_BYTES);
+    ~CustomNodeBufferArena();
+    CustomNodeBufferArena(const CustomNodeBufferArena&) = delete;
+    CustomNodeBufferArena& operator=(const CustomNodeBufferArena&) = delete;
+
+    /**
+     * @brief Gets arena shared by all custom node libraries loaded in the process
+     */
+    static CustomNodeBufferArena& instance();
+
+    void* allocate(size_t bytes);
+    /**
+     * @brief Returns buffer to the arena
+     *
+     * @return false if buffer was not allocated by the arena
+     */
+    bool deallocate(void* ptr);
+
+    const struct CustomNodeBufferAllocator* getAllocator() const { return &allocator; }
+    void setMetricReporter(CustomNodeBufferArenaMetricReporter* reporter);
+    void resetMetricReporter(CustomNodeBufferArenaMetricReporter* reporter);
+
+    uint64_t getHits() const;
+    uint64_t getMisses() const;
+    size_t getCachedBytes() const;
+
+    static size_t getSizeClass(size_t bytes);
+
+private:
+    const size_t maxCachedBytes;
+    struct CustomNodeBufferAllocator allocator;
+    mutable std::mutex mtx;
+    std::map<size_t, std::vector<void*>> freeBuffers;
+    std::unordered_map<void*, size_t> usedBuffers;
+    size_t cachedBytes = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    CustomNodeBufferArenaMetricReporter* reporter = nullptr;
+
+    void reportCachedBytes();
+};
+
+}  // namespace ovms
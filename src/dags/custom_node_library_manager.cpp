@@ -25,9 +25,19 @@
 #include "src/filesystem/filesystem.hpp"
 #include "../logging.hpp"
 #include "../status.hpp"
+#include "custom_node_buffer_arena.hpp"
 
 namespace ovms {
 
+static bool passBufferAllocator(const std::string& name, set_buffer_allocator_fn setBufferAllocator) {
+    if (setBufferAllocator(CustomNodeBufferArena::instance().getAllocator()) != 0) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Library name: {} failed to set buffer allocator", name);
+        return false;
+    }
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Library name: {} uses server buffer allocator", name);
+    return true;
+}
+
 Status CustomNodeLibraryManager::loadLibrary(const std::string& name, const std::string& basePath) {
     if (FileSystem::isPathEscaped(basePath)) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Path {} escape with .. is forbidden.", basePath);
@@ -103,6 +113,14 @@ Status CustomNodeLibraryManager::loadLibrary(const std::string& name, const std:
         return StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM;
     }
 
+    // optional, libraries without it manage output buffers on their own
+    set_buffer_allocator_fn setBufferAllocator = reinterpret_cast<set_buffer_allocator_fn>(dlsym(handle, "setBufferAllocator"));
+    dlerror();
+    if (setBufferAllocator != nullptr && !passBufferAllocator(name, setBufferAllocator)) {
+        dlclose(handle);
+        return StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM;
+    }
+
     libraries[name] = NodeLibrary{
         initialize,
         deinitialize,
@@ -176,6 +194,13 @@ Status CustomNodeLibraryManager::loadLibrary(const std::string& name, const std:
         return StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM;
     }
 
+    // optional, libraries without it manage output buffers on their own
+    set_buffer_allocator_fn setBufferAllocator = reinterpret_cast<set_buffer_allocator_fn>(GetProcAddress(handle, "setBufferAllocator"));
+    if (setBufferAllocator != nullptr && !passBufferAllocator(name, setBufferAllocator)) {
+        FreeLibrary(handle);
+        return StatusCode::NODE_LIBRARY_LOAD_FAILED_SYM;
+    }
+
     libraries[name] = NodeLibrary{
         initialize,
         deinitialize,
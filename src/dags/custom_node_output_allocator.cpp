@@ -19,6 +19,7 @@
 
 #include "../custom_node_interface.h"  // NOLINT
 #include "../logging.hpp"
+#include "custom_node_buffer_arena.hpp"
 
 namespace ovms {
 
@@ -38,6 +39,9 @@ void* CustomNodeOutputAllocator::allocate(const size_t bytes, const size_t align
     return (void*)tensor.data;
 }
 void CustomNodeOutputAllocator::deallocate(void* handle, const size_t bytes, size_t alignment) noexcept {
+    if (CustomNodeBufferArena::instance().deallocate(tensor.data)) {
+        return;
+    }
     bool succeeded = nodeLibrary.release(tensor.data, customNodeLibraryInternalManager) == 0;
     if (false == succeeded) {
         SPDLOG_LOGGER_ERROR(dag_executor_logger, "Failed to release custom node tensor:{} buffer using library:{}", tensor.name, nodeLibrary.basePath);
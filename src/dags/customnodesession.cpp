@@ -25,6 +25,7 @@
 #include "../profiler.hpp"
 #include "../status.hpp"
 #include "../timer.hpp"
+#include "custom_node_buffer_arena.hpp"
 #include "custom_node_output_allocator.hpp"
 #include "node.hpp"
 #include "node_library.hpp"
@@ -60,9 +61,16 @@ Status CustomNodeSession::fetchResult(const std::string& name, ov::Tensor& resul
     return StatusCode::OK;
 }
 
+// output data may come from server buffer arena, other buffers are always owned by library
+static void releaseTensorData(const struct CustomNodeTensor* tensor, const NodeLibrary& library, void* customNodeLibraryInternalManager) {
+    if (!CustomNodeBufferArena::instance().deallocate(tensor->data)) {
+        library.release(tensor->data, customNodeLibraryInternalManager);
+    }
+}
+
 void CustomNodeSession::releaseTensorResources(const struct CustomNodeTensor* tensor, const NodeLibrary& library, void* customNodeLibraryInternalManager) {
     if (tensor->data) {
-        library.release(tensor->data, customNodeLibraryInternalManager);
+        releaseTensorData(tensor, library, customNodeLibraryInternalManager);
     }
     if (tensor->dims) {
         library.release(tensor->dims, customNodeLibraryInternalManager);
@@ -82,7 +90,7 @@ public:
         customNodeLibraryInternalManager(customNodeLibraryInternalManager) {}
     ~TensorResourcesGuard() {
         if (tensor->data && !persistData) {
-            library.release(tensor->data, customNodeLibraryInternalManager);
+            releaseTensorData(tensor, library, customNodeLibraryInternalManager);
         }
         if (tensor->dims) {
             library.release(tensor->dims, customNodeLibraryInternalManager);
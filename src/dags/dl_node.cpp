@@ -15,6 +15,7 @@
 //*****************************************************************************
 #include "dl_node.hpp"
 
+#include <cstring>
 #include <map>
 #include <optional>
 #include <utility>
@@ -25,13 +26,15 @@
 #include "../modelinstance.hpp"
 #include "../modelinstanceunloadguard.hpp"
 #include "../ov_utils.hpp"
+#include "../profiler.hpp"
 #include "../timer.hpp"
 #include "dlnodesession.hpp"
 #include "nodestreamidguard.hpp"
 
 namespace ovms {
 
-const uint32_t WAIT_FOR_STREAM_ID_TIMEOUT_MICROSECONDS = 1;
+// pipeline is notified when stream id becomes available, so there is no need to wait for it here
+const uint32_t WAIT_FOR_STREAM_ID_TIMEOUT_MICROSECONDS = 0;
 
 Status DLNode::getRealOutputName(ModelInstance& model, const std::string& alias, std::string* result) const {
     auto it = nodeOutputNameAlias.find(alias);
@@ -57,7 +60,7 @@ DLNode::DLNode(const std::string& nodeName,
     nodeOutputNameAlias(std::move(nodeOutputNameAlias)) {
 }
 
-Status DLNode::execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) {
+Status DLNode::execute(const session_key_t& sessionKey, PipelineEventQueue& notifyEndQueue) {
     auto& nodeSession = getNodeSession(sessionKey);
     auto& dlNodeSession = static_cast<DLNodeSession&>(nodeSession);
     return dlNodeSession.execute(notifyEndQueue, WAIT_FOR_STREAM_ID_TIMEOUT_MICROSECONDS, *this);
@@ -76,15 +79,20 @@ Status DLNode::fetchResults(NodeSession& nodeSession, SessionResults& nodeSessio
     auto& metadataTensorResultsPair = it.first->second;
     auto& tensorResults = metadataTensorResultsPair.second;
     Status status;
+    auto& model = dlNodeSession.getModelInstance();
+    if (dlNodeSession.isBatched()) {
+        status = this->fetchBatchedResults(tensorResults, dlNodeSession, model);
+        INCREMENT_IF_ENABLED(model.getMetricReporter().getInferRequestMetric(sessionMetadata.getContext()));
+        return status;
+    }
     const uint32_t waitTimeMicroseconds = 1;
     auto& inferRequest = dlNodeSession.getInferRequest(waitTimeMicroseconds);
-    auto& model = dlNodeSession.getModelInstance();
     status = this->fetchResults(tensorResults, inferRequest, model, nodeSession.getSessionKey());
     INCREMENT_IF_ENABLED(model.getMetricReporter().getInferRequestMetric(sessionMetadata.getContext()));
     return status;
 }
 
-Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& inferRequest, ModelInstance& model, session_key_t sessionKey) {
+Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& inferRequest, ModelInstance& model, const session_key_t& sessionKey) {
     ReleaseSessionGuard releaseSessionGuard(this->getNodeSession(sessionKey));
     // Wait for tensor results
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Waiting for infer request to finish", getName(), sessionKey);
@@ -107,6 +115,7 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
         ovInferTime / 1000);
 
     static_cast<DLNodeSession&>(this->getNodeSession(sessionKey)).clearInputs();
+    const auto& sessionMetadata = this->getNodeSession(sessionKey).getNodeSessionMetadata();
 
     // Fill outputs map with result tensors. Fetch only those that are required in following nodes.
     for (const auto& node : this->next) {
@@ -127,16 +136,23 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
                 const auto tensor = inferRequest.get_tensor(realModelOutputName);
                 SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Creating copy of tensor from model: {}, tensorName: {}",
                     getName(), sessionKey, modelName, realModelOutputName);
-                ov::Tensor copiedTensor;
-                auto status = tensorClone(copiedTensor, tensor);
-                if (!status.ok()) {
-                    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Could not clone result tensor; node: {}; session: {}; model name: {}; output: {}",
-                        getName(),
-                        this->modelName,
-                        realModelOutputName);
-                    return status;
+                auto gatheredShard = reserveOutputInGatheringNode(output_name, sessionMetadata, tensor);
+                if (gatheredShard) {
+                    OVMS_PROFILE_SCOPE("Copy Shard In Place");
+                    std::memcpy(gatheredShard->getActualTensor().data(), tensor.data(), tensor.get_byte_size());
+                    outputs.emplace(std::make_pair(output_name, std::move(gatheredShard.value())));
+                } else {
+                    ov::Tensor copiedTensor;
+                    auto status = tensorClone(copiedTensor, tensor);
+                    if (!status.ok()) {
+                        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Could not clone result tensor; node: {}; session: {}; model name: {}; output: {}",
+                            getName(),
+                            this->modelName,
+                            realModelOutputName);
+                        return status;
+                    }
+                    outputs.emplace(std::make_pair(output_name, TensorWithSource(std::move(copiedTensor))));
                 }
-                outputs.emplace(std::make_pair(output_name, TensorWithSource(std::move(copiedTensor))));
             } catch (const ov::Exception& e) {
                 Status status = StatusCode::OV_INTERNAL_SERIALIZATION_ERROR;
                 SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session:{} Error during getting tensor {}; exception message: {}", getName(), sessionKey, status.string(), e.what());
@@ -148,7 +164,69 @@ Status DLNode::fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& infe
     return StatusCode::OK;
 }
 
-void DLNode::release(session_key_t sessionId) {
+Status DLNode::fetchBatchedResults(TensorWithSourceMap& outputs, DLNodeSession& nodeSession, ModelInstance& model) {
+    const auto& sessionMetadata = nodeSession.getNodeSessionMetadata();
+    const auto& sessionKey = sessionMetadata.getSessionKey();
+    ReleaseSessionGuard releaseSessionGuard(nodeSession);
+    if (!nodeSession.getBatchedStatus().ok()) {
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} batched inference failed: {}", getName(), sessionKey, nodeSession.getBatchedStatus().string());
+        return nodeSession.getBatchedStatus();
+    }
+    // inference time is already reported by the scheduler once per batch
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Batched inference processing time for node {}; model name: {}; session: {} - {} ms",
+        this->getName(),
+        model.getName(),
+        sessionKey,
+        nodeSession.getTimer().elapsed<std::chrono::microseconds>(EXECUTE) / 1000);
+    auto& batchedOutputs = nodeSession.getBatchedOutputs();
+    for (const auto& node : this->next) {
+        for (const auto& pair : node.get().getMappingByDependency(*this)) {
+            const auto& output_name = pair.first;
+            if (outputs.find(output_name) != outputs.end()) {
+                continue;
+            }
+            std::string realModelOutputName;
+            if (!getRealOutputName(model, output_name, &realModelOutputName).ok()) {
+                SPDLOG_LOGGER_WARN(dag_executor_logger, "Node: {} session: {} Cannot find real model output name for alias: {}", getName(), sessionKey, output_name);
+                return StatusCode::INTERNAL_ERROR;
+            }
+            auto it = batchedOutputs.find(realModelOutputName);
+            if (it == batchedOutputs.end()) {
+                SPDLOG_LOGGER_ERROR(dag_executor_logger, "Node: {} session: {} Missing batched output: {}", getName(), sessionKey, realModelOutputName);
+                return StatusCode::INTERNAL_ERROR;
+            }
+            // split outputs are already owned by this session, copy is needed only to write in place into gathered tensor
+            auto gatheredShard = reserveOutputInGatheringNode(output_name, sessionMetadata, it->second);
+            if (gatheredShard) {
+                OVMS_PROFILE_SCOPE("Copy Shard In Place");
+                std::memcpy(gatheredShard->getActualTensor().data(), it->second.data(), it->second.get_byte_size());
+                outputs.emplace(std::make_pair(output_name, std::move(gatheredShard.value())));
+            } else {
+                outputs.emplace(std::make_pair(output_name, TensorWithSource(it->second)));
+            }
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} Tensor with name {} has been prepared", getName(), sessionKey, output_name);
+        }
+    }
+    return StatusCode::OK;
+}
+
+std::optional<TensorWithSource> DLNode::reserveOutputInGatheringNode(const std::string& outputName, const NodeSessionMetadata& metadata, const ov::Tensor& tensor) {
+    // demultiplied outputs are sharded later, so they do not match gathering node shards
+    if (demultiplexCount) {
+        return std::nullopt;
+    }
+    for (const auto& node : this->next) {
+        auto shard = node.get().reserveGatheredShard(*this, outputName, metadata, tensor.get_element_type(), tensor.get_shape());
+        if (shard) {
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} output: {} will be written in place into gathered tensor of node: {}",
+                getName(), metadata.getSessionKey(), outputName, node.get().getName());
+            return shard;
+        }
+    }
+    return std::nullopt;
+}
+
+void DLNode::release(const session_key_t& sessionId) {
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Release node: {} sessionKey: {}", getName(), sessionId);
     getNodeSession(sessionId).release();
 }
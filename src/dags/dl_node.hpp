@@ -29,6 +29,7 @@
 
 namespace ovms {
 
+class DLNodeSession;
 class ModelInstance;
 class ModelInstanceUnloadGuard;
 class NodeStreamIdGuard;
@@ -51,18 +52,20 @@ public:
         std::unordered_map<std::string, std::string> nodeOutputNameAlias = {},
         std::optional<int32_t> demultiplyCount = std::nullopt, std::set<std::string> gatherFromNode = {});
 
-    Status execute(session_key_t sessionKey, PipelineEventQueue& notifyEndQueue) override;
+    Status execute(const session_key_t& sessionKey, PipelineEventQueue& notifyEndQueue) override;
 
     Status fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) override;
 
 private:
-    Status fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& inferRequest, ModelInstance& model, session_key_t sessionKey);
+    Status fetchResults(TensorWithSourceMap& outputs, ov::InferRequest& inferRequest, ModelInstance& model, const session_key_t& sessionKey);
+    Status fetchBatchedResults(TensorWithSourceMap& outputs, DLNodeSession& nodeSession, ModelInstance& model);
 
 public:
-    void release(session_key_t sessionId) override;
+    void release(const session_key_t& sessionId) override;
 
 private:
     Status getRealOutputName(ModelInstance& model, const std::string& alias, std::string* result) const;
+    std::optional<TensorWithSource> reserveOutputInGatheringNode(const std::string& outputName, const NodeSessionMetadata& metadata, const ov::Tensor& tensor);
 
     Status executeInference(PipelineEventQueue& notifyEndQueue, ov::InferRequest& infer_request);
     bool tryDisarm(const session_key_t& sessionKey, const uint32_t microseconds = 1) override;
@@ -19,6 +19,7 @@
 #include <map>
 #include <string>
 
+#include "../dynamic_batching_scheduler.hpp"
 #include "../logging.hpp"
 #include "../model_instance_provider.hpp"
 #include "../modelinstance.hpp"
@@ -66,7 +67,7 @@ ov::InferRequest& DLNodeSession::getInferRequest(const uint32_t microseconds) {
     return inferRequestsQueue.getInferRequest(streamIdOpt.value());
 }
 
-Status DLNodeSession::requestExecuteRequiredResources() {
+Status DLNodeSession::requestExecuteRequiredResources(PipelineEventQueue& notifyEndQueue) {
     OVMS_PROFILE_FUNCTION();
     Status status = modelManager.getModelInstance(
         this->getModelName(),
@@ -83,11 +84,45 @@ Status DLNodeSession::requestExecuteRequiredResources() {
     if (!status.ok()) {
         return status;
     }
+    status = tryPrepareBatchedInference();
+    if (!status.ok() || this->batched) {
+        return status;
+    }
     this->timer->start(GET_INFER_REQUEST);
-    this->nodeStreamIdGuard = std::make_unique<NodeStreamIdGuard>(model->getInferRequestsQueue(), model->getMetricReporter());
+    // pipeline is woken up to retry deferred execution as soon as infer request is returned to the queue
+    this->nodeStreamIdGuard = std::make_unique<NodeStreamIdGuard>(model->getInferRequestsQueue(), model->getMetricReporter(), notifyEndQueue.createStreamReadyCallback());
     return status;
 }
 
+Status DLNodeSession::tryPrepareBatchedInference() {
+    auto* scheduler = this->model->getDynamicBatchingScheduler();
+    if (scheduler == nullptr) {
+        return StatusCode::OK;
+    }
+    // precision and shape are already validated against model tensor info by prepareInputsAndModelForInference
+    for (const auto& [name, tensor] : this->inputHandler->getInputs()) {
+        std::string realModelInputName;
+        if (!getRealInputName(name, &realModelInputName).ok()) {
+            this->batchedInputs.clear();
+            return StatusCode::OK;
+        }
+        this->batchedInputs.emplace(realModelInputName, tensor);
+    }
+    if (!scheduler->isBatchable(this->batchedInputs)) {
+        this->batchedInputs.clear();
+        return StatusCode::OK;
+    }
+    auto status = scheduler->validateBatchSize(this->batchedInputs);
+    if (!status.ok()) {
+        // same as direct model requests, sessions which cannot be merged are executed unbatched
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "[Node: {}] session: {} cannot be enqueued in dynamic batching scheduler: {}; executing unbatched", getName(), getSessionKey(), status.string());
+        this->batchedInputs.clear();
+        return StatusCode::OK;
+    }
+    this->batched = true;
+    return StatusCode::OK;
+}
+
 Status DLNodeSession::prepareInputsAndModelForInference() {
     OVMS_PROFILE_FUNCTION();
     // Validate each tensor against its OV tensor info
@@ -205,11 +240,14 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint32_t waitF
     OVMS_PROFILE_FUNCTION();
     Status status;
     if (this->nodeStreamIdGuard == nullptr) {
-        status = requestExecuteRequiredResources();
+        status = requestExecuteRequiredResources(notifyEndQueue);
         if (!status.ok()) {
             notifyEndQueue.push({node, getSessionKey()});
             return status;
         }
+        if (this->batched) {
+            return executeBatched(notifyEndQueue, node);
+        }
     }
     auto streamIdOpt = this->nodeStreamIdGuard->tryGetId(waitForStreamIdTimeoutMicroseconds);
     if (!streamIdOpt) {
@@ -234,6 +272,22 @@ Status DLNodeSession::execute(PipelineEventQueue& notifyEndQueue, uint32_t waitF
     return status;
 }
 
+Status DLNodeSession::executeBatched(PipelineEventQueue& notifyEndQueue, Node& node) {
+    OVMS_PROFILE_FUNCTION();
+    SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} enqueued in dynamic batching scheduler of model: {}", getName(), getSessionKey(), getModelName());
+    this->timer->start(EXECUTE);
+    // completion is reported through the event queue, errors are returned from DLNode::fetchResults
+    this->model->getDynamicBatchingScheduler()->inferAsync(this->batchedInputs, this->batchedOutputs, [this, &notifyEndQueue, &node](Status status) {
+        this->timer->stop(EXECUTE);
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Batched inference finished for node name: {} session: {} with: {}", getName(), getSessionKey(), status.string());
+        this->batchedStatus = std::move(status);
+        this->batchedInputs.clear();
+        this->inputHandler->clearInputs();
+        notifyEndQueue.push({node, getSessionKey()});
+    });
+    return StatusCode::OK;
+}
+
 Status DLNodeSession::getRealInputName(const std::string& alias, std::string* result) const {
     auto it = this->model->getInputsInfo().find(alias);
     if (it == this->model->getInputsInfo().end()) {
@@ -310,6 +364,7 @@ Status DLNodeSession::executeInference(PipelineEventQueue& notifyEndQueue, ov::I
 }
 
 void DLNodeSession::release() {
+    this->batchedOutputs.clear();
     this->nodeStreamIdGuard.reset();
     this->model.reset();
     this->modelUnloadGuard.reset();
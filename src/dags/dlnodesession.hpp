@@ -23,8 +23,10 @@
 #include <openvino/runtime/tensor.hpp>
 
 #include "../modelversion.hpp"
+#include "../status.hpp"
 #include "nodesession.hpp"
 #include "pipelineeventqueue.hpp"
+#include "tensormap.hpp"
 
 namespace ovms {
 
@@ -33,7 +35,6 @@ class ModelInstance;
 class Node;
 class NodeStreamIdGuard;
 class ModelInstanceUnloadGuard;
-class Status;
 class TensorInfo;
 
 class DLNodeSession : public NodeSession {
@@ -45,6 +46,12 @@ class DLNodeSession : public NodeSession {
     const std::string& modelName;
     const model_version_t modelVersion;
 
+    // set when session is executed through model dynamic batching scheduler instead of own infer request
+    bool batched = false;
+    TensorMap batchedInputs;
+    TensorMap batchedOutputs;
+    Status batchedStatus;
+
 public:
     DLNodeSession(const NodeSessionMetadata& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelInstanceProvider& manager, const std::string& modelName, model_version_t modelVersion);
     DLNodeSession(const NodeSessionMetadata&& metadata, const std::string& nodeName, uint32_t inputsCount, const CollapseDetails& collapsingDetails, ModelInstanceProvider& manager, const std::string& modelName, model_version_t modelVersion);
@@ -53,8 +60,14 @@ public:
     ov::InferRequest& getInferRequest(const uint32_t microseconds);
     ModelInstance& getModelInstance();
 
+    bool isBatched() const { return batched; }
+    const Status& getBatchedStatus() const { return batchedStatus; }
+    TensorMap& getBatchedOutputs() { return batchedOutputs; }
+
 private:
-    Status requestExecuteRequiredResources();
+    Status requestExecuteRequiredResources(PipelineEventQueue& notifyEndQueue);
+    Status tryPrepareBatchedInference();
+    Status executeBatched(PipelineEventQueue& notifyEndQueue, Node& node);
 
 public:
     Status prepareInputsAndModelForInference();
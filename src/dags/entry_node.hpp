@@ -47,7 +47,7 @@ public:
         factories.emplace(OVMS_BUFFERTYPE_CPU, std::make_shared<RegularOVTensorFactory>());
     }
 
-    Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override;
+    Status execute(const session_key_t& sessionId, PipelineEventQueue& notifyEndQueue) override;
 
     Status fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) override;
 
@@ -37,7 +37,7 @@
 namespace ovms {
 
 template <typename RequestType>
-Status EntryNode<RequestType>::execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) {
+Status EntryNode<RequestType>::execute(const session_key_t& sessionId, PipelineEventQueue& notifyEndQueue) {
     OVMS_PROFILE_FUNCTION();
     notifyEndQueue.push(NodeSessionKeyPair(*this, sessionId));
     return StatusCode::OK;
@@ -37,7 +37,7 @@ Status ExitNode<ResponseType>::fetchResults(NodeSession& nodeSession, SessionRes
 }
 
 template <typename ResponseType>
-Status ExitNode<ResponseType>::execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) {
+Status ExitNode<ResponseType>::execute(const session_key_t& sessionId, PipelineEventQueue& notifyEndQueue) {
     OVMS_PROFILE_FUNCTION();
     notifyEndQueue.push(NodeSessionKeyPair(*this, sessionId));
     return StatusCode::OK;
@@ -17,11 +17,14 @@
 
 #include <algorithm>
 #include <functional>
+#include <numeric>
+#include <optional>
 
 #include "../logging.hpp"
 #include "../ov_utils.hpp"
 #include "../profiler.hpp"
 #include "../status.hpp"
+#include "../tensor_utils.hpp"
 #include "../tensorinfo.hpp"
 
 namespace ovms {
@@ -58,19 +61,30 @@ Status GatherNodeInputHandler::notifyFinishedDependency() {
         OVMS_PROFILE_SCOPE("Gather Tensor");
         const auto shardsCount = shardMap.size();
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Consolidating: {} shards for input: {}", shardsCount, inputName);
-        session_id_t firstShardId = 0;
-        const auto& firstShard = shardMap.at(firstShardId);
-        const auto& firstShardDims = firstShard.get_shape();
-        auto precision = firstShard.get_element_type();
-        auto newDims = firstShardDims;
-        newDims.insert(newDims.begin(),
-            collapsingDetails->collapsedSessionSizes.begin(),
-            collapsingDetails->collapsedSessionSizes.end());
         ov::Tensor consolidatedTensor;
-        auto status = prepareConsolidatedTensor(consolidatedTensor, inputName, precision, newDims);
-        if (!status.ok()) {
-            return status;
+        ov::element::Type precision;
+        ov::Shape firstShardDims;
+        auto reservedIt = reservedConsolidatedTensors.find(inputName);
+        if (reservedIt != reservedConsolidatedTensors.end()) {
+            consolidatedTensor = reservedIt->second;
+            precision = consolidatedTensor.get_element_type();
+            const auto& consolidatedDims = consolidatedTensor.get_shape();
+            firstShardDims = ov::Shape(consolidatedDims.begin() + collapsingDetails->collapsedSessionSizes.size(), consolidatedDims.end());
+        } else {
+            session_id_t firstShardId = 0;
+            const auto& firstShard = shardMap.at(firstShardId);
+            firstShardDims = firstShard.get_shape();
+            precision = firstShard.get_element_type();
+            auto newDims = firstShardDims;
+            newDims.insert(newDims.begin(),
+                collapsingDetails->collapsedSessionSizes.begin(),
+                collapsingDetails->collapsedSessionSizes.end());
+            auto status = prepareConsolidatedTensor(consolidatedTensor, inputName, precision, newDims);
+            if (!status.ok()) {
+                return status;
+            }
         }
+        size_t copiedShardsCount = 0;
         for (auto& [shardId, tensor] : shardMap) {
             OVMS_PROFILE_SCOPE("Copy Shard");
             if ((tensor.get_element_type() != precision) ||
@@ -90,15 +104,63 @@ Status GatherNodeInputHandler::notifyFinishedDependency() {
             }
             const auto memstep = tensor.get_byte_size();
             size_t offset = shardId * memstep;
+            if (tensor.data() == (char*)consolidatedTensor.data() + offset) {
+                // shard was written in place
+                continue;
+            }
             memcpy((char*)consolidatedTensor.data() + offset,
                 tensor.data(),
                 memstep);
+            ++copiedShardsCount;
         }
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Consolidated input: {}; shards copied: {}; shards written in place: {}", inputName, copiedShardsCount, shardsCount - copiedShardsCount);
         inputTensors.insert({inputName, consolidatedTensor});
     }
     return StatusCode::OK;
 }
 
+std::optional<TensorWithSource> GatherNodeInputHandler::reserveShard(const std::string& inputName, session_id_t shardId, ov::element::Type_t precision, const ov::Shape& shardShape) {
+    if (precision == ov::element::Type_t::string) {
+        return std::nullopt;
+    }
+    const session_id_t shardsCount = std::accumulate(
+        collapsingDetails->collapsedSessionSizes.begin(),
+        collapsingDetails->collapsedSessionSizes.end(),
+        session_id_t{1},
+        std::multiplies<session_id_t>());
+    if (shardId >= shardsCount) {
+        return std::nullopt;
+    }
+    auto it = reservedConsolidatedTensors.find(inputName);
+    if (it == reservedConsolidatedTensors.end()) {
+        if (shardsStorage.count(inputName) > 0) {
+            // some shards are already stored, consolidated tensor will be prepared when gathering
+            return std::nullopt;
+        }
+        auto newDims = shardShape;
+        newDims.insert(newDims.begin(),
+            collapsingDetails->collapsedSessionSizes.begin(),
+            collapsingDetails->collapsedSessionSizes.end());
+        ov::Tensor consolidatedTensor;
+        auto status = prepareConsolidatedTensor(consolidatedTensor, inputName, precision, newDims);
+        if (!status.ok()) {
+            SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Could not preallocate consolidated tensor for input: {}; shards will be copied when gathering", inputName);
+            return std::nullopt;
+        }
+        SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Preallocated consolidated tensor for input: {}; shards count: {}", inputName, shardsCount);
+        it = reservedConsolidatedTensors.emplace(inputName, std::move(consolidatedTensor)).first;
+    }
+    const ov::Tensor& consolidatedTensor = it->second;
+    const auto& consolidatedDims = consolidatedTensor.get_shape();
+    if ((consolidatedTensor.get_element_type() != precision) ||
+        (ov::Shape(consolidatedDims.begin() + collapsingDetails->collapsedSessionSizes.size(), consolidatedDims.end()) != shardShape)) {
+        return std::nullopt;
+    }
+    const size_t memstep = consolidatedTensor.get_byte_size() / shardsCount;
+    ov::Tensor shard(precision, shardShape, (char*)consolidatedTensor.data() + shardId * memstep);
+    return TensorWithSource(shard, consolidatedTensor);
+}
+
 Status GatherNodeInputHandler::prepareConsolidatedTensor(ov::Tensor& tensorOut, const std::string& name, ov::element::Type_t precision, const ov::Shape& shape) const {
     return createSharedTensor(tensorOut, precision, shape);
 }
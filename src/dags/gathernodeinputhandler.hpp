@@ -39,6 +39,7 @@ struct CollapseDetails;
 
 class GatherNodeInputHandler : public NodeInputHandler {
     std::unordered_map<std::string, shard_map_t> shardsStorage;
+    std::unordered_map<std::string, ov::Tensor> reservedConsolidatedTensors;
     std::unique_ptr<CollapseDetails> collapsingDetails;
 
 public:
@@ -54,6 +55,14 @@ public:
     }
     Status setInput(const std::string& inputName, TensorWithSource& tensor, session_id_t shardId) override;
     Status notifyFinishedDependency() override;
+    /**
+     * @brief Returns view into consolidated tensor slot of given shard, with consolidated tensor as its source.
+     *
+     * Consolidated tensor is allocated on first reservation for given input, using that shard precision and shape.
+     * Shards written into reserved slots are not copied during consolidation.
+     * Returns std::nullopt if shard does not match first reserved shard, such shard is copied as before.
+     */
+    std::optional<TensorWithSource> reserveShard(const std::string& inputName, session_id_t shardId, ov::element::Type_t precision, const ov::Shape& shardShape) override;
 
 protected:
     virtual Status prepareConsolidatedTensor(ov::Tensor& tensorOut, const std::string& name, ov::element::Type_t precision, const ov::Shape& shape) const;
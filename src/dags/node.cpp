@@ -22,10 +22,13 @@
 #include <vector>
 
 #include "../logging.hpp"
+#include "../metrics/metric.hpp"
+#include "../model_metric_reporter.hpp"
 #include "../ov_utils.hpp"
 #include "../profiler.hpp"
 #include "../shape.hpp"
 #include "../status.hpp"
+#include "../timer.hpp"
 #include "nodesession.hpp"
 #include "tensormap.hpp"
 
@@ -59,7 +62,7 @@ Node::Node(const std::string& nodeName, std::optional<int32_t> demultiplyCount,
             } }));
 }
 
-Status Node::fetchResults(session_key_t sessionId, SessionResults& nodeSessionOutputs) {
+Status Node::fetchResults(const session_key_t& sessionId, SessionResults& nodeSessionOutputs) {
     OVMS_PROFILE_FUNCTION();
     auto it = nodeSessions.find(sessionId);
 
@@ -68,16 +71,40 @@ Status Node::fetchResults(session_key_t sessionId, SessionResults& nodeSessionOu
         return StatusCode::UNKNOWN_ERROR;
     }
     auto& nodeSession = it->second;
+    nodeSession->getTimer().start(FETCH_RESULTS);
     auto status = fetchResults(*nodeSession, nodeSessionOutputs);
     if (status.ok() && demultiplexCount) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will demultiply node: {} outputs with demultiplyCount: {}", getName(), demultiplyCountSettingToString(demultiplexCount));
         status = demultiplyOutputs(nodeSessionOutputs);
     }
+    nodeSession->getTimer().stop(FETCH_RESULTS);
+    recordSessionProfile(*nodeSession);
     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will remove node: {} session: {}", getName(), sessionId);
     nodeSessions.erase(sessionId);
     return status;
 }
 
+void Node::recordSessionProfile(NodeSession& nodeSession) {
+    executionProfile.add(nodeSession);
+    if (metricReporter == nullptr) {
+        return;
+    }
+    auto& timer = nodeSession.getTimer();
+    // phases which never started, eg. waiting for infer request in entry, exit or custom node, are not observed
+    if (timer.isMeasured(WAIT_FOR_INPUTS)) {
+        OBSERVE_IF_ENABLED(metricReporter->waitForInputsTime, timer.elapsed<std::chrono::microseconds>(WAIT_FOR_INPUTS));
+    }
+    if (timer.isMeasured(GET_INFER_REQUEST)) {
+        OBSERVE_IF_ENABLED(metricReporter->waitForInferReqTime, timer.elapsed<std::chrono::microseconds>(GET_INFER_REQUEST));
+    }
+    if (timer.isMeasured(EXECUTE)) {
+        OBSERVE_IF_ENABLED(metricReporter->executeTime, timer.elapsed<std::chrono::microseconds>(EXECUTE));
+    }
+    if (timer.isMeasured(FETCH_RESULTS)) {
+        OBSERVE_IF_ENABLED(metricReporter->fetchResultsTime, timer.elapsed<std::chrono::microseconds>(FETCH_RESULTS));
+    }
+}
+
 void Node::printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const Aliases& pairs) {
     std::stringstream ss;
     ss << "Links from:" << sourceNode << " to:" << nodeName << ":\n";
@@ -144,6 +171,29 @@ Status Node::setInputs(const Node& dependency, TensorWithSourceMap& inputs, Node
     return nodeSession->notifyFinishedDependency();
 }
 
+std::optional<TensorWithSource> Node::reserveGatheredShard(const Node& dependency, const std::string& dependencyOutputName, const NodeSessionMetadata& metadata, ov::element::Type_t precision, const ov::Shape& shardShape) {
+    if (!gatherFrom) {
+        return std::nullopt;
+    }
+    const auto& mappingForDependency = this->getMappingByDependency(dependency);
+    auto it = std::find_if(mappingForDependency.begin(), mappingForDependency.end(),
+        [&dependencyOutputName](const auto& pair) { return pair.first == dependencyOutputName; });
+    if (it == mappingForDependency.end()) {
+        return std::nullopt;
+    }
+    session_id_t shardId;
+    try {
+        shardId = metadata.getShardId(gatherFrom.value());
+    } catch (const std::exception&) {
+        return std::nullopt;
+    }
+    NodeSession* nodeSession = getNodeSession(metadata);
+    if (!nodeSession) {
+        return std::nullopt;
+    }
+    return nodeSession->reserveShard(it->second, shardId, precision, shardShape);
+}
+
 NodeSession& Node::getNodeSession(const session_key_t& sessionKey) const {
     auto it = nodeSessions.find(sessionKey);
     if (it == nodeSessions.end()) {
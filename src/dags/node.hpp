@@ -29,16 +29,17 @@
 #include "../shape.hpp"
 #include "aliases.hpp"
 #include "nodesessionresult.hpp"
+#include "pipeline_profile.hpp"
 #include "pipelineeventqueue.hpp"
 #include "tensormap.hpp"
 
 namespace ovms {
 
 using TensorNames = std::vector<std::string>;
-using session_key_t = std::string;
 
 class NodeSession;
 class NodeSessionMetadata;
+class PipelineNodeMetricReporter;
 class Status;
 
 class Node {
@@ -57,6 +58,10 @@ protected:
     const std::optional<int32_t> demultiplexCount;
     const std::optional<std::set<std::string>> gatherFrom;
 
+    // aggregated over all node sessions of single pipeline execution
+    NodeExecutionProfile executionProfile;
+    PipelineNodeMetricReporter* metricReporter = nullptr;
+
 public:
     Node(const std::string& nodeName, std::optional<int32_t> demultiplyCount = std::nullopt, std::set<std::string> gatherFromNode = {});
 
@@ -64,12 +69,13 @@ public:
 
     const std::string& getName() const { return this->nodeName; }
 
-    virtual Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) = 0;
-    Status fetchResults(session_key_t sessionId, SessionResults& nodeSessionOutputs);
+    virtual Status execute(const session_key_t& sessionId, PipelineEventQueue& notifyEndQueue) = 0;
+    Status fetchResults(const session_key_t& sessionId, SessionResults& nodeSessionOutputs);
 
 protected:
     virtual Status fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) = 0;
     Status demultiplyOutputs(SessionResults& nodeSessionOutputs);
+    void recordSessionProfile(NodeSession& nodeSession);
     virtual Status createShardedTensor(ov::Tensor& dividedTensor, Precision precision, const shape_t& shape, const ov::Tensor& tensor, size_t i, size_t step, const NodeSessionMetadata& metadata, const std::string tensorName);
 
 public:
@@ -87,11 +93,25 @@ public:
         return tensorNamesMapping.at(dependency.getName());
     }
 
+    /**
+     * @brief Reserves place for dependency output shard in consolidated tensor of gathering node session.
+     *
+     * Allows dependency to write its output directly into gathered tensor.
+     * Returns std::nullopt if node does not gather or input cannot be reserved.
+     */
+    std::optional<TensorWithSource> reserveGatheredShard(const Node& dependency, const std::string& dependencyOutputName, const NodeSessionMetadata& metadata, ov::element::Type_t precision, const ov::Shape& shardShape);
+
     std::vector<session_key_t> getReadySessions() const;
     const std::vector<std::reference_wrapper<Node>>& getNextNodes() {
         return next;
     }
-    virtual void release(session_key_t sessionId) {}
+    const std::vector<std::reference_wrapper<Node>>& getPreviousNodes() const {
+        return previous;
+    }
+
+    void setMetricReporter(PipelineNodeMetricReporter* reporter) { this->metricReporter = reporter; }
+    const NodeExecutionProfile& getExecutionProfile() const { return executionProfile; }
+    virtual void release(const session_key_t& sessionId) {}
     virtual bool tryDisarm(const session_key_t& sessionKey, const uint32_t microseconds = 1) { return true; }
 
     static void printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const Aliases& pairs);
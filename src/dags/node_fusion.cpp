@@ -0,0 +1,248 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "node_fusion.hpp"
+
+#include <exception>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <openvino/op/convert.hpp>
+#include <openvino/op/parameter.hpp>
+
+#include "../logging.hpp"
+#include "../modelconfig.hpp"
+#include "../modelinstanceunloadguard.hpp"
+#include "../status.hpp"
+#include "../tensorinfo.hpp"
+
+namespace ovms {
+
+std::shared_ptr<ov::Model> FusedModelInstance::loadOVModelPtr(const std::string& modelFile) {
+    SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Using fused model instead of reading model file: {} for model: {}", modelFile, getName());
+    return this->fusedModel->clone();
+}
+
+void FusedModelInstanceProvider::reset(ModelInstanceProvider& provider, std::map<std::string, std::shared_ptr<ModelInstance>>&& fusedInstances) {
+    std::unique_lock lock(mtx);
+    this->provider = &provider;
+    this->fusedInstances = std::move(fusedInstances);
+}
+
+ModelInstanceProvider& FusedModelInstanceProvider::getProvider() const {
+    std::shared_lock lock(mtx);
+    return *provider;
+}
+
+std::shared_ptr<ModelInstance> FusedModelInstanceProvider::findFusedInstance(const std::string& name) const {
+    std::shared_lock lock(mtx);
+    auto it = fusedInstances.find(name);
+    if (it == fusedInstances.end()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+Status FusedModelInstanceProvider::getModelInstance(
+    const std::string& modelName,
+    model_version_t modelVersionId,
+    std::shared_ptr<ModelInstance>& modelInstance,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const {
+    auto fusedInstance = findFusedInstance(modelName);
+    if (fusedInstance == nullptr) {
+        return getProvider().getModelInstance(modelName, modelVersionId, modelInstance, modelInstanceUnloadGuardPtr);
+    }
+    modelInstance = std::move(fusedInstance);
+    return modelInstance->waitForLoaded(0, modelInstanceUnloadGuardPtr);
+}
+
+const std::shared_ptr<Model> FusedModelInstanceProvider::findModelByName(const std::string& name) const {
+    return getProvider().findModelByName(name);
+}
+
+const std::shared_ptr<ModelInstance> FusedModelInstanceProvider::findModelInstance(const std::string& name, model_version_t version) const {
+    auto fusedInstance = findFusedInstance(name);
+    if (fusedInstance != nullptr) {
+        return fusedInstance;
+    }
+    return getProvider().findModelInstance(name, version);
+}
+
+bool FusedModelInstanceProvider::subscribeToModel(const std::string& name, model_version_t version, NotifyReceiver& receiver) {
+    return getProvider().subscribeToModel(name, version, receiver);
+}
+
+void FusedModelInstanceProvider::unsubscribeFromModel(const std::string& name, model_version_t version, NotifyReceiver& receiver) {
+    getProvider().unsubscribeFromModel(name, version, receiver);
+}
+
+Status FusedModelInstanceProvider::getModelInputsInfo(const std::string& name, model_version_t version, tensor_map_t& info) const {
+    auto fusedInstance = findFusedInstance(name);
+    if (fusedInstance == nullptr) {
+        return getProvider().getModelInputsInfo(name, version, info);
+    }
+    info = fusedInstance->getInputsInfo();
+    return StatusCode::OK;
+}
+
+Status FusedModelInstanceProvider::getModelOutputsInfo(const std::string& name, model_version_t version, tensor_map_t& info) const {
+    auto fusedInstance = findFusedInstance(name);
+    if (fusedInstance == nullptr) {
+        return getProvider().getModelOutputsInfo(name, version, info);
+    }
+    info = fusedInstance->getOutputsInfo();
+    return StatusCode::OK;
+}
+
+Status FusedModelInstanceProvider::hasAutoModelParameters(const std::string& name, model_version_t version, bool& batchAuto, bool& shapeAuto) const {
+    if (findFusedInstance(name) == nullptr) {
+        return getProvider().hasAutoModelParameters(name, version, batchAuto, shapeAuto);
+    }
+    batchAuto = false;
+    shapeAuto = false;
+    return StatusCode::OK;
+}
+
+static bool isFusableModel(const NodeInfo& info, const ModelInstanceProvider& modelInstanceProvider, std::string& targetDevice) {
+    auto instance = modelInstanceProvider.findModelInstance(info.modelName, info.modelVersion.value_or(0));
+    if (instance == nullptr || instance->getOVModel() == nullptr) {
+        return false;
+    }
+    const auto& config = instance->getModelConfig();
+    if (config.isDynamicParameterEnabled() || config.isCustomLoaderRequiredToLoadModel() || config.getMaxQueueDelayUs() > 0) {
+        return false;
+    }
+    // fused graph is compiled once, dynamic dimensions would have to be resolved per request
+    auto ovModel = instance->getOVModel();
+    for (const auto& input : ovModel->inputs()) {
+        if (input.get_partial_shape().is_dynamic()) {
+            return false;
+        }
+    }
+    for (const auto& output : ovModel->outputs()) {
+        if (output.get_partial_shape().is_dynamic()) {
+            return false;
+        }
+    }
+    targetDevice = instance->getTargetDevice();
+    return true;
+}
+
+std::vector<std::vector<std::string>> findFusableNodeChains(const std::vector<NodeInfo>& nodeInfos, const pipeline_connections_t& connections, const ModelInstanceProvider& modelInstanceProvider) {
+    std::unordered_map<std::string, const NodeInfo*> infosByName;
+    std::unordered_map<std::string, std::string> devices;
+    for (const auto& info : nodeInfos) {
+        infosByName.emplace(info.nodeName, &info);
+        std::string targetDevice;
+        if (info.kind == NodeKind::DL && isFusableModel(info, modelInstanceProvider, targetDevice)) {
+            devices.emplace(info.nodeName, targetDevice);
+        }
+    }
+    std::unordered_map<std::string, std::set<std::string>> dependants;
+    for (const auto& [dependantName, dependencies] : connections) {
+        for (const auto& [dependencyName, aliases] : dependencies) {
+            dependants[dependencyName].insert(dependantName);
+        }
+    }
+    // node which can be merged with its only dependency
+    auto fusableDependency = [&](const std::string& nodeName) -> const NodeInfo* {
+        auto connectionsIt = connections.find(nodeName);
+        if (devices.count(nodeName) == 0 || connectionsIt == connections.end() || connectionsIt->second.size() != 1) {
+            return nullptr;
+        }
+        const std::string& dependencyName = connectionsIt->second.begin()->first;
+        auto deviceIt = devices.find(dependencyName);
+        if (deviceIt == devices.end() || deviceIt->second != devices.at(nodeName) || dependants[dependencyName].size() != 1) {
+            return nullptr;
+        }
+        const NodeInfo& dependency = *infosByName.at(dependencyName);
+        const NodeInfo& node = *infosByName.at(nodeName);
+        if (dependency.demultiplyCount || !node.gatherFromNode.empty()) {
+            return nullptr;
+        }
+        return &dependency;
+    };
+    std::vector<std::vector<std::string>> chains;
+    for (const auto& info : nodeInfos) {
+        if (devices.count(info.nodeName) == 0 || fusableDependency(info.nodeName) != nullptr) {
+            continue;
+        }
+        // info is head of the chain, extend it with its dependants
+        std::vector<std::string> chain{info.nodeName};
+        while (dependants[chain.back()].size() == 1) {
+            const std::string& dependantName = *dependants[chain.back()].begin();
+            if (fusableDependency(dependantName) == nullptr) {
+                break;
+            }
+            chain.push_back(dependantName);
+        }
+        if (chain.size() > 1) {
+            chains.emplace_back(std::move(chain));
+        }
+    }
+    return chains;
+}
+
+Status fuseNodeModels(const std::vector<const NodeInfo*>& chain, const std::vector<std::shared_ptr<ModelInstance>>& instances, const pipeline_connections_t& connections, const std::string& fusedModelName, std::shared_ptr<ov::Model>& fusedModel) {
+    try {
+        fusedModel = instances[0]->getOVModel()->clone();
+        for (size_t i = 1; i < chain.size(); ++i) {
+            const NodeInfo& dependency = *chain[i - 1];
+            const NodeInfo& node = *chain[i];
+            auto model = instances[i]->getOVModel()->clone();
+            std::set<std::string> connectedInputs;
+            for (const auto& [outputAlias, inputName] : connections.at(node.nodeName).at(dependency.nodeName)) {
+                auto outputNameIt = dependency.outputNameAliases.find(outputAlias);
+                if (outputNameIt == dependency.outputNameAliases.end()) {
+                    SPDLOG_LOGGER_WARN(modelmanager_logger, "Cannot fuse node: {}; missing output alias: {} in node: {}", node.nodeName, outputAlias, dependency.nodeName);
+                    return StatusCode::INTERNAL_ERROR;
+                }
+                const auto& outputsInfo = instances[i - 1]->getOutputsInfo();
+                const auto& inputsInfo = instances[i]->getInputsInfo();
+                auto outputInfoIt = outputsInfo.find(outputNameIt->second);
+                auto inputInfoIt = inputsInfo.find(inputName);
+                if (outputInfoIt == outputsInfo.end() || inputInfoIt == inputsInfo.end()) {
+                    SPDLOG_LOGGER_WARN(modelmanager_logger, "Cannot fuse node: {}; missing tensor: {} -> {}", node.nodeName, outputNameIt->second, inputName);
+                    return StatusCode::INTERNAL_ERROR;
+                }
+                // result node of dependency model is dropped, its producer feeds consumers of next model parameter
+                ov::Output<ov::Node> source = fusedModel->output(outputInfoIt->second->getName()).get_node()->input_value(0);
+                auto parameter = model->input(inputInfoIt->second->getName()).get_node_shared_ptr();
+                if (source.get_element_type() != parameter->get_element_type()) {
+                    source = std::make_shared<ov::op::v0::Convert>(source, parameter->get_element_type())->output(0);
+                }
+                parameter->output(0).replace(source);
+                connectedInputs.insert(inputInfoIt->second->getName());
+            }
+            if (connectedInputs.size() != model->get_parameters().size()) {
+                SPDLOG_LOGGER_WARN(modelmanager_logger, "Cannot fuse node: {}; not all inputs are fed by node: {}", node.nodeName, dependency.nodeName);
+                return StatusCode::INTERNAL_ERROR;
+            }
+            fusedModel = std::make_shared<ov::Model>(model->get_results(), fusedModel->get_parameters(), fusedModelName);
+        }
+        fusedModel->validate_nodes_and_infer_types();
+    } catch (const std::exception& e) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Cannot fuse models of nodes ending with: {}; error: {}", chain.back()->nodeName, e.what());
+        return StatusCode::INTERNAL_ERROR;
+    }
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <map>
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "../model_instance_provider.hpp"
+#include "../modelinstance.hpp"
+#include "nodeinfo.hpp"
+
+namespace ovms {
+
+class Status;
+
+/**
+ * @brief Model instance compiled from ov::Model built by merging models of fused DAG nodes.
+ *
+ * Model files are not read. Layout, shape and preprocessing configuration of fused models
+ * is already applied in merged model.
+ */
+class FusedModelInstance : public ModelInstance {
+    std::shared_ptr<ov::Model> fusedModel;
+
+public:
+    FusedModelInstance(const std::string& name, model_version_t version, ov::Core& ieCore, std::shared_ptr<ov::Model> fusedModel) :
+        ModelInstance(name, version, ieCore),
+        fusedModel(std::move(fusedModel)) {}
+
+protected:
+    std::shared_ptr<ov::Model> loadOVModelPtr(const std::string& modelFile) override;
+};
+
+/**
+ * @brief Resolves model instances of fused DAG nodes and forwards remaining queries to underlying provider.
+ */
+class FusedModelInstanceProvider : public ModelInstanceProvider {
+    ModelInstanceProvider* provider = nullptr;
+    std::map<std::string, std::shared_ptr<ModelInstance>> fusedInstances;
+    mutable std::shared_mutex mtx;
+
+public:
+    void reset(ModelInstanceProvider& provider, std::map<std::string, std::shared_ptr<ModelInstance>>&& fusedInstances);
+
+    Status getModelInstance(
+        const std::string& modelName,
+        model_version_t modelVersionId,
+        std::shared_ptr<ModelInstance>& modelInstance,
+        std::unique_ptr<ModelInstanceUnloadGuard>& modelInstanceUnloadGuardPtr) const override;
+    const std::shared_ptr<Model> findModelByName(const std::string& name) const override;
+    const std::shared_ptr<ModelInstance> findModelInstance(const std::string& name, model_version_t version = 0) const override;
+    bool subscribeToModel(const std::string& name, model_version_t version, NotifyReceiver& receiver) override;
+    void unsubscribeFromModel(const std::string& name, model_version_t version, NotifyReceiver& receiver) override;
+    Status getModelInputsInfo(const std::string& name, model_version_t version, tensor_map_t& info) const override;
+    Status getModelOutputsInfo(const std::string& name, model_version_t version, tensor_map_t& info) const override;
+    Status hasAutoModelParameters(const std::string& name, model_version_t version, bool& batchAuto, bool& shapeAuto) const override;
+
+    std::shared_ptr<ModelInstance> findFusedInstance(const std::string& name) const;
+
+private:
+    ModelInstanceProvider& getProvider() const;
+};
+
+/**
+ * @brief Finds linear chains of DL nodes which can be executed as single model.
+ *
+ * Node is appended to the chain when its only dependency is previous node of the chain, previous node has no other
+ * dependants, both models are loaded on the same target device with static shapes and there is no demultiplexer or
+ * gather between them.
+ */
+std::vector<std::vector<std::string>> findFusableNodeChains(const std::vector<NodeInfo>& nodeInfos, const pipeline_connections_t& connections, const ModelInstanceProvider& modelInstanceProvider);
+
+/**
+ * @brief Builds single ov::Model from models of chain nodes by connecting outputs of each node directly to inputs of the next one.
+ */
+Status fuseNodeModels(const std::vector<const NodeInfo*>& chain, const std::vector<std::shared_ptr<ModelInstance>>& instances, const pipeline_connections_t& connections, const std::string& fusedModelName, std::shared_ptr<ov::Model>& fusedModel);
+
+}  // namespace ovms
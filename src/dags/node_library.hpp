@@ -26,6 +26,7 @@ typedef int (*deinitialize_fn)(void*);
 typedef int (*execute_fn)(const struct CustomNodeTensor*, int, struct CustomNodeTensor**, int*, const struct CustomNodeParam*, int, void*);
 typedef int (*metadata_fn)(struct CustomNodeTensorInfo**, int*, const struct CustomNodeParam*, int, void*);
 typedef int (*release_fn)(void*, void*);
+typedef int (*set_buffer_allocator_fn)(const struct CustomNodeBufferAllocator*);
 
 struct NodeLibrary {
     initialize_fn initialize = nullptr;
@@ -16,10 +16,14 @@
 #pragma once
 
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
 
+#include <openvino/core/shape.hpp>
+#include <openvino/core/type/element_type.hpp>
+
 #include "session_id.hpp"
 #include "tensormap.hpp"
 
@@ -47,6 +51,11 @@ public:
     void clearInputs();
     bool isReady();
     virtual Status notifyFinishedDependency();
+    /**
+     * @brief Returns place for input shard so that producer can write it in place.
+     * Only gathering handlers support that.
+     */
+    virtual std::optional<TensorWithSource> reserveShard(const std::string& inputName, session_id_t shardId, ov::element::Type_t precision, const ov::Shape& shardShape) { return std::nullopt; }
     virtual ~NodeInputHandler() = default;
 };
 }  // namespace ovms
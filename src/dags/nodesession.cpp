@@ -30,7 +30,13 @@ const NodeSessionMetadata& NodeSession::getNodeSessionMetadata() const {
 }
 
 Status NodeSession::setInput(const std::string& inputName, TensorWithSource& tensor, session_id_t shardId) {
-    return inputHandler->setInput(inputName, tensor, shardId);
+    auto status = inputHandler->setInput(inputName, tensor, shardId);
+    stopWaitingForInputsIfReady();
+    return status;
+}
+
+std::optional<TensorWithSource> NodeSession::reserveShard(const std::string& inputName, session_id_t shardId, ov::element::Type_t precision, const ov::Shape& shardShape) {
+    return inputHandler->reserveShard(inputName, shardId, precision, shardShape);
 }
 
 static std::unique_ptr<NodeInputHandler> createNodeInputHandler(uint32_t inputsCount, const CollapseDetails& collapsingDetails) {
@@ -45,8 +51,11 @@ NodeSession::NodeSession(const NodeSessionMetadata& metadata, const std::string&
     metadata(metadata),
     sessionKey(metadata.getSessionKey()),
     nodeName(nodeName),
+    createdAt(std::chrono::steady_clock::now()),
     timer(std::make_unique<Timer<TIMER_END>>()),
-    inputHandler(createNodeInputHandler(inputsCount, collapsingDetails)) {}
+    inputHandler(createNodeInputHandler(inputsCount, collapsingDetails)) {
+    this->timer->start(WAIT_FOR_INPUTS);
+}
 
 bool NodeSession::isReady() const {
     bool isReady = inputHandler->isReady();
@@ -55,7 +64,16 @@ bool NodeSession::isReady() const {
 }
 
 Status NodeSession::notifyFinishedDependency() {
-    return this->inputHandler->notifyFinishedDependency();
+    auto status = this->inputHandler->notifyFinishedDependency();
+    stopWaitingForInputsIfReady();
+    return status;
+}
+
+void NodeSession::stopWaitingForInputsIfReady() {
+    if (!this->inputsReady && this->inputHandler->isReady()) {
+        this->timer->stop(WAIT_FOR_INPUTS);
+        this->inputsReady = true;
+    }
 }
 
 Timer<TIMER_END>& NodeSession::getTimer() const {
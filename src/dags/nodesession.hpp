@@ -15,10 +15,15 @@
 //*****************************************************************************
 #pragma once
 
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
+#include <openvino/core/shape.hpp>
+#include <openvino/core/type/element_type.hpp>
+
 #include "nodesessionmetadata.hpp"
 
 namespace ovms {
@@ -30,8 +35,10 @@ template <unsigned int N>
 class Timer;
 
 enum : unsigned int {
+    WAIT_FOR_INPUTS,
     GET_INFER_REQUEST,
     EXECUTE,
+    FETCH_RESULTS,
     TIMER_END
 };
 
@@ -39,6 +46,8 @@ class NodeSession {
     NodeSessionMetadata metadata;
     session_key_t sessionKey;
     const std::string& nodeName;
+    const std::chrono::steady_clock::time_point createdAt;
+    bool inputsReady = false;
 
 protected:
     std::unique_ptr<Timer<TIMER_END>> timer;
@@ -49,6 +58,7 @@ public:
     virtual ~NodeSession();
     const std::string& getName() const { return nodeName; }
     Status setInput(const std::string& inputName, TensorWithSource& tensor, session_id_t shardId);
+    std::optional<TensorWithSource> reserveShard(const std::string& inputName, session_id_t shardId, ov::element::Type_t precision, const ov::Shape& shardShape);
     const NodeSessionMetadata& getNodeSessionMetadata() const;
     const session_key_t& getSessionKey() const { return sessionKey; }
     bool isReady() const;
@@ -56,6 +66,10 @@ public:
     virtual bool tryDisarm(uint32_t microseconds) { return true; }
     Status notifyFinishedDependency();
     Timer<TIMER_END>& getTimer() const;
+    const std::chrono::steady_clock::time_point& getCreationTime() const { return createdAt; }
+
+private:
+    void stopWaitingForInputsIfReady();
 };
 
 class ReleaseSessionGuard {
@@ -34,7 +34,11 @@ NodeSessionMetadata::NodeSessionMetadata(ExecutionContext context) :
 NodeSessionMetadata::NodeSessionMetadata(const std::unordered_map<std::string, std::tuple<session_id_t, session_id_t>>& details, const std::vector<std::string>& sessionsLevels, ExecutionContext context) :
     details(details),
     sessionsLevels(sessionsLevels),
-    context(context) {}
+    context(context) {
+    for (const auto& sessionLevel : sessionsLevels) {
+        sessionKey = sessionKey.withSubsession(std::get<0>(details.at(sessionLevel)));
+    }
+}
 
 std::vector<NodeSessionMetadata> NodeSessionMetadata::generateSubsessions(const std::string& nodeName, session_id_t subsessionSize) const {
     if (nodeName.size() == 0) {
@@ -53,7 +57,7 @@ std::vector<NodeSessionMetadata> NodeSessionMetadata::generateSubsessions(const
     for (auto& meta : metas) {
         meta.details.insert({nodeName, {counter, subsessionSize}});
         meta.sessionsLevels.push_back(nodeName);
-        meta.cached = false;
+        meta.sessionKey = sessionKey.withSubsession(counter);
         ++counter;
     }
     SPDLOG_LOGGER_TRACE(dag_executor_logger, "Generated subsession levels: {}",
@@ -66,10 +70,7 @@ std::vector<NodeSessionMetadata> NodeSessionMetadata::generateSubsessions(const
     return metas;
 }
 
-std::string NodeSessionMetadata::createSessionKey(const std::set<std::string>& ignoredNodeNames) const {
-    if (details.size() == 0) {
-        return "";
-    }
+void NodeSessionMetadata::validateIgnoredNodeNames(const std::set<std::string>& ignoredNodeNames) const {
     if (std::any_of(ignoredNodeNames.begin(),
             ignoredNodeNames.end(),
             [this](auto& ignoredNodeName) {
@@ -81,43 +82,34 @@ std::string NodeSessionMetadata::createSessionKey(const std::set<std::string>& i
             })) {
         throw std::logic_error("Tried to create session key ignoring non-existing subsession");
     }
-    std::stringstream ss;
-    size_t j = 0;
-    for (int32_t i = sessionsLevels.size() - 1; i >= 0; --i, ++j) {
-        if ((ignoredNodeNames.size() > 0) &&
-            (ignoredNodeNames.size() > j) &&
-            (sessionsLevels.size() >= ignoredNodeNames.size()) &&
-            (ignoredNodeNames.find(sessionsLevels[i]) == ignoredNodeNames.end())) {
-            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Tried to collapse sessions not in LIFO order. Should collapse: {} first", sessionsLevels[i]);
+    for (size_t j = 0; j < ignoredNodeNames.size(); ++j) {
+        const auto& sessionLevel = sessionsLevels[sessionsLevels.size() - 1 - j];
+        if (ignoredNodeNames.find(sessionLevel) == ignoredNodeNames.end()) {
+            SPDLOG_LOGGER_ERROR(dag_executor_logger, "Tried to collapse sessions not in LIFO order. Should collapse: {} first", sessionLevel);
             throw std::logic_error("Cannot collapse sessions not in LIFO order");
-        } else {
-            if (j < ignoredNodeNames.size()) {
-                continue;
-            }
-            if (ss.tellp() > 0) {
-                ss << "_";
-            }
-            ss << sessionsLevels[i] << "_" << std::get<0>(details.at(sessionsLevels[i]));
-        }
-        if (i == 0) {
-            break;
         }
     }
-    return ss.str();
 }
 
-std::string NodeSessionMetadata::getSessionKey(const std::set<std::string>& ignoredNodeNames) const {
-    // if set not empty then we need to regenerate the cache and mark it as not cached
-    // we don't want to store previous set but we want to limit recreation of the key
-    if (ignoredNodeNames.size() != 0) {
-        return createSessionKey(ignoredNodeNames);
+session_key_t NodeSessionMetadata::getSessionKey(const std::set<std::string>& ignoredNodeNames) const {
+    if (ignoredNodeNames.size() == 0) {
+        return sessionKey;
     }
-    if (cached) {
-        return this->cachedSessionKey;
+    validateIgnoredNodeNames(ignoredNodeNames);
+    // collapsed levels are always the innermost ones
+    return sessionKey.prefix(sessionKey.size() - ignoredNodeNames.size());
+}
+
+std::string NodeSessionMetadata::getSessionKeyString(const std::set<std::string>& ignoredNodeNames) const {
+    validateIgnoredNodeNames(ignoredNodeNames);
+    std::stringstream ss;
+    for (size_t i = sessionsLevels.size() - ignoredNodeNames.size(); i > 0; --i) {
+        if (ss.tellp() > 0) {
+            ss << "_";
+        }
+        ss << sessionsLevels[i - 1] << "_" << std::get<0>(details.at(sessionsLevels[i - 1]));
     }
-    cached = true;
-    this->cachedSessionKey = createSessionKey(ignoredNodeNames);
-    return this->cachedSessionKey;
+    return ss.str();
 }
 
 std::pair<NodeSessionMetadata, CollapseDetails> NodeSessionMetadata::getCollapsedSessionMetadata(const std::set<std::string>& ignoredNodeNames) const {
@@ -161,6 +153,7 @@ std::pair<NodeSessionMetadata, CollapseDetails> NodeSessionMetadata::getCollapse
             newMeta.sessionsLevels.emplace_back(sessionLevel);
         }
     }
+    newMeta.sessionKey = getSessionKey(ignoredNodeNames);
     return {newMeta, std::move(collapsingDetails)};
 }
 
@@ -17,6 +17,7 @@
 
 #include <future>
 #include <optional>
+#include <utility>
 
 #include "../logging.hpp"
 #include "../model_metric_reporter.hpp"
@@ -25,9 +26,9 @@
 
 namespace ovms {
 
-NodeStreamIdGuard::NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter) :
+NodeStreamIdGuard::NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter, std::function<void()> onStreamReady) :
     inferRequestsQueue_(inferRequestsQueue),
-    futureStreamId(inferRequestsQueue_.getIdleStream()),
+    futureStreamId(inferRequestsQueue_.getIdleStream(std::move(onStreamReady))),
     reporter(reporter) {
     INCREMENT_IF_ENABLED(this->reporter.currentRequests);
 }
@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <functional>
 #include <future>
 #include <optional>
 
@@ -26,7 +27,10 @@ class OVInferRequestsQueue;
 
 class NodeStreamIdGuard {
 public:
-    NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter);
+    /**
+     * @param onStreamReady called when stream id becomes available if it was not available right away
+     */
+    NodeStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter, std::function<void()> onStreamReady = {});
     ~NodeStreamIdGuard();
 
     std::optional<int> tryGetId(const uint32_t microseconds = 1);
@@ -17,8 +17,9 @@
 
 #include <algorithm>
 #include <map>
-#include <set>
+#include <memory>
 #include <string>
+#include <unordered_set>
 #include <utility>
 
 #include "../execution_context.hpp"
@@ -27,11 +28,21 @@
 #include "../status.hpp"
 #include "node.hpp"
 #include "nodesession.hpp"
+#include "pipeline_profile.hpp"
 #include "pipelineeventqueue.hpp"
 
 namespace ovms {
 
 using DeferredNodeSessions = std::vector<std::pair<std::reference_wrapper<Node>, session_key_t>>;
+using NodeSessionId = std::pair<const Node*, session_key_t>;
+
+struct NodeSessionIdHash {
+    size_t operator()(const NodeSessionId& id) const {
+        return std::hash<const Node*>{}(id.first) ^ (id.second.hash() << 1);
+    }
+};
+
+using NodeSessionIds = std::unordered_set<NodeSessionId, NodeSessionIdHash>;
 
 Pipeline::~Pipeline() = default;
 
@@ -94,10 +105,12 @@ Status Pipeline::execute(ExecutionContext context) {
         return StatusCode::INTERNAL_ERROR;
     }
 
-    PipelineEventQueue finishedNodeQueue;
+    // shared since stream ready callbacks of deferred node sessions can be invoked after execution ends
+    auto eventQueue = std::make_shared<PipelineEventQueue>();
+    PipelineEventQueue& finishedNodeQueue = *eventQueue;
     ovms::Status firstErrorStatus{ovms::StatusCode::OK};
-    std::set<std::string> startedSessions;
-    std::set<std::string> finishedSessions;
+    NodeSessionIds startedSessions;
+    NodeSessionIds finishedSessions;
     NodeSessionMetadata meta(context);
     auto* entryNodeSession = entry.getNodeSession(meta);
     if (!entryNodeSession) {
@@ -105,7 +118,7 @@ Status Pipeline::execute(ExecutionContext context) {
         return StatusCode::INTERNAL_ERROR;
     }
     auto entrySessionKey = meta.getSessionKey();
-    startedSessions.emplace(entry.getName() + entrySessionKey);
+    startedSessions.emplace(&entry, entrySessionKey);
     ovms::Status status = entry.execute(std::move(entrySessionKey), finishedNodeQueue);  // first node will trigger first message
     if (!status.ok()) {
         SPDLOG_LOGGER_WARN(dag_executor_logger, "Executing pipeline: {} node: {} failed with: {}",
@@ -113,15 +126,14 @@ Status Pipeline::execute(ExecutionContext context) {
         return status;
     }
     DeferredNodeSessions deferredNodeSessions;
-    const uint32_t WAIT_FOR_FINISHED_NODE_TIMEOUT_MICROSECONDS = 5000;
-    const uint32_t WAIT_FOR_DEFERRED_NODE_DISARM_TIMEOUT_MICROSECONDS = 500;
-    // process finished session nodes and if no one is finished check if any node session with deferred execution
-    // has necessary resources already
+    const uint32_t WAIT_FOR_DEFERRED_NODE_DISARM_TIMEOUT_MICROSECONDS = 0;
+    // process finished session nodes and if no one is finished, infer request was returned
+    // so check if any node session with deferred execution has necessary resources already
     while (true) {
-        spdlog::trace("Pipeline: {} waiting for message that node finished.", getName());
-        OVMS_PROFILE_SYNC_BEGIN("PipelineEventQueue::tryPull");
-        auto optionallyFinishedNode = finishedNodeQueue.tryPull(WAIT_FOR_FINISHED_NODE_TIMEOUT_MICROSECONDS);
-        OVMS_PROFILE_SYNC_END("PipelineEventQueue::tryPull");
+        spdlog::trace("Pipeline: {} waiting for message that node finished or infer request is available.", getName());
+        OVMS_PROFILE_SYNC_BEGIN("PipelineEventQueue::pull");
+        auto optionallyFinishedNode = finishedNodeQueue.pull();
+        OVMS_PROFILE_SYNC_END("PipelineEventQueue::pull");
         if (optionallyFinishedNode) {
             OVMS_PROFILE_SCOPE_S("Processing Finished Node", "node_name", optionallyFinishedNode.value().first.get().getName().c_str());
             /*
@@ -130,7 +142,7 @@ Status Pipeline::execute(ExecutionContext context) {
             auto& [finishedNodeRef, sessionKey] = optionallyFinishedNode.value();
             Node& finishedNode = finishedNodeRef.get();
             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Pipeline: {} got message that node: {} session: {} finished.", getName(), finishedNode.getName(), sessionKey);
-            finishedSessions.emplace(finishedNode.getName() + sessionKey);
+            finishedSessions.emplace(&finishedNode, sessionKey);
             if (!firstErrorStatus.ok()) {
                 finishedNode.release(sessionKey);
             }
@@ -166,7 +178,7 @@ Status Pipeline::execute(ExecutionContext context) {
                 auto readySessions = nextNode.get().getReadySessions();
                 for (auto& readySessionKey : readySessions) {
                     SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Started execution of pipeline: {} node: {} session: {}", getName(), nextNode.get().getName(), readySessionKey);
-                    startedSessions.emplace(nextNode.get().getName() + readySessionKey);
+                    startedSessions.emplace(&nextNode.get(), readySessionKey);
                     status = nextNode.get().execute(readySessionKey, finishedNodeQueue);
                     if (status == StatusCode::PIPELINE_STREAM_ID_NOT_READY_YET) {
                         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Node: {} session: {} not ready for execution yet", nextNode.get().getName(), readySessionKey);
@@ -225,7 +237,7 @@ Status Pipeline::execute(ExecutionContext context) {
                 break;
             }
         } else {
-            OVMS_PROFILE_SCOPE("No new finished nodes");
+            OVMS_PROFILE_SCOPE("Infer request available for deferred nodes");
             // If error occurred earlier, disarm stream id guards of all deferred nodes and exit
             if (!firstErrorStatus.ok()) {
                 SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Will try to disarm all stream id guards of all {} deferred node sessions due to previous error in pipeline", deferredNodeSessions.size());
@@ -236,7 +248,7 @@ Status Pipeline::execute(ExecutionContext context) {
                         auto& node = nodeRef.get();
                         if (node.tryDisarm(sessionKey, WAIT_FOR_DEFERRED_NODE_DISARM_TIMEOUT_MICROSECONDS)) {
                             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Stream id guard disarm of node {} session: {} has succeeded", node.getName(), sessionKey);
-                            finishedSessions.emplace(node.getName() + sessionKey);
+                            finishedSessions.emplace(&node, sessionKey);
                             it = deferredNodeSessions.erase(it);
                         } else {
                             SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Cannot disarm stream id guard of node: {}, session: {} yet, will try again later", node.getName(), sessionKey);
@@ -277,6 +289,34 @@ Status Pipeline::execute(ExecutionContext context) {
             OVMS_PROFILE_SYNC_END("Try deferred nodes");
         }
     }
+    if (firstErrorStatus.ok()) {
+        recordCriticalPath();
+    }
     return firstErrorStatus;
 }
+
+void Pipeline::recordCriticalPath() const {
+    if (this->profiler == nullptr) {
+        return;
+    }
+    // walk back from exit node through dependencies which finished last
+    CriticalPath path;
+    const Node* node = &this->exit;
+    while (node != nullptr) {
+        path.push_back({node->getName(), node->getExecutionProfile()});
+        const Node* lastFinishedDependency = nullptr;
+        for (const auto& dependency : node->getPreviousNodes()) {
+            const auto& lastFinished = dependency.get().getExecutionProfile().lastFinished;
+            if (!lastFinished) {
+                continue;
+            }
+            if (lastFinishedDependency == nullptr || lastFinishedDependency->getExecutionProfile().lastFinished.value() < lastFinished.value()) {
+                lastFinishedDependency = &dependency.get();
+            }
+        }
+        node = lastFinishedDependency;
+    }
+    std::reverse(path.begin(), path.end());
+    this->profiler->record(std::move(path));
+}
 }  // namespace ovms
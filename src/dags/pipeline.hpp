@@ -30,16 +30,21 @@ class ServableMetricReporter;
 class Node;
 
 class Node;
+class ModelInstanceProvider;
+class PipelineProfiler;
 class Status;
 
 void printNodeConnections(const std::string& nodeName, const std::string& sourceNode, const Aliases& pairs);
 
 class Pipeline {
+    // declared before nodes so that it outlives them
+    std::shared_ptr<ModelInstanceProvider> modelInstanceProvider;
     std::vector<std::unique_ptr<Node>> nodes;
     const std::string name;
     Node& entry;
     Node& exit;
     ServableMetricReporter& reporter;
+    PipelineProfiler* profiler = nullptr;
 
 public:
     Pipeline(Node& entry, Node& exit, ServableMetricReporter& reporter, const std::string& name = "default_name");
@@ -59,8 +64,12 @@ public:
 
     ServableMetricReporter& getMetricReporter() const { return this->reporter; }
 
+    void setProfiler(PipelineProfiler* profiler) { this->profiler = profiler; }
+    void setModelInstanceProvider(std::shared_ptr<ModelInstanceProvider> provider) { this->modelInstanceProvider = std::move(provider); }
+
 private:
     std::map<const std::string, bool> prepareStatusMap() const;
+    void recordCriticalPath() const;
 };
 
 }  // namespace ovms
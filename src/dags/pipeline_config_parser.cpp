@@ -145,6 +145,12 @@ static Status processPipelineConfig(
     } else {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Pipeline: {} does not have demultiply at entry node", pipelineName);
     }
+    bool fuseNodes = false;
+    auto fuseNodesIt = pipelineConfig.FindMember("fuse_nodes");
+    if (fuseNodesIt != pipelineConfig.MemberEnd()) {
+        fuseNodes = fuseNodesIt->value.GetBool();
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Pipeline: {} node fusion: {}", pipelineName, fuseNodes);
+    }
 
     std::vector<NodeInfo> info;
     NodeInfo entryInfo{NodeKind::ENTRY, ENTRY_NODE_NAME, "", std::nullopt, {}, demultiplyCountEntry};
@@ -227,7 +233,7 @@ static Status processPipelineConfig(
     info.emplace_back(std::move(NodeInfo(NodeKind::EXIT, EXIT_NODE_NAME, "", std::nullopt, {}, std::nullopt, nonGatheredDemultiplexerNodes)));
     if (!factory.definitionExists(pipelineName)) {
         SPDLOG_DEBUG("Pipeline:{} was not loaded so far. Triggering load", pipelineName);
-        auto status = factory.createDefinition(pipelineName, info, connections, modelInstanceProvider, nameChecker, resourceMgr, metricRegistry, metricConfig);
+        auto status = factory.createDefinition(pipelineName, info, connections, modelInstanceProvider, nameChecker, resourceMgr, metricRegistry, metricConfig, fuseNodes);
         pipelinesInConfigFile.insert(pipelineName);
         return status;
     }
@@ -235,7 +241,7 @@ static Status processPipelineConfig(
     auto status = factory.reloadDefinition(pipelineName,
         std::move(info),
         std::move(connections),
-        modelInstanceProvider, nameChecker, resourceMgr);
+        modelInstanceProvider, nameChecker, resourceMgr, fuseNodes);
     pipelinesInConfigFile.insert(pipelineName);
     return status;
 }
@@ -56,12 +56,13 @@ Status PipelineFactory::createDefinition(const std::string& pipelineName,
     ServableNameChecker& nameChecker,
     DagResourceManager& resourceMgr,
     MetricRegistry* registry,
-    const MetricConfig* metricConfig) {
+    const MetricConfig* metricConfig,
+    bool fuseNodes) {
     if (definitionExists(pipelineName)) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "pipeline definition: {} is already created", pipelineName);
         return StatusCode::PIPELINE_DEFINITION_ALREADY_EXIST;
     }
-    std::unique_ptr<PipelineDefinition> pipelineDefinition = std::make_unique<PipelineDefinition>(pipelineName, nodeInfos, connections, registry, metricConfig);
+    std::unique_ptr<PipelineDefinition> pipelineDefinition = std::make_unique<PipelineDefinition>(pipelineName, nodeInfos, connections, registry, metricConfig, fuseNodes);
 
     pipelineDefinition->makeSubscriptions(modelInstanceProvider);
     Status validationResult = pipelineDefinition->validate(modelInstanceProvider, nameChecker, resourceMgr);
@@ -86,13 +87,14 @@ Status PipelineFactory::reloadDefinition(const std::string& pipelineName,
     const pipeline_connections_t&& connections,
     ModelInstanceProvider& modelInstanceProvider,
     ServableNameChecker& nameChecker,
-    DagResourceManager& resourceMgr) {
+    DagResourceManager& resourceMgr,
+    bool fuseNodes) {
     auto pd = findDefinitionByName(pipelineName);
     if (pd == nullptr) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Requested to reload pipeline definition but it does not exist: {}", pipelineName);
         return StatusCode::UNKNOWN_ERROR;
     }
-    return pd->reload(modelInstanceProvider, nameChecker, resourceMgr, std::move(nodeInfos), std::move(connections));
+    return pd->reload(modelInstanceProvider, nameChecker, resourceMgr, std::move(nodeInfos), std::move(connections), fuseNodes);
 }
 
 Status PipelineFactory::revalidatePipelines(ModelInstanceProvider& modelInstanceProvider, ServableNameChecker& nameChecker, DagResourceManager& resourceMgr) {
@@ -69,7 +69,8 @@ public:
         ServableNameChecker& nameChecker,
         DagResourceManager& resourceMgr,
         MetricRegistry* registry = nullptr,
-        const MetricConfig* metricConfig = nullptr);
+        const MetricConfig* metricConfig = nullptr,
+        bool fuseNodes = false);
 
     bool definitionExists(const std::string& name) const;
 
@@ -95,7 +96,8 @@ public:
         const pipeline_connections_t&& connections,
         ModelInstanceProvider& modelInstanceProvider,
         ServableNameChecker& nameChecker,
-        DagResourceManager& resourceMgr);
+        DagResourceManager& resourceMgr,
+        bool fuseNodes = false);
 
     void retireOtherThan(std::set<std::string>&& pipelinesInConfigFile, ModelInstanceProvider& modelInstanceProvider);
     /**
@@ -0,0 +1,147 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "pipeline_profile.hpp"
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "src/port/rapidjson_stringbuffer.hpp"
+#include "src/port/rapidjson_writer.hpp"
+#include "../timer.hpp"
+#include "nodesession.hpp"
+
+namespace ovms {
+
+void NodeExecutionProfile::add(NodeSession& session) {
+    auto& timer = session.getTimer();
+    ++sessions;
+    // phases which are not present in node kind, eg. waiting for infer request in custom node, are skipped
+    if (timer.isMeasured(WAIT_FOR_INPUTS)) {
+        waitForInputsUs += timer.elapsed<std::chrono::microseconds>(WAIT_FOR_INPUTS);
+    }
+    if (timer.isMeasured(GET_INFER_REQUEST)) {
+        waitForInferReqUs += timer.elapsed<std::chrono::microseconds>(GET_INFER_REQUEST);
+    }
+    if (timer.isMeasured(EXECUTE)) {
+        executeUs += timer.elapsed<std::chrono::microseconds>(EXECUTE);
+    }
+    if (timer.isMeasured(FETCH_RESULTS)) {
+        fetchResultsUs += timer.elapsed<std::chrono::microseconds>(FETCH_RESULTS);
+    }
+    if (!firstStarted || session.getCreationTime() < firstStarted.value()) {
+        firstStarted = session.getCreationTime();
+    }
+    auto now = std::chrono::steady_clock::now();
+    if (!lastFinished || lastFinished.value() < now) {
+        lastFinished = now;
+    }
+}
+
+double NodeExecutionProfile::getDurationUs() const {
+    if (!firstStarted || !lastFinished) {
+        return 0;
+    }
+    return std::chrono::duration_cast<std::chrono::microseconds>(lastFinished.value() - firstStarted.value()).count();
+}
+
+void PipelineProfiler::record(CriticalPath&& path) {
+    std::lock_guard<std::mutex> lock(mtx);
+    ++executionsCount;
+    if (capacity == 0) {
+        return;
+    }
+    if (recentCriticalPaths.size() == capacity) {
+        recentCriticalPaths.pop_front();
+    }
+    recentCriticalPaths.emplace_back(std::move(path));
+}
+
+void PipelineProfiler::clear() {
+    std::lock_guard<std::mutex> lock(mtx);
+    recentCriticalPaths.clear();
+    executionsCount = 0;
+}
+
+std::vector<CriticalPath> PipelineProfiler::getRecentCriticalPaths() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return std::vector<CriticalPath>(recentCriticalPaths.begin(), recentCriticalPaths.end());
+}
+
+uint64_t PipelineProfiler::getExecutionsCount() const {
+    std::lock_guard<std::mutex> lock(mtx);
+    return executionsCount;
+}
+
+std::string PipelineProfiler::toJson(const std::string& pipelineName) const {
+    auto paths = getRecentCriticalPaths();
+    // how many times each node was on critical path of recent executions
+    std::map<std::string, uint64_t> criticalPathCounts;
+    rapidjson::StringBuffer buffer;
+    rapidjson::Writer<rapidjson::StringBuffer> writer(buffer);
+    writer.StartObject();
+    writer.Key("name");
+    writer.String(pipelineName.c_str());
+    writer.Key("executions");
+    writer.Uint64(getExecutionsCount());
+    writer.Key("critical_paths");
+    writer.StartArray();
+    for (const auto& path : paths) {
+        double totalUs = 0;
+        if (!path.empty() && path.front().profile.firstStarted && path.back().profile.lastFinished) {
+            totalUs = std::chrono::duration_cast<std::chrono::microseconds>(path.back().profile.lastFinished.value() - path.front().profile.firstStarted.value()).count();
+        }
+        writer.StartObject();
+        writer.Key("total_us");
+        writer.Double(totalUs);
+        writer.Key("nodes");
+        writer.StartArray();
+        for (const auto& [nodeName, profile] : path) {
+            ++criticalPathCounts[nodeName];
+            writer.StartObject();
+            writer.Key("node");
+            writer.String(nodeName.c_str());
+            writer.Key("sessions");
+            writer.Uint(profile.sessions);
+            writer.Key("duration_us");
+            writer.Double(profile.getDurationUs());
+            writer.Key("wait_for_inputs_us");
+            writer.Double(profile.waitForInputsUs);
+            writer.Key("wait_for_infer_req_us");
+            writer.Double(profile.waitForInferReqUs);
+            writer.Key("execute_us");
+            writer.Double(profile.executeUs);
+            writer.Key("fetch_results_us");
+            writer.Double(profile.fetchResultsUs);
+            writer.EndObject();
+        }
+        writer.EndArray();
+        writer.EndObject();
+    }
+    writer.EndArray();
+    writer.Key("critical_path_counts");
+    writer.StartObject();
+    for (const auto& [nodeName, count] : criticalPathCounts) {
+        writer.Key(nodeName.c_str());
+        writer.Uint64(count);
+    }
+    writer.EndObject();
+    writer.EndObject();
+    return buffer.GetString();
+}
+
+}  // namespace ovms
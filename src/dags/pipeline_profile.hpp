@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ovms {
+
+class NodeSession;
+
+/**
+ * @brief Time spent by all sessions of a node in single pipeline execution, split into execution phases.
+ */
+struct NodeExecutionProfile {
+    uint32_t sessions = 0;
+    double waitForInputsUs = 0;
+    double waitForInferReqUs = 0;
+    double executeUs = 0;
+    double fetchResultsUs = 0;
+    std::optional<std::chrono::steady_clock::time_point> firstStarted;
+    std::optional<std::chrono::steady_clock::time_point> lastFinished;
+
+    void add(NodeSession& session);
+
+    double getDurationUs() const;
+};
+
+struct CriticalPathNode {
+    std::string nodeName;
+    NodeExecutionProfile profile;
+};
+
+using CriticalPath = std::vector<CriticalPathNode>;
+
+/**
+ * @brief Keeps critical paths of recent executions of a pipeline.
+ *
+ * Critical path leads from entry to exit node through the dependencies which finished last,
+ * so that shortening any node on the path shortens the pipeline execution.
+ */
+class PipelineProfiler {
+    const size_t capacity;
+    mutable std::mutex mtx;
+    std::deque<CriticalPath> recentCriticalPaths;
+    uint64_t executionsCount = 0;
+
+public:
+    static const size_t DEFAULT_CAPACITY = 32;
+
+    PipelineProfiler(size_t capacity = DEFAULT_CAPACITY) :
+        capacity(capacity) {}
+
+    void record(CriticalPath&& path);
+    void clear();
+
+    std::vector<CriticalPath> getRecentCriticalPaths() const;
+    uint64_t getExecutionsCount() const;
+    std::string toJson(const std::string& pipelineName) const;
+};
+
+}  // namespace ovms
@@ -15,22 +15,33 @@
 //*****************************************************************************
 #include "pipelinedefinition.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <map>
+#include <memory>
+#include <numeric>
 #include <set>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "../logging.hpp"
 #include "../model_instance_provider.hpp"
 #include "../model_metric_reporter.hpp"
+#include "../modelconfig.hpp"
+#include "../modelinstance.hpp"
 #include "../ov_utils.hpp"
 #include "../servable_definition_unload_guard.hpp"
 #include "../servable_name_checker.hpp"
 #include "../status.hpp"
+#include "../stringutils.hpp"
 #include "custom_node.hpp"
 #include "custom_node_library_internal_manager_wrapper.hpp"
 #include "dag_resource_manager.hpp"
+#include "node_fusion.hpp"
 #include "node_library_utils.hpp"
 #include "nodeinfo.hpp"
+#include "session_id.hpp"
 
 namespace ovms {
 const std::string PipelineDefinition::SCHEDULER_CLASS_NAME{"Pipeline"};
@@ -39,13 +50,19 @@ PipelineDefinition::PipelineDefinition(const std::string& pipelineName,
     const std::vector<NodeInfo>& nodeInfos,
     const pipeline_connections_t& connections,
     MetricRegistry* registry,
-    const MetricConfig* metricConfig) :
+    const MetricConfig* metricConfig,
+    bool fuseNodes) :
     SingleVersionServableDefinition(pipelineName),
     nodeInfos(nodeInfos),
     connections(connections),
+    fuseNodes(fuseNodes),
     reporter(std::make_unique<ServableMetricReporter>(metricConfig, registry, pipelineName, VERSION)),
+    registry(registry),
+    metricConfig(metricConfig),
     status(SCHEDULER_CLASS_NAME, getName()) {}
 
+PipelineDefinition::~PipelineDefinition() = default;
+
 Status PipelineDefinition::validate(ModelInstanceProvider& modelInstanceProvider, ServableNameChecker& nameChecker, DagResourceManager& resourceMgr) {
     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Started validation of pipeline: {}", getName());
     ValidationResultNotifier notifier(status, loadedNotify);
@@ -79,6 +96,12 @@ Status PipelineDefinition::validate(ModelInstanceProvider& modelInstanceProvider
         return validationResult;
     }
     lock.unlock();
+    createNodeMetricReporters();
+    if (this->fuseNodes) {
+        fuseNodeChains(modelInstanceProvider);
+    } else {
+        setFusedGraph(nullptr);
+    }
     notifier.passed = true;
     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Finished validation of pipeline: {}", getName());
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Pipeline: {} inputs: {}", getName(), getTensorMapString(inputsInfo));
@@ -134,7 +157,7 @@ void PipelineDefinition::deinitializeNodeResources(const std::vector<NodeInfo>&
     }
 }
 
-Status PipelineDefinition::reload(ModelInstanceProvider& modelInstanceProvider, ServableNameChecker& nameChecker, DagResourceManager& resourceMgr, const std::vector<NodeInfo>&& nodeInfos, const pipeline_connections_t&& connections) {
+Status PipelineDefinition::reload(ModelInstanceProvider& modelInstanceProvider, ServableNameChecker& nameChecker, DagResourceManager& resourceMgr, const std::vector<NodeInfo>&& nodeInfos, const pipeline_connections_t&& connections, bool fuseNodes) {
     // block creating new unloadGuards
     this->status.handle(ReloadEvent());
     resetSubscriptions(modelInstanceProvider);
@@ -145,6 +168,7 @@ Status PipelineDefinition::reload(ModelInstanceProvider& modelInstanceProvider,
     deinitializeNodeResources(calculateNodeInfosDiff(nodeInfos));
     this->nodeInfos = std::move(nodeInfos);
     this->connections = std::move(connections);
+    this->fuseNodes = fuseNodes;
     makeSubscriptions(modelInstanceProvider);
 
     return validate(modelInstanceProvider, nameChecker, resourceMgr);
@@ -161,6 +185,138 @@ void PipelineDefinition::retire(ModelInstanceProvider& modelInstanceProvider) {
     this->nodeResources.clear();
     this->nodeInfos.clear();
     this->connections.clear();
+    setFusedGraph(nullptr);
+    this->profiler.clear();
+}
+
+void PipelineDefinition::createNodeMetricReporters() {
+    for (const auto& info : this->nodeInfos) {
+        if (this->nodeMetricReporters.find(info.nodeName) != this->nodeMetricReporters.end()) {
+            continue;
+        }
+        this->nodeMetricReporters.emplace(info.nodeName, std::make_unique<PipelineNodeMetricReporter>(this->metricConfig, this->registry, getName(), info.nodeName));
+    }
+}
+
+static std::shared_ptr<ModelInstance> compileFusedModel(const std::vector<const NodeInfo*>& chain, const std::vector<std::shared_ptr<ModelInstance>>& instances, const pipeline_connections_t& connections, const std::string& fusedModelName, Status& status) {
+    std::shared_ptr<ov::Model> fusedModel;
+    status = fuseNodeModels(chain, instances, connections, fusedModelName, fusedModel);
+    if (!status.ok()) {
+        return nullptr;
+    }
+    // inputs are named as in the first model and outputs as in the last model of the chain
+    const ModelConfig& headConfig = instances.front()->getModelConfig();
+    const ModelConfig& tailConfig = instances.back()->getModelConfig();
+    ModelConfig fusedConfig(fusedModelName);
+    fusedConfig.setLocalPath(headConfig.getLocalPath());
+    fusedConfig.setVersion(headConfig.getVersion());
+    fusedConfig.setTargetDevice(instances.front()->getTargetDevice());
+    fusedConfig.setPluginConfig(headConfig.getPluginConfig());
+    fusedConfig.setNireq(headConfig.getNireq());
+    fusedConfig.setMappingInputs(headConfig.getMappingInputs());
+    fusedConfig.setRealMappingInputs(headConfig.getRealMappingInputs());
+    fusedConfig.setMappingOutputs(tailConfig.getMappingOutputs());
+    fusedConfig.setRealMappingOutputs(tailConfig.getRealMappingOutputs());
+    auto fusedInstance = std::make_shared<FusedModelInstance>(fusedModelName, headConfig.getVersion(), instances.front()->getIeCore(), std::move(fusedModel));
+    status = fusedInstance->loadModel(fusedConfig);
+    if (!status.ok()) {
+        return nullptr;
+    }
+    return fusedInstance;
+}
+
+void PipelineDefinition::fuseNodeChains(ModelInstanceProvider& modelInstanceProvider) {
+    const auto previous = getFusedGraph();
+    // compiled fused model is reused when all models of the chain are the same as during previous validation
+    auto findReusableFusedModel = [&previous](const std::string& fusedModelName, const std::vector<std::weak_ptr<const ov::Model>>& sourceModels) -> std::shared_ptr<ModelInstance> {
+        if (previous == nullptr) {
+            return nullptr;
+        }
+        auto it = previous->sourceModels.find(fusedModelName);
+        if (it == previous->sourceModels.end() || it->second.size() != sourceModels.size()) {
+            return nullptr;
+        }
+        for (size_t i = 0; i < sourceModels.size(); ++i) {
+            auto model = it->second[i].lock();
+            if (model == nullptr || model != sourceModels[i].lock()) {
+                return nullptr;
+            }
+        }
+        return previous->modelInstanceProvider->findFusedInstance(fusedModelName);
+    };
+    auto graph = std::make_shared<FusedGraph>();
+    graph->nodeInfos = this->nodeInfos;
+    graph->connections = this->connections;
+    std::map<std::string, std::shared_ptr<ModelInstance>> fusedInstances;
+    for (auto& chainNames : findFusableNodeChains(this->nodeInfos, this->connections, modelInstanceProvider)) {
+        std::vector<const NodeInfo*> chain;
+        std::vector<std::shared_ptr<ModelInstance>> instances;
+        std::vector<std::weak_ptr<const ov::Model>> sourceModels;
+        for (const auto& nodeName : chainNames) {
+            const NodeInfo& info = findNodeByName(nodeName);
+            chain.push_back(&info);
+            instances.push_back(modelInstanceProvider.findModelInstance(info.modelName, info.modelVersion.value_or(0)));
+            sourceModels.emplace_back(instances.back()->getOVModel());
+        }
+        const NodeInfo& head = *chain.front();
+        const NodeInfo& tail = *chain.back();
+        const std::string fusedModelName = getName() + "/" + joins(chainNames, "+");
+        auto fusedInstance = findReusableFusedModel(fusedModelName, sourceModels);
+        if (fusedInstance != nullptr) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Pipeline: {} reuses fused model of nodes: {} since their models did not change", getName(), joins(chainNames, ", "));
+        } else {
+            Status status;
+            fusedInstance = compileFusedModel(chain, instances, this->connections, fusedModelName, status);
+            if (fusedInstance == nullptr) {
+                SPDLOG_LOGGER_WARN(modelmanager_logger, "Pipeline: {} failed to compile fused model of nodes: {}; nodes will be executed separately: {}", getName(), joins(chainNames, ", "), status.string());
+                continue;
+            }
+            SPDLOG_LOGGER_INFO(modelmanager_logger, "Pipeline: {} fused nodes: {} into one model compiled for device: {}", getName(), joins(chainNames, " -> "), fusedInstance->getTargetDevice());
+        }
+        // chain is replaced with single node which keeps name of the last node, so that its dependants remain connected
+        graph->connections[tail.nodeName] = this->connections.at(head.nodeName);
+        for (size_t i = 0; i + 1 < chainNames.size(); ++i) {
+            graph->connections.erase(chainNames[i]);
+        }
+        auto& fusedNodeInfos = graph->nodeInfos;
+        auto tailIt = std::find_if(fusedNodeInfos.begin(), fusedNodeInfos.end(), [&tail](const NodeInfo& info) { return info.nodeName == tail.nodeName; });
+        tailIt->modelName = fusedModelName;
+        tailIt->modelVersion = fusedInstance->getVersion();
+        tailIt->gatherFromNode = head.gatherFromNode;
+        fusedNodeInfos.erase(std::remove_if(fusedNodeInfos.begin(), fusedNodeInfos.end(), [&chainNames](const NodeInfo& info) {
+            return std::find(chainNames.begin(), chainNames.end() - 1, info.nodeName) != chainNames.end() - 1;
+        }),
+            fusedNodeInfos.end());
+        fusedInstances.emplace(fusedModelName, std::move(fusedInstance));
+        graph->sourceModels.emplace(fusedModelName, std::move(sourceModels));
+        graph->fusedNodes.emplace_back(std::move(chainNames));
+    }
+    if (graph->fusedNodes.empty()) {
+        SPDLOG_LOGGER_INFO(modelmanager_logger, "Pipeline: {} has no nodes which could be fused", getName());
+        setFusedGraph(nullptr);
+        return;
+    }
+    graph->modelInstanceProvider = std::make_shared<FusedModelInstanceProvider>();
+    graph->modelInstanceProvider->reset(modelInstanceProvider, std::move(fusedInstances));
+    setFusedGraph(std::move(graph));
+}
+
+std::shared_ptr<const PipelineDefinition::FusedGraph> PipelineDefinition::getFusedGraph() const {
+    std::unique_lock lock(fusedGraphMtx);
+    return this->fusedGraph;
+}
+
+void PipelineDefinition::setFusedGraph(std::shared_ptr<const FusedGraph> graph) {
+    std::unique_lock lock(fusedGraphMtx);
+    this->fusedGraph = std::move(graph);
+}
+
+std::vector<std::vector<std::string>> PipelineDefinition::getFusedNodes() const {
+    auto graph = getFusedGraph();
+    if (graph == nullptr) {
+        return {};
+    }
+    return graph->fusedNodes;
 }
 
 StatusCode PipelineDefinition::notLoadedYetCode() const {
@@ -847,6 +1003,12 @@ Status PipelineDefinition::validateDemultiplexerGatherNodesOrder() {
             if (!connectedNodeInfo.gatherFromNode.empty()) {
                 newDemultiplyStack.emplace_back(connectedNodeInfo.gatherFromNode);
             }
+            const size_t demultiplyLevels = std::accumulate(newDemultiplyStack.begin(), newDemultiplyStack.end(), size_t{0},
+                [](size_t levels, const gatherFromNode_t& gatherFrom) { return levels + gatherFrom.size(); });
+            if (demultiplyLevels > SessionKey::MAX_DEPTH) {
+                SPDLOG_LOGGER_ERROR(modelmanager_logger, "In pipeline: {} node: {} is executed in {} nested demultiplexing levels, maximum is: {}", getName(), connectedNodeName, demultiplyLevels, SessionKey::MAX_DEPTH);
+                return StatusCode::PIPELINE_TOO_MANY_DEMULTIPLEXING_LEVELS;
+            }
             if (connectedNodeInfo.kind == NodeKind::ENTRY && !newDemultiplyStack.empty()) {
                 SPDLOG_LOGGER_ERROR(modelmanager_logger, "In pipeline: {} exists path that gathers from nodes that are not in path: {}. Consider changing inputs of the node that gathers from mentioned demultiplexer nodes",
                     getName(),
@@ -17,6 +17,7 @@
 
 #include <map>
 #include <memory>
+#include <mutex>
 #include <set>
 #include <shared_mutex>
 #include <string>
@@ -31,15 +32,22 @@
 #include "../tensorinfo.hpp"
 #include "aliases.hpp"
 #include "nodeinfo.hpp"
+#include "pipeline_profile.hpp"
 #include "pipelinedefinitionstatus.hpp"
 
+namespace ov {
+class Model;
+}
+
 namespace ovms {
 struct CNLIMWrapper;
 class DagResourceManager;
+class FusedModelInstanceProvider;
 class MetricConfig;
 class MetricRegistry;
 class ModelInstanceProvider;
 class NodeValidator;
+class PipelineNodeMetricReporter;
 class ServableNameChecker;
 class Pipeline;
 class Status;
@@ -69,6 +77,20 @@ class PipelineDefinition : public SingleVersionServableDefinition, public Notify
     std::map<std::string, std::shared_ptr<CNLIMWrapper>> nodeResources = {};
     pipeline_connections_t connections;
 
+    // graph with chains of DL nodes replaced by single nodes of fused models, used when fuse_nodes is enabled
+    struct FusedGraph {
+        std::vector<NodeInfo> nodeInfos;
+        pipeline_connections_t connections;
+        std::vector<std::vector<std::string>> fusedNodes;
+        std::shared_ptr<FusedModelInstanceProvider> modelInstanceProvider;
+        // models of fused nodes, compiled fused model is reused by next validation while they are not reloaded
+        std::map<std::string, std::vector<std::weak_ptr<const ov::Model>>> sourceModels;
+    };
+    bool fuseNodes;
+    // graph is replaced as a whole since validation after model reload runs concurrently with create()
+    std::shared_ptr<const FusedGraph> fusedGraph;
+    mutable std::mutex fusedGraphMtx;
+
 protected:
     tensor_map_t inputsInfo;
     tensor_map_t outputsInfo;
@@ -77,6 +99,11 @@ private:
     mutable std::shared_mutex metadataMtx;
 
     std::unique_ptr<ServableMetricReporter> reporter;
+    MetricRegistry* registry;
+    const MetricConfig* metricConfig;
+    // reporters are kept for nodes removed by reload since pipelines created earlier may still use them
+    std::unordered_map<std::string, std::unique_ptr<PipelineNodeMetricReporter>> nodeMetricReporters;
+    PipelineProfiler profiler;
 
 protected:
     PipelineDefinitionStatus status;
@@ -94,7 +121,9 @@ public:
         const std::vector<NodeInfo>& nodeInfos,
         const pipeline_connections_t& connections,
         MetricRegistry* registry = nullptr,
-        const MetricConfig* metricConfig = nullptr);
+        const MetricConfig* metricConfig = nullptr,
+        bool fuseNodes = false);
+    ~PipelineDefinition();
     template <typename RequestType, typename ResponseType>
     Status create(std::unique_ptr<Pipeline>& pipeline,
         const RequestType* request,
@@ -102,12 +131,16 @@ public:
         ModelInstanceProvider& modelInstanceProvider);
 
 public:
-    Status reload(ModelInstanceProvider& modelInstanceProvider, ServableNameChecker& nameChecker, DagResourceManager& resourceMgr, const std::vector<NodeInfo>&& nodeInfos, const pipeline_connections_t&& connections);
+    Status reload(ModelInstanceProvider& modelInstanceProvider, ServableNameChecker& nameChecker, DagResourceManager& resourceMgr, const std::vector<NodeInfo>&& nodeInfos, const pipeline_connections_t&& connections, bool fuseNodes = false);
     void retire(ModelInstanceProvider& modelInstanceProvider);
     Status validate(ModelInstanceProvider& modelInstanceProvider, ServableNameChecker& nameChecker, DagResourceManager& resourceMgr);
     Status validateNodes(ModelInstanceProvider& modelInstanceProvider);
     Status validateForCycles();
     Status validateDemultiplexerGatherNodesOrder();
+    void fuseNodeChains(ModelInstanceProvider& modelInstanceProvider);
+    std::shared_ptr<const FusedGraph> getFusedGraph() const;
+    void setFusedGraph(std::shared_ptr<const FusedGraph> graph);
+    void createNodeMetricReporters();
     Status initializeNodeResources(DagResourceManager& resourceMgr);
     std::vector<NodeInfo> calculateNodeInfosDiff(const std::vector<NodeInfo>& nodeInfos);
     void deinitializeNodeResources(const std::vector<NodeInfo>& nodeInfosDiff);
@@ -128,10 +161,14 @@ public:
         return this->nodeInfos;
     }
 
+    bool isNodeFusionEnabled() const { return fuseNodes; }
+    std::vector<std::vector<std::string>> getFusedNodes() const;
+
     void makeSubscriptions(ModelInstanceProvider& modelInstanceProvider);
     void resetSubscriptions(ModelInstanceProvider& modelInstanceProvider);
 
     ServableMetricReporter& getMetricReporter() const override { return *this->reporter; }
+    const PipelineProfiler& getProfiler() const { return this->profiler; }
 
 protected:
     Status updateInputsInfo(const ModelInstanceProvider& modelInstanceProvider);
@@ -27,6 +27,7 @@
 #include "src/servable_definition_unload_guard.hpp"
 #include "custom_node.hpp"
 #include "dl_node.hpp"
+#include "node_fusion.hpp"
 #include "nodestreamidguard.hpp"
 #include "pipeline.hpp"
 
@@ -50,7 +51,12 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
     EntryNode<RequestType>* entry = nullptr;
     ExitNode<ResponseType>* exit = nullptr;
 
-    for (const auto& info : nodeInfos) {
+    const auto fusedGraph = getFusedGraph();
+    const bool useFusedNodes = fusedGraph != nullptr;
+    const auto& pipelineNodeInfos = useFusedNodes ? fusedGraph->nodeInfos : this->nodeInfos;
+    const auto& pipelineConnections = useFusedNodes ? fusedGraph->connections : this->connections;
+    ModelInstanceProvider& nodesModelInstanceProvider = useFusedNodes ? *fusedGraph->modelInstanceProvider : modelInstanceProvider;
+    for (const auto& info : pipelineNodeInfos) {
         SPDLOG_LOGGER_DEBUG(dag_executor_logger, "Creating pipeline: {}. Adding nodeName: {}, modelName: {}",
             getName(), info.nodeName, info.modelName);
         switch (info.kind) {
@@ -65,7 +71,7 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
                                              info.nodeName,
                                              info.modelName,
                                              info.modelVersion,
-                                             modelInstanceProvider,
+                                             nodesModelInstanceProvider,
                                              info.outputNameAliases,
                                              info.demultiplyCount,
                                              info.gatherFromNode));
@@ -91,7 +97,7 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
             throw std::invalid_argument("unknown node kind");
         }
     }
-    for (const auto& kv : connections) {
+    for (const auto& kv : pipelineConnections) {
         const auto& dependantNode = nodes.at(kv.first);
         for (const auto& pair : kv.second) {
             const auto& dependencyNode = nodes.at(pair.first);
@@ -103,7 +109,16 @@ Status PipelineDefinition::create(std::unique_ptr<Pipeline>& pipeline,
 #pragma warning(disable : 6011)
     pipeline = std::make_unique<Pipeline>(*entry, *exit, *this->reporter, getName());
 #pragma warning(pop)
+    pipeline->setProfiler(&this->profiler);
+    if (useFusedNodes) {
+        // nodes refer to provider of fused models which may be replaced by revalidation while pipeline executes
+        pipeline->setModelInstanceProvider(fusedGraph->modelInstanceProvider);
+    }
     for (auto& kv : nodes) {
+        auto reporterIt = this->nodeMetricReporters.find(kv.first);
+        if (reporterIt != this->nodeMetricReporters.end()) {
+            kv.second->setMetricReporter(reporterIt->second.get());
+        }
         pipeline->push(std::move(kv.second));
     }
     return status;
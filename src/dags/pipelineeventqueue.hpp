@@ -15,9 +15,14 @@
 //*****************************************************************************
 #pragma once
 
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <queue>
 #include <utility>
 
-#include "../threadsafequeue.hpp"
 #include "session_id.hpp"
 
 namespace ovms {
@@ -25,5 +30,71 @@ namespace ovms {
 class Node;
 
 using NodeSessionKeyPair = std::pair<std::reference_wrapper<Node>, session_key_t>;
-using PipelineEventQueue = ThreadSafeQueue<NodeSessionKeyPair>;
+
+/**
+ * @brief Events waking up pipeline execution
+ *
+ * Carries finished node sessions and notifications that infer request became available
+ * for node session with deferred execution. Stream ready notifications are coalesced and
+ * delivered after all pending finished node sessions.
+ * Has to be owned by shared_ptr since stream ready callbacks can outlive pipeline execution.
+ */
+class PipelineEventQueue : public std::enable_shared_from_this<PipelineEventQueue> {
+public:
+    void push(const NodeSessionKeyPair& finishedNodeSession) {
+        std::unique_lock<std::mutex> lock(mtx);
+        finishedNodeSessions.push(finishedNodeSession);
+        lock.unlock();
+        signal.notify_one();
+    }
+
+    void notifyStreamReady() {
+        std::unique_lock<std::mutex> lock(mtx);
+        streamReady = true;
+        lock.unlock();
+        signal.notify_one();
+    }
+
+    /**
+     * @brief Creates callback notifying the queue that deferred node session can acquire infer request
+     */
+    std::function<void()> createStreamReadyCallback() {
+        return [weakQueue = weak_from_this()]() {
+            if (auto queue = weakQueue.lock()) {
+                queue->notifyStreamReady();
+            }
+        };
+    }
+
+    /**
+     * @brief Blocks until node session finished or infer request became available
+     *
+     * @return finished node session, std::nullopt if deferred node sessions should be retried
+     */
+    std::optional<NodeSessionKeyPair> pull() {
+        std::unique_lock<std::mutex> lock(mtx);
+        signal.wait(lock, [this]() { return !finishedNodeSessions.empty() || streamReady; });
+        if (finishedNodeSessions.empty()) {
+            streamReady = false;
+            return std::nullopt;
+        }
+        NodeSessionKeyPair finishedNodeSession = finishedNodeSessions.front();
+        finishedNodeSessions.pop();
+        return finishedNodeSession;
+    }
+
+    /**
+     * @brief Number of finished node sessions not pulled yet
+     */
+    size_t size() {
+        std::unique_lock<std::mutex> lock(mtx);
+        return finishedNodeSessions.size();
+    }
+
+private:
+    std::mutex mtx;
+    std::condition_variable signal;
+    std::queue<NodeSessionKeyPair> finishedNodeSessions;
+    bool streamReady = false;
+};
 }  // namespace ovms
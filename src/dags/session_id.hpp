@@ -15,11 +15,124 @@
 //*****************************************************************************
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
 #include <string>
 
+#include <fmt/format.h>
+
 namespace ovms {
 
 using session_id_t = uint32_t;
-using session_key_t = std::string;
+
+/**
+ * @brief Identifies node session within single pipeline execution
+ *
+ * Holds subsession ids of consecutive demultiplexing levels, outermost level first.
+ * All sessions of a node share the same demultiplexing levels, so level names are
+ * not part of the key. Collapsing innermost levels is a prefix of the key.
+ * Ids are stored inline, up to MAX_DEPTH levels which is enforced by pipeline validation,
+ * so key is copied without allocation. Hash is computed once at construction.
+ */
+class SessionKey {
+public:
+    static constexpr size_t MAX_DEPTH = 8;
+
+    SessionKey() = default;
+    SessionKey(std::initializer_list<session_id_t> levelIds) {
+        if (levelIds.size() > MAX_DEPTH) {
+            throw std::logic_error("Too many demultiplexing levels in session key");
+        }
+        std::copy(levelIds.begin(), levelIds.end(), ids.begin());
+        length = static_cast<uint8_t>(levelIds.size());
+        hashValue = computeHash();
+    }
+
+    size_t size() const { return length; }
+    bool empty() const { return length == 0; }
+    size_t hash() const { return hashValue; }
+    session_id_t operator[](size_t level) const { return ids[level]; }
+
+    /**
+     * @brief Key of subsession on next demultiplexing level
+     */
+    SessionKey withSubsession(session_id_t id) const {
+        if (length == MAX_DEPTH) {
+            throw std::logic_error("Too many demultiplexing levels in session key");
+        }
+        SessionKey result(*this);
+        result.ids[result.length++] = id;
+        result.hashValue = result.computeHash();
+        return result;
+    }
+
+    /**
+     * @brief Key with innermost levels collapsed, keeping outermost levelsCount levels
+     */
+    SessionKey prefix(size_t levelsCount) const {
+        if (levelsCount > length) {
+            throw std::logic_error("Cannot collapse more levels than session key has");
+        }
+        SessionKey result;
+        std::copy(ids.begin(), ids.begin() + levelsCount, result.ids.begin());
+        result.length = static_cast<uint8_t>(levelsCount);
+        result.hashValue = result.computeHash();
+        return result;
+    }
+
+    bool operator==(const SessionKey& rhs) const {
+        return hashValue == rhs.hashValue && length == rhs.length && std::equal(ids.begin(), ids.begin() + length, rhs.ids.begin());
+    }
+    bool operator!=(const SessionKey& rhs) const { return !(*this == rhs); }
+
+    /**
+     * @brief Subsession ids joined with "_", intended for logging only
+     */
+    std::string toString() const {
+        std::string result;
+        for (size_t i = 0; i < length; ++i) {
+            if (i > 0) {
+                result += "_";
+            }
+            result += std::to_string(ids[i]);
+        }
+        return result;
+    }
+
+private:
+    size_t computeHash() const {
+        size_t seed = length;
+        for (size_t i = 0; i < length; ++i) {
+            seed ^= std::hash<session_id_t>{}(ids[i]) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+        return seed;
+    }
+
+    std::array<session_id_t, MAX_DEPTH> ids{};
+    uint8_t length = 0;
+    size_t hashValue = 0;
+};
+
+using session_key_t = SessionKey;
 }  // namespace ovms
+
+namespace std {
+template <>
+struct hash<ovms::SessionKey> {
+    size_t operator()(const ovms::SessionKey& key) const { return key.hash(); }
+};
+}  // namespace std
+
+namespace fmt {
+template <>
+struct formatter<ovms::SessionKey> : formatter<std::string> {
+    auto format(const ovms::SessionKey& key, format_context& ctx) const -> decltype(ctx.out()) {
+        return formatter<std::string>::format(key.toString(), ctx);
+    }
+};
+}  // namespace fmt
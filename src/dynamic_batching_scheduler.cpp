@@ -0,0 +1,524 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "dynamic_batching_scheduler.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <exception>
+#include <sstream>
+#include <string>
+#include <utility>
+
+#include <openvino/runtime/infer_request.hpp>
+
+#include "executingstreamidguard.hpp"
+#include "model_metric_reporter.hpp"
+#include "modelinstance.hpp"
+#include "profiler.hpp"
+#include "timer.hpp"
+
+namespace ovms {
+
+DynamicBatchingScheduler::DynamicBatchingScheduler(ModelInstance& instance, size_t maxBatchSize, uint32_t maxQueueDelayUs) :
+    instance(instance),
+    batchIndex(instance.getBatchSizeIndex()),
+    maxBatchSize(maxBatchSize),
+    maxQueueDelay(maxQueueDelayUs) {
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Dynamic batching enabled for model: {}; version: {}; max batch size: {}; max queue delay: {} us",
+        instance.getName(), instance.getVersion(), maxBatchSize, maxQueueDelayUs);
+}
+
+DynamicBatchingScheduler::~DynamicBatchingScheduler() {
+    std::unique_lock<std::mutex> lock(mtx);
+    stopped = true;
+    cv.notify_all();
+    lock.unlock();
+    for (auto& thread : asyncLeaders) {
+        thread.join();
+    }
+    lock.lock();
+    std::vector<PendingRequest*> abandoned;
+    for (auto* request : pending) {
+        if (request->onFinished) {
+            abandoned.push_back(request);
+        }
+    }
+    pending.clear();
+    finishBatch(abandoned, StatusCode::MODEL_VERSION_NOT_LOADED_ANYMORE, lock);
+}
+
+Status DynamicBatchingScheduler::concatenate(const std::vector<ov::Tensor>& parts, size_t batchIndex, ov::Tensor& result) {
+    OVMS_PROFILE_FUNCTION();
+    if (parts.empty()) {
+        return StatusCode::INTERNAL_ERROR;
+    }
+    const auto& first = parts.front();
+    auto shape = first.get_shape();
+    if (batchIndex >= shape.size()) {
+        return StatusCode::INVALID_BATCH_DIMENSION;
+    }
+    size_t outerCount = 1;
+    for (size_t i = 0; i < batchIndex; ++i) {
+        outerCount *= shape[i];
+    }
+    size_t totalBatch = 0;
+    for (const auto& part : parts) {
+        const auto& partShape = part.get_shape();
+        if (part.get_element_type() != first.get_element_type() || partShape.size() != shape.size()) {
+            return StatusCode::INVALID_SHAPE;
+        }
+        for (size_t i = 0; i < shape.size(); ++i) {
+            if (i != batchIndex && partShape[i] != shape[i]) {
+                return StatusCode::INVALID_SHAPE;
+            }
+        }
+        totalBatch += partShape[batchIndex];
+    }
+    shape[batchIndex] = totalBatch;
+    result = ov::Tensor(first.get_element_type(), shape);
+    char* destination = static_cast<char*>(result.data());
+    for (size_t outer = 0; outer < outerCount; ++outer) {
+        for (const auto& part : parts) {
+            const size_t chunk = part.get_byte_size() / outerCount;
+            std::memcpy(destination, static_cast<const char*>(part.data()) + outer * chunk, chunk);
+            destination += chunk;
+        }
+    }
+    return StatusCode::OK;
+}
+
+Status DynamicBatchingScheduler::split(const ov::Tensor& batched, size_t batchIndex, const std::vector<size_t>& batchSizes, std::vector<ov::Tensor>& parts) {
+    OVMS_PROFILE_FUNCTION();
+    const auto& shape = batched.get_shape();
+    if (batchIndex >= shape.size()) {
+        return StatusCode::INVALID_BATCH_DIMENSION;
+    }
+    size_t totalBatch = 0;
+    for (auto batchSize : batchSizes) {
+        totalBatch += batchSize;
+    }
+    if (totalBatch != shape[batchIndex]) {
+        SPDLOG_DEBUG("Cannot split batched output with batch: {} into parts with total batch: {}", shape[batchIndex], totalBatch);
+        return StatusCode::INVALID_BATCH_SIZE;
+    }
+    size_t outerCount = 1;
+    for (size_t i = 0; i < batchIndex; ++i) {
+        outerCount *= shape[i];
+    }
+    const size_t bytesPerBatchElement = (totalBatch == 0) ? 0 : batched.get_byte_size() / outerCount / totalBatch;
+    parts.clear();
+    parts.reserve(batchSizes.size());
+    for (auto batchSize : batchSizes) {
+        auto partShape = shape;
+        partShape[batchIndex] = batchSize;
+        parts.emplace_back(batched.get_element_type(), partShape);
+    }
+    const char* source = static_cast<const char*>(batched.data());
+    for (size_t outer = 0; outer < outerCount; ++outer) {
+        for (size_t i = 0; i < parts.size(); ++i) {
+            const size_t chunk = batchSizes[i] * bytesPerBatchElement;
+            std::memcpy(static_cast<char*>(parts[i].data()) + outer * chunk, source, chunk);
+            source += chunk;
+        }
+    }
+    return StatusCode::OK;
+}
+
+bool DynamicBatchingScheduler::isBatchable(const TensorMap& inputs) const {
+    // requests with preallocated outputs or string inputs have to be executed on the regular path
+    if (inputs.empty()) {
+        return false;
+    }
+    if (inputs.size() != instance.getInputsInfo().size()) {
+        return false;
+    }
+    for (const auto& [name, tensor] : inputs) {
+        if (tensor.get_element_type() == ov::element::string) {
+            return false;
+        }
+        if (tensor.get_shape().size() <= batchIndex) {
+            return false;
+        }
+    }
+    return true;
+}
+
+namespace {
+// infer request active metric is reported once per batch, since whole batch holds single infer request
+class ActiveInferRequestMetricGuard {
+    ModelMetricReporter& reporter;
+
+public:
+    ActiveInferRequestMetricGuard(ModelMetricReporter& reporter) :
+        reporter(reporter) {
+        INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    }
+    ~ActiveInferRequestMetricGuard() {
+        DECREMENT_IF_ENABLED(this->reporter.inferReqActive);
+    }
+};
+}  // namespace
+
+DynamicBatchingScheduler::PendingRequest::PendingRequest(ModelMetricReporter& reporter, const TensorMap& inputs, TensorMap& outputs, size_t batchSize, bool standalone, const std::optional<std::chrono::steady_clock::time_point>& deadline, std::function<void(Status)> onFinished) :
+    reporter(reporter),
+    inputs(inputs),
+    outputs(outputs),
+    batchSize(batchSize),
+    standalone(standalone),
+    enqueueTime(std::chrono::steady_clock::now()),
+    deadline(deadline),
+    onFinished(std::move(onFinished)) {
+    INCREMENT_IF_ENABLED(this->reporter.currentRequests);
+}
+
+DynamicBatchingScheduler::PendingRequest::~PendingRequest() {
+    DECREMENT_IF_ENABLED(this->reporter.currentRequests);
+}
+
+Status DynamicBatchingScheduler::admitLocked(const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+    // single infer request serves up to maxBatchSize requests waiting for batch
+    auto& queue = instance.getInferRequestsQueue();
+    auto status = instance.admitRequest(pending.size() + queue.getWaitersCount(), queue.getStreamsCount() * maxBatchSize);
+    if (!status.ok()) {
+        return status;
+    }
+    return instance.checkDeadline(deadline);
+}
+
+Status DynamicBatchingScheduler::validateBatchSize(const TensorMap& inputs) const {
+    const size_t requestBatchSize = inputs.begin()->second.get_shape()[batchIndex];
+    for (const auto& [name, tensor] : inputs) {
+        const size_t inputBatchSize = tensor.get_shape()[batchIndex];
+        if (inputBatchSize != requestBatchSize || inputBatchSize > maxBatchSize) {
+            std::stringstream ss;
+            ss << "Input: " << name << " Invalid batch size - Expected: " << requestBatchSize << " not greater than max_batch_size: " << maxBatchSize << "; Actual: " << inputBatchSize;
+            const std::string details = ss.str();
+            SPDLOG_DEBUG("Request to model: {}; version: {} cannot be batched: {}", instance.getName(), instance.getVersion(), details);
+            return Status(StatusCode::INVALID_BATCH_SIZE, details);
+        }
+    }
+    return StatusCode::OK;
+}
+
+bool DynamicBatchingScheduler::isCompatible(const PendingRequest& anchor, const PendingRequest& other) const {
+    if (anchor.standalone || other.standalone) {
+        return false;
+    }
+    if (anchor.inputs.size() != other.inputs.size()) {
+        return false;
+    }
+    for (const auto& [name, tensor] : anchor.inputs) {
+        auto it = other.inputs.find(name);
+        if (it == other.inputs.end()) {
+            return false;
+        }
+        if (it->second.get_element_type() != tensor.get_element_type()) {
+            return false;
+        }
+        const auto& lhs = tensor.get_shape();
+        const auto& rhs = it->second.get_shape();
+        if (lhs.size() != rhs.size()) {
+            return false;
+        }
+        for (size_t i = 0; i < lhs.size(); ++i) {
+            if (i != batchIndex && lhs[i] != rhs[i]) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+size_t DynamicBatchingScheduler::getCollectableBatchSize(const PendingRequest& anchor) const {
+    if (anchor.standalone) {
+        return maxBatchSize;
+    }
+    size_t batchSize = 0;
+    for (const auto* request : pending) {
+        if (request == &anchor || isCompatible(anchor, *request)) {
+            if (batchSize + request->batchSize > maxBatchSize) {
+                // next compatible request does not fit, batch cannot grow anymore
+                return maxBatchSize;
+            }
+            batchSize += request->batchSize;
+        }
+    }
+    return batchSize;
+}
+
+std::vector<DynamicBatchingScheduler::PendingRequest*> DynamicBatchingScheduler::collectBatch(PendingRequest& anchor) {
+    std::vector<PendingRequest*> batch;
+    size_t batchSize = 0;
+    for (auto it = pending.begin(); it != pending.end();) {
+        auto* request = *it;
+        if (request == &anchor || isCompatible(anchor, *request)) {
+            if (request != &anchor && batchSize + request->batchSize > maxBatchSize) {
+                break;
+            }
+            batchSize += request->batchSize;
+            batch.push_back(request);
+            it = pending.erase(it);
+            continue;
+        }
+        ++it;
+    }
+    return batch;
+}
+
+Status DynamicBatchingScheduler::infer(const TensorMap& inputs, TensorMap& outputs, const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+    OVMS_PROFILE_FUNCTION();
+    if (!isBatchable(inputs)) {
+        SPDLOG_DEBUG("Request to model: {}; version: {} cannot be processed by dynamic batching scheduler", instance.getName(), instance.getVersion());
+        return StatusCode::INTERNAL_ERROR;
+    }
+    const bool standalone = !validateBatchSize(inputs).ok();
+    const size_t requestBatchSize = inputs.begin()->second.get_shape()[batchIndex];
+    PendingRequest request(instance.getMetricReporter(), inputs, outputs, requestBatchSize, standalone, deadline);
+    std::unique_lock<std::mutex> lock(mtx);
+    auto status = admitLocked(deadline);
+    if (!status.ok()) {
+        return status;
+    }
+    if (standalone || requestBatchSize >= maxBatchSize || maxQueueDelay.count() == 0) {
+        lock.unlock();
+        std::vector<PendingRequest*> batch{&request};
+        status = executeBatch(batch);
+        return request.status.ok() ? status : request.status;
+    }
+    pending.push_back(&request);
+    cv.notify_all();
+    while (!request.done) {
+        if (!leaderPresent && !pending.empty() && pending.front() == &request) {
+            leaderPresent = true;
+            cv.wait_until(lock, request.enqueueTime + maxQueueDelay, [this, &request]() {
+                return getCollectableBatchSize(request) >= maxBatchSize;
+            });
+            auto batch = collectBatch(request);
+            leaderPresent = false;
+            cv.notify_all();
+            lock.unlock();
+            status = executeBatch(batch);
+            lock.lock();
+            finishBatch(batch, status, lock);
+            break;
+        }
+        cv.wait(lock);
+    }
+    return request.status;
+}
+
+void DynamicBatchingScheduler::inferAsync(const TensorMap& inputs, TensorMap& outputs, std::function<void(Status)> onFinished, const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+    OVMS_PROFILE_FUNCTION();
+    if (!isBatchable(inputs)) {
+        SPDLOG_DEBUG("Request to model: {}; version: {} cannot be processed by dynamic batching scheduler", instance.getName(), instance.getVersion());
+        onFinished(StatusCode::INTERNAL_ERROR);
+        return;
+    }
+    const bool standalone = !validateBatchSize(inputs).ok();
+    const size_t requestBatchSize = inputs.begin()->second.get_shape()[batchIndex];
+    std::unique_lock<std::mutex> lock(mtx);
+    if (stopped) {
+        lock.unlock();
+        onFinished(StatusCode::MODEL_VERSION_NOT_LOADED_ANYMORE);
+        return;
+    }
+    auto status = admitLocked(deadline);
+    if (!status.ok()) {
+        lock.unlock();
+        onFinished(status);
+        return;
+    }
+    if (asyncLeaders.empty()) {
+        const uint32_t leadersCount = std::max<uint32_t>(instance.getNumOfStreams(), 1);
+        SPDLOG_DEBUG("Starting: {} dynamic batching threads for model: {}; version: {}", leadersCount, instance.getName(), instance.getVersion());
+        for (uint32_t i = 0; i < leadersCount; ++i) {
+            asyncLeaders.emplace_back([this]() { leadAsyncBatches(); });
+        }
+    }
+    pending.push_back(new PendingRequest(instance.getMetricReporter(), inputs, outputs, requestBatchSize, standalone, deadline, std::move(onFinished)));
+    cv.notify_all();
+}
+
+void DynamicBatchingScheduler::leadAsyncBatches() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        // batches starting with request of waiting caller are led by that caller
+        cv.wait(lock, [this]() {
+            return stopped || (!leaderPresent && !pending.empty() && pending.front()->onFinished);
+        });
+        if (stopped) {
+            return;
+        }
+        PendingRequest& anchor = *pending.front();
+        leaderPresent = true;
+        cv.wait_until(lock, anchor.enqueueTime + maxQueueDelay, [this, &anchor]() {
+            return stopped || getCollectableBatchSize(anchor) >= maxBatchSize;
+        });
+        if (stopped) {
+            // remaining requests are failed by destructor
+            leaderPresent = false;
+            return;
+        }
+        auto batch = collectBatch(anchor);
+        leaderPresent = false;
+        cv.notify_all();
+        lock.unlock();
+        auto status = executeBatch(batch);
+        lock.lock();
+        finishBatch(batch, status, lock);
+    }
+}
+
+void DynamicBatchingScheduler::finishBatch(std::vector<PendingRequest*>& batch, const Status& status, std::unique_lock<std::mutex>& lock) {
+    std::vector<PendingRequest*> asyncMembers;
+    for (auto* member : batch) {
+        if (member->status.ok()) {
+            member->status = status;
+        }
+        if (member->onFinished) {
+            asyncMembers.push_back(member);
+        } else {
+            member->done = true;
+        }
+    }
+    cv.notify_all();
+    if (asyncMembers.empty()) {
+        return;
+    }
+    lock.unlock();
+    for (auto* member : asyncMembers) {
+        member->onFinished(member->status);
+        delete member;
+    }
+    lock.lock();
+}
+
+Status DynamicBatchingScheduler::executeBatch(std::vector<PendingRequest*>& batch) {
+    OVMS_PROFILE_FUNCTION();
+    enum : unsigned int {
+        GET_INFER_REQUEST,
+        PREDICTION,
+        TIMER_END
+    };
+    Timer<TIMER_END> timer;
+    // wait for infer request is bounded by the latest deadline, so that no member is dropped prematurely
+    std::optional<std::chrono::steady_clock::time_point> latestDeadline;
+    for (const auto* member : batch) {
+        if (!member->deadline.has_value()) {
+            latestDeadline.reset();
+            break;
+        }
+        latestDeadline = std::max(latestDeadline.value_or(member->deadline.value()), member->deadline.value());
+    }
+    timer.start(GET_INFER_REQUEST);
+    int streamId;
+    auto& inferRequestsQueue = instance.getInferRequestsQueue();
+    auto status = instance.acquireAdmittedInferRequestStream(inferRequestsQueue, latestDeadline, streamId);
+    if (!status.ok()) {
+        return status;
+    }
+    StreamIdGuard streamIdGuard(inferRequestsQueue, streamId);
+    ActiveInferRequestMetricGuard activeInferRequestMetricGuard(instance.getMetricReporter());
+    ov::InferRequest& inferRequest = streamIdGuard.getInferRequest();
+    timer.stop(GET_INFER_REQUEST);
+    const auto streamAcquired = std::chrono::steady_clock::now();
+    // members which deadline passed while waiting for batch or infer request are not executed
+    std::vector<PendingRequest*> executed;
+    executed.reserve(batch.size());
+    for (auto* member : batch) {
+        member->status = instance.checkDeadline(member->deadline);
+        if (!member->status.ok()) {
+            continue;
+        }
+        OBSERVE_IF_ENABLED(instance.getMetricReporter().waitForInferReqTime,
+            std::chrono::duration_cast<std::chrono::microseconds>(streamAcquired - member->enqueueTime).count());
+        executed.push_back(member);
+    }
+    if (executed.empty()) {
+        return StatusCode::OK;
+    }
+    std::vector<size_t> batchSizes;
+    batchSizes.reserve(executed.size());
+    for (const auto* member : executed) {
+        batchSizes.push_back(member->batchSize);
+    }
+    SPDLOG_DEBUG("Executing dynamic batch for model: {}; version: {}; nireq: {}; requests: {}; getting infer request took: {:.3f} ms",
+        instance.getName(), instance.getVersion(), streamIdGuard.getId(), executed.size(), timer.elapsed<std::chrono::microseconds>(GET_INFER_REQUEST) / 1000);
+    try {
+        if (executed.size() == 1) {
+            for (const auto& [name, tensor] : executed.front()->inputs) {
+                OV_LOGGER("ov::InferRequest: {}, request.set_tensor({}, tensor: {})", reinterpret_cast<void*>(&inferRequest), name, reinterpret_cast<const void*>(&tensor));
+                inferRequest.set_tensor(name, tensor);
+            }
+        } else {
+            for (const auto& [name, _] : executed.front()->inputs) {
+                std::vector<ov::Tensor> parts;
+                parts.reserve(executed.size());
+                for (const auto* member : executed) {
+                    parts.push_back(member->inputs.at(name));
+                }
+                ov::Tensor batched;
+                status = concatenate(parts, batchIndex, batched);
+                if (!status.ok()) {
+                    SPDLOG_DEBUG("Failed to concatenate input: {} for model: {}; version: {}", name, instance.getName(), instance.getVersion());
+                    return status;
+                }
+                OV_LOGGER("ov::InferRequest: {}, request.set_tensor({}, tensor: {})", reinterpret_cast<void*>(&inferRequest), name, reinterpret_cast<void*>(&batched));
+                inferRequest.set_tensor(name, batched);
+            }
+        }
+    } catch (const std::exception& e) {
+        status = StatusCode::OV_INTERNAL_DESERIALIZATION_ERROR;
+        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        return status;
+    }
+    timer.start(PREDICTION);
+    status = instance.performInference(inferRequest);
+    timer.stop(PREDICTION);
+    if (!status.ok()) {
+        return status;
+    }
+    instance.getAdmissionController().recordServiceTime(timer.elapsed<std::chrono::microseconds>(PREDICTION));
+    try {
+        for (const auto& [_, outputInfo] : instance.getOutputsInfo()) {
+            const auto& name = outputInfo->getName();
+            OV_LOGGER("ov::InferRequest: {}, request.get_tensor({})", reinterpret_cast<void*>(&inferRequest), name);
+            ov::Tensor batched = inferRequest.get_tensor(name);
+            std::vector<ov::Tensor> parts;
+            // outputs are always copied out since infer request buffers are reused once stream is returned
+            if (executed.size() == 1) {
+                // output batch of standalone request with mixed input batch sizes is defined by model
+                status = split(batched, batchIndex, {batched.get_shape()[batchIndex]}, parts);
+            } else {
+                status = split(batched, batchIndex, batchSizes, parts);
+            }
+            if (!status.ok()) {
+                SPDLOG_DEBUG("Failed to split output: {} for model: {}; version: {}", name, instance.getName(), instance.getVersion());
+                return status;
+            }
+            for (size_t i = 0; i < executed.size(); ++i) {
+                executed[i]->outputs[name] = std::move(parts[i]);
+            }
+        }
+    } catch (const std::exception& e) {
+        status = StatusCode::OV_INTERNAL_SERIALIZATION_ERROR;
+        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+        return status;
+    }
+    return StatusCode::OK;
+}
+
+}  // namespace ovms
@@ -0,0 +1,163 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <openvino/runtime/tensor.hpp>
+
+#include "dags/tensormap.hpp"
+#include "deserialization_common.hpp"
+#include "logging.hpp"
+#include "serialization_common.hpp"
+#include "status.hpp"
+
+namespace ovms {
+class ModelInstance;
+class ModelMetricReporter;
+
+/**
+ * @brief Server side batching stage for a single model version.
+ *
+ * Concurrent requests are held for up to maxQueueDelay, concatenated along the model
+ * batch dimension and executed with a single infer request. Outputs are split back
+ * to the callers. There is no dedicated scheduling thread - the oldest waiting caller
+ * becomes the leader of the batch and executes it on its own thread.
+ * Requests enqueued with inferAsync have no waiting caller, batches starting with such
+ * request are led by scheduler threads, started on first use, one per model infer request.
+ * Requests pass model admission control when enqueued, counting requests waiting for batch,
+ * and with edf dispatch policy members which deadline passed before execution are dropped.
+ */
+class DynamicBatchingScheduler {
+public:
+    DynamicBatchingScheduler(ModelInstance& instance, size_t maxBatchSize, uint32_t maxQueueDelayUs);
+    ~DynamicBatchingScheduler();
+
+    /**
+     * @brief Blocks until batched inference containing provided inputs is finished
+     *
+     * @param inputs deserialized request tensors keyed by model input name
+     * @param outputs filled with request part of model outputs keyed by model output name
+     * @param deadline request deadline, effective only with edf dispatch policy
+     *
+     * @return Status SERVABLE_OVERLOADED if admission control limits are exceeded,
+     * INFERENCE_DEADLINE_EXCEEDED if deadline passed before batch was executed
+     */
+    Status infer(const TensorMap& inputs, TensorMap& outputs, const std::optional<std::chrono::steady_clock::time_point>& deadline = std::nullopt);
+
+    /**
+     * @brief Enqueues inputs for batched inference without blocking the caller
+     *
+     * Used by DAG node sessions so that subsessions of concurrent pipeline executions are merged.
+     * Inputs and outputs have to stay valid until onFinished is called from scheduler thread.
+     */
+    void inferAsync(const TensorMap& inputs, TensorMap& outputs, std::function<void(Status)> onFinished, const std::optional<std::chrono::steady_clock::time_point>& deadline = std::nullopt);
+
+    /**
+     * @brief Checks if deserialized request can be merged with other requests
+     */
+    bool isBatchable(const TensorMap& inputs) const;
+
+    /**
+     * @brief Checks that batchable inputs share batch size which does not exceed max batch size
+     *
+     * Requests which do not pass are still executed by infer and inferAsync, but never merged with other requests.
+     *
+     * @return Status INVALID_BATCH_SIZE otherwise
+     */
+    Status validateBatchSize(const TensorMap& inputs) const;
+
+    size_t getMaxBatchSize() const { return maxBatchSize; }
+    std::chrono::microseconds getMaxQueueDelay() const { return maxQueueDelay; }
+
+    /**
+     * @brief Concatenates tensors of the same precision and shape (except batch dimension) along batchIndex
+     */
+    static Status concatenate(const std::vector<ov::Tensor>& parts, size_t batchIndex, ov::Tensor& result);
+
+    /**
+     * @brief Splits tensor along batchIndex into newly allocated tensors of provided batch sizes
+     */
+    static Status split(const ov::Tensor& batched, size_t batchIndex, const std::vector<size_t>& batchSizes, std::vector<ov::Tensor>& parts);
+
+private:
+    struct PendingRequest {
+        // each request is reported in model current requests metric until it is finished, as if executed separately
+        PendingRequest(ModelMetricReporter& reporter, const TensorMap& inputs, TensorMap& outputs, size_t batchSize, bool standalone, const std::optional<std::chrono::steady_clock::time_point>& deadline, std::function<void(Status)> onFinished = {});
+        ~PendingRequest();
+        PendingRequest(const PendingRequest&) = delete;
+        PendingRequest& operator=(const PendingRequest&) = delete;
+        ModelMetricReporter& reporter;
+        const TensorMap& inputs;
+        TensorMap& outputs;
+        const size_t batchSize;
+        // oversized or mixed batch size requests are executed alone
+        const bool standalone;
+        const std::chrono::steady_clock::time_point enqueueTime;
+        const std::optional<std::chrono::steady_clock::time_point> deadline;
+        // set only for requests enqueued with inferAsync, which are owned by the scheduler
+        std::function<void(Status)> onFinished;
+        Status status;
+        bool done{false};
+    };
+
+    Status admitLocked(const std::optional<std::chrono::steady_clock::time_point>& deadline);
+    bool isCompatible(const PendingRequest& anchor, const PendingRequest& other) const;
+    size_t getCollectableBatchSize(const PendingRequest& anchor) const;
+    std::vector<PendingRequest*> collectBatch(PendingRequest& anchor);
+    Status executeBatch(std::vector<PendingRequest*>& batch);
+    void finishBatch(std::vector<PendingRequest*>& batch, const Status& status, std::unique_lock<std::mutex>& lock);
+    void leadAsyncBatches();
+
+    ModelInstance& instance;
+    const size_t batchIndex;
+    const size_t maxBatchSize;
+    const std::chrono::microseconds maxQueueDelay;
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::deque<PendingRequest*> pending;
+    bool leaderPresent{false};
+    bool stopped{false};
+    std::vector<std::thread> asyncLeaders;
+};
+
+template <>
+inline Status InputSink<TensorMap&>::give(const std::string& name, ov::Tensor& tensor) {
+    requester[name] = tensor;
+    return StatusCode::OK;
+}
+
+template <>
+inline Status OutputGetter<TensorMap&>::get(const std::string& name, ov::Tensor& tensor) {
+    auto it = outputSource.find(name);
+    if (it == outputSource.end()) {
+        SPDLOG_DEBUG("Failed to find expected batched output when serializing response: {}", name);
+        return StatusCode::INTERNAL_ERROR;
+    }
+    tensor = it->second;
+    return StatusCode::OK;
+}
+}  // namespace ovms
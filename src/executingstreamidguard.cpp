@@ -37,13 +37,27 @@ ExecutingStreamIdGuard::ExecutingStreamIdGuard(OVInferRequestsQueue& inferReques
     INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
 }
 
+ExecutingStreamIdGuard::ExecutingStreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, int acquiredStreamId, ModelMetricReporter& reporter) :
+    StreamIdGuard(inferRequestsQueue, acquiredStreamId),
+    currentRequestsMetricGuard(reporter),
+    reporter(reporter) {
+    INCREMENT_IF_ENABLED(this->reporter.inferReqActive);
+}
+
 ExecutingStreamIdGuard::~ExecutingStreamIdGuard() {
     DECREMENT_IF_ENABLED(this->reporter.inferReqActive);
 }
 
 StreamIdGuard::StreamIdGuard(OVInferRequestsQueue& inferRequestsQueue) :
     inferRequestsQueue_(inferRequestsQueue),
-    id_(inferRequestsQueue_.getIdleStream().get()),
+    id_(inferRequestsQueue_.acquireIdleStream()),
+    inferRequest(inferRequestsQueue.getInferRequest(id_)) {
+    SPDLOG_TRACE("Got request id:{}", getId());
+}
+
+StreamIdGuard::StreamIdGuard(OVInferRequestsQueue& inferRequestsQueue, int acquiredStreamId) :
+    inferRequestsQueue_(inferRequestsQueue),
+    id_(acquiredStreamId),
     inferRequest(inferRequestsQueue.getInferRequest(id_)) {
     SPDLOG_TRACE("Got request id:{}", getId());
 }
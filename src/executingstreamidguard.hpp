@@ -27,6 +27,8 @@ class OVInferRequestsQueue;
 
 struct StreamIdGuard {
     StreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue);
+    // takes ownership of stream already acquired from the queue
+    StreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, int acquiredStreamId);
     ~StreamIdGuard();
     int getId();
     ov::InferRequest& getInferRequest();
@@ -37,6 +39,7 @@ struct StreamIdGuard {
 
 struct ExecutingStreamIdGuard : public StreamIdGuard {
     ExecutingStreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, ModelMetricReporter& reporter);
+    ExecutingStreamIdGuard(ovms::OVInferRequestsQueue& inferRequestsQueue, int acquiredStreamId, ModelMetricReporter& reporter);
     ~ExecutingStreamIdGuard();
 
 private:
@@ -102,6 +102,10 @@ const grpc::Status grpc(const Status& status) {
         {StatusCode::MODEL_VERSION_NOT_LOADED_YET, grpc::StatusCode::UNAVAILABLE},
         {StatusCode::PIPELINE_DEFINITION_NOT_LOADED_YET, grpc::StatusCode::UNAVAILABLE},
         {StatusCode::MEDIAPIPE_DEFINITION_NOT_LOADED_YET, grpc::StatusCode::UNAVAILABLE},
+        // DEADLINE_EXCEEDED
+        {StatusCode::INFERENCE_DEADLINE_EXCEEDED, grpc::StatusCode::DEADLINE_EXCEEDED},
+        // RESOURCE_EXHAUSTED
+        {StatusCode::SERVABLE_OVERLOADED, grpc::StatusCode::RESOURCE_EXHAUSTED},
         // UNKNOWN
     };
     auto it = grpcStatusMap.find(status.getCode());
@@ -31,6 +31,7 @@
 #include <stdlib.h>
 
 #include "config.hpp"
+#include "kfs_frontend/kfs_grpc_callback_inference_service.hpp"
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
 #include "logging.hpp"
 #include "modelmanager.hpp"
@@ -91,7 +92,8 @@ GRPCServerModule::~GRPCServerModule() {
 
 GRPCServerModule::GRPCServerModule(Server& server) :
     server(server),
-    kfsGrpcInferenceService(this->server) {}
+    kfsGrpcInferenceService(this->server),
+    kfsGrpcCallbackInferenceService(kfsGrpcInferenceService) {}
 
 static std::string host_with_port(const std::string& host, int port) {
     if (Config::is_ipv6(host)) {
@@ -133,7 +135,7 @@ Status GRPCServerModule::start(const ovms::Config& config) {
         SPDLOG_INFO("Binding gRPC server to address: {}", hostWithPort);
         builder.AddListeningPort(hostWithPort, grpc::InsecureServerCredentials());
     }
-    builder.RegisterService(&kfsGrpcInferenceService);
+    builder.RegisterService(&kfsGrpcCallbackInferenceService);
     for (auto& [name, value] : channel_arguments) {
         // gRPC accept arguments of two types, int and string. We will attempt to
         // parse each arg as int and pass it on as such if successful. Otherwise we
@@ -171,6 +173,9 @@ Status GRPCServerModule::start(const ovms::Config& config) {
         SPDLOG_ERROR(status.string());
         return status;
     }
+    // blocking part of ModelInfer is executed outside of gRPC reactor threads
+    const uint32_t workersCount = config.grpcMaxThreads() != 0 ? config.grpcMaxThreads() : getCoreCount();
+    kfsGrpcCallbackInferenceService.startWorkers(workersCount, workersCount * KFSCallbackInferenceService::QUEUED_JOBS_PER_WORKER);
     for (uint32_t i = 0; i < grpcServersCount; ++i) {
         std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
         if (server == nullptr) {
@@ -201,6 +206,7 @@ void GRPCServerModule::shutdown() {
     }
 
     servers.clear();
+    kfsGrpcCallbackInferenceService.shutdownWorkers();
     state = ModuleState::SHUTDOWN;
     SPDLOG_INFO("{} shutdown", GRPC_SERVER_MODULE_NAME);
 }
@@ -20,6 +20,7 @@
 
 #include <grpcpp/server.h>
 
+#include "kfs_frontend/kfs_grpc_callback_inference_service.hpp"
 #include "kfs_frontend/kfs_grpc_inference_service.hpp"
 #include "module.hpp"
 
@@ -30,6 +31,7 @@ class Server;
 class GRPCServerModule : public Module {
     Server& server;
     mutable KFSInferenceServiceImpl kfsGrpcInferenceService;
+    KFSCallbackInferenceService kfsGrpcCallbackInferenceService;
     std::vector<std::unique_ptr<grpc::Server>> servers;
 
 public:
@@ -93,45 +93,9 @@ const std::string DEFAULT_VERSION = "DEFAULT";
 
 namespace ovms {
 
-const std::string HttpRestApiHandler::configReloadRegexExp = R"((.?)\/v1\/config\/reload)";
-const std::string HttpRestApiHandler::configStatusRegexExp = R"((.?)\/v1\/config)";
-
-const std::string HttpRestApiHandler::kfs_modelreadyRegexExp =
-    R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/(ready)))";
-const std::string HttpRestApiHandler::kfs_modelmetadataRegexExp =
-    R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/)?)";
-const std::string HttpRestApiHandler::kfs_inferRegexExp =
-    R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/(infer)))";
-const std::string HttpRestApiHandler::kfs_serverreadyRegexExp =
-    R"(/v2/health/ready)";
-const std::string HttpRestApiHandler::kfs_serverliveRegexExp =
-    R"(/v2/health/live)";
-const std::string HttpRestApiHandler::kfs_servermetadataRegexExp =
-    R"(/v2)";
-
-const std::string HttpRestApiHandler::v3_ListModelsRegexExp =
-    R"((?:/v3/(v1/)?|/v1/)models)";
-const std::string HttpRestApiHandler::v3_RetrieveModelRegexExp =
-    R"((?:/v3/(v1/)?|/v1/)models/(.+))";
-const std::string HttpRestApiHandler::v3_RegexExp =
-    R"((?:/v3/|/v1/).*?(/|$))";
-
-const std::string HttpRestApiHandler::metricsRegexExp = R"((.?)\/metrics(\?(.*))?)";
-
 HttpRestApiHandler::HttpRestApiHandler(ovms::Server& ovmsServer, int timeout_in_ms, const std::string& apiKey) :
     apiKey(apiKey),
-    configReloadRegex(configReloadRegexExp),
-    configStatusRegex(configStatusRegexExp),
-    kfs_modelreadyRegex(kfs_modelreadyRegexExp),
-    kfs_modelmetadataRegex(kfs_modelmetadataRegexExp),
-    kfs_inferRegex(kfs_inferRegexExp),
-    kfs_serverreadyRegex(kfs_serverreadyRegexExp),
-    kfs_serverliveRegex(kfs_serverliveRegexExp),
-    kfs_servermetadataRegex(kfs_servermetadataRegexExp),
-    v3_ListModelsRegex(v3_ListModelsRegexExp),
-    v3_RetrieveModelRegex(v3_RetrieveModelRegexExp),
-    v3_Regex(v3_RegexExp),
-    metricsRegex(metricsRegexExp),
+    router(createRestApiRouter()),
     timeout_in_ms(timeout_in_ms),
     ovmsServer(ovmsServer),
 
@@ -201,6 +165,9 @@ void HttpRestApiHandler::registerAll() {
     registerHandler(Metrics, [this](const std::string_view uri, const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components, std::shared_ptr<HttpAsyncWriter> serverReaderWriter, std::shared_ptr<MultiPartParser> multiPartParser) -> Status {
         return processMetrics(request_components, response_components, response, request_body);
     });
+    registerHandler(PipelineProfile, [this](const std::string_view uri, const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components, std::shared_ptr<HttpAsyncWriter> serverReaderWriter, std::shared_ptr<MultiPartParser> multiPartParser) -> Status {
+        return processPipelineProfileRequest(request_components, response);
+    });
     registerHandler(Options, [this](const std::string_view uri, const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, HttpResponseComponents& response_components, std::shared_ptr<HttpAsyncWriter> serverReaderWriter, std::shared_ptr<MultiPartParser> multiPartParser) -> Status {
         return processOptions(request_components, response, request_body);
     });
@@ -297,9 +264,18 @@ static Status calculateBinaryDataSize(::KFSRequest::InferInputTensor& input, siz
     return StatusCode::OK;
 }
 
-static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string& request_body, size_t endOfJson) {
+// JSON data of numeric inputs may be already decoded into raw_input_contents, one entry per input.
+// Mixing such inputs with binary inputs is rejected the same way as when data is kept in typed contents fields.
+static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string& request_body, size_t endOfJson, size_t& copiedBytes) {
     const char* binary_inputs_buffer = &(request_body[endOfJson]);
     size_t binary_buffer_size = request_body.length() - endOfJson;
+    const bool dataDecodedToRawInputContents = grpc_request.raw_input_contents_size() > 0;
+    auto hasJsonData = [&grpc_request, dataDecodedToRawInputContents](int i) {
+        if (dataDecodedToRawInputContents) {
+            return !grpc_request.raw_input_contents(i).empty();
+        }
+        return !isInputEmpty(grpc_request.inputs(i));
+    };
 
     size_t binary_input_offset = 0;
     for (int i = 0; i < grpc_request.mutable_inputs()->size(); i++) {
@@ -307,7 +283,7 @@ static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string&
         auto binary_data_size_parameter = input->parameters().find("binary_data_size");
         size_t binary_input_size = 0;
         if (binary_data_size_parameter != input->parameters().end()) {
-            if (!isInputEmpty(*input)) {
+            if (hasJsonData(i)) {
                 SPDLOG_DEBUG("Request contains both data in json and binary inputs");
                 return StatusCode::REST_CONTENTS_FIELD_NOT_EMPTY;
             }
@@ -323,7 +299,7 @@ static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string&
                 return StatusCode::REST_BINARY_DATA_SIZE_PARAMETER_INVALID;
             }
         } else {
-            if (!isInputEmpty(*input))
+            if (hasJsonData(i))
                 continue;
             if (grpc_request.mutable_inputs()->size() == 1 && input->datatype() == "BYTES") {
                 binary_input_size = binary_buffer_size;
@@ -334,7 +310,16 @@ static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string&
                 }
             }
         }
+        if (dataDecodedToRawInputContents) {
+            // empty json data and empty binary input are indistinguishable, both already have empty buffer
+            if (binary_input_size == 0) {
+                continue;
+            }
+            SPDLOG_DEBUG("Request contains both inputs with data in json and binary inputs");
+            return StatusCode::INVALID_MESSAGE_STRUCTURE;
+        }
         auto status = handleBinaryInput(binary_input_size, binary_input_offset, binary_buffer_size, binary_inputs_buffer, *input, grpc_request.add_raw_input_contents());
+        copiedBytes += binary_input_size;
         if (!status.ok()) {
             SPDLOG_DEBUG("Error handling binary input");
             return status;
@@ -343,25 +328,37 @@ static Status handleBinaryInputs(::KFSRequest& grpc_request, const std::string&
     return StatusCode::OK;
 }
 
-Status HttpRestApiHandler::prepareGrpcRequest(const std::string modelName, const std::optional<int64_t>& modelVersion, const std::string& request_body, ::KFSRequest& grpc_request, const std::optional<int>& inferenceHeaderContentLength) {
-    KFSRestParser requestParser;
+Status HttpRestApiHandler::prepareGrpcRequest(const std::string modelName, const std::optional<int64_t>& modelVersion, const std::string& request_body, ::KFSRequest& grpc_request, const std::optional<int>& inferenceHeaderContentLength, size_t* copiedBytes) {
+    // numeric JSON data is decoded straight into raw_input_contents to skip typed contents fields
+    KFSRestParser requestParser(true);
 
     size_t endOfJson = inferenceHeaderContentLength.value_or(request_body.length());
     if (endOfJson > request_body.length()) {
         SPDLOG_DEBUG("Inference header content length exceeded JSON size");
         return StatusCode::REST_INFERENCE_HEADER_CONTENT_LENGTH_EXCEEDED;
     }
-    auto status = requestParser.parse(request_body.substr(0, endOfJson).c_str());
+    Status status;
+    if (endOfJson == request_body.length()) {
+        status = requestParser.parse(request_body.c_str());
+    } else {
+        status = requestParser.parse(request_body.substr(0, endOfJson).c_str());
+    }
     if (!status.ok()) {
         SPDLOG_DEBUG("Parsing http request failed");
         return status;
     }
-    grpc_request = requestParser.getProto();
-    status = handleBinaryInputs(grpc_request, request_body, endOfJson);
+    SPDLOG_DEBUG("Decoded JSON data of request: {} bytes into raw_input_contents, {} bytes into typed contents", requestParser.getRawInputContentsDecodedBytes(), requestParser.getContentsDecodedBytes());
+    grpc_request = std::move(requestParser.getProto());
+    size_t binaryInputsBytes = 0;
+    status = handleBinaryInputs(grpc_request, request_body, endOfJson, binaryInputsBytes);
     if (!status.ok()) {
         SPDLOG_DEBUG("Error handling binary inputs");
         return status;
     }
+    if (copiedBytes != nullptr) {
+        // raw_input_contents are used by tensors without further copies, typed contents are copied once again during deserialization
+        *copiedBytes = requestParser.getRawInputContentsDecodedBytes() + 2 * requestParser.getContentsDecodedBytes() + binaryInputsBytes;
+    }
     grpc_request.set_model_name(modelName);
     if (modelVersion.has_value()) {
         grpc_request.set_model_version(std::to_string(modelVersion.value()));
@@ -406,7 +403,8 @@ Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& r
     ::KFSRequest grpc_request;
     timer.start(PREPARE_GRPC_REQUEST);
     using std::chrono::microseconds;
-    auto status = prepareGrpcRequest(modelName, request_components.model_version, request_body, grpc_request, request_components.inferenceHeaderContentLength);
+    size_t copiedBytes = 0;
+    auto status = prepareGrpcRequest(modelName, request_components.model_version, request_body, grpc_request, request_components.inferenceHeaderContentLength, &copiedBytes);
     ExecutionContext executionContext{ExecutionContext::Interface::REST, ExecutionContext::Method::ModelInfer};
     if (!status.ok()) {
         auto pstatus = this->getReporter(request_components, reporter);
@@ -439,6 +437,7 @@ Status HttpRestApiHandler::processInferKFSRequest(const HttpRequestComponents& r
         // There is no request time metric for MediaPipe endpoints
     }
     OBSERVE_IF_ENABLED(reporter->requestTimeRest, totalTime);
+    OBSERVE_IF_ENABLED(reporter->restRequestCopiedBytes, copiedBytes);
     return StatusCode::OK;
 }
 
@@ -947,7 +946,6 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
     const std::string_view http_method,
     const std::string& request_path,
     const std::unordered_map<std::string, std::string>& headers) {
-    std::smatch sm;
     requestComponents.http_method = http_method;
     if (http_method != "POST" && http_method != "GET" && http_method != "OPTIONS") {
         return StatusCode::REST_UNSUPPORTED_METHOD;
@@ -958,106 +956,53 @@ Status HttpRestApiHandler::parseRequestComponents(HttpRequestComponents& request
         return StatusCode::PATH_INVALID;
     }
 
-    if (http_method == "POST") {
-        if (std::regex_match(request_path, sm, kfs_inferRegex, std::regex_constants::match_any)) {
-            requestComponents.type = KFS_Infer;
-            requestComponents.model_name = urlDecode(sm[1]);
-            std::string model_version_str = sm[2];
-            auto status = parseModelVersion(model_version_str, requestComponents.model_version);
-            if (!status.ok())
-                return status;
+    if (http_method == "OPTIONS") {
+        requestComponents.type = Options;
+        return StatusCode::OK;
+    }
 
-            status = parseInferenceHeaderContentLength(requestComponents, headers);
-            if (!status.ok())
-                return status;
-            return StatusCode::OK;
-        }
-        if (std::regex_match(request_path, sm, configReloadRegex)) {
-            requestComponents.type = ConfigReload;
-            return StatusCode::OK;
-        }
-        if (std::regex_match(request_path, sm, v3_Regex)) {
-            requestComponents.type = V3;
-            auto status = parseInferenceHeaderContentLength(requestComponents, headers);
-            if (!status.ok())
-                return status;
-            requestComponents.headers = headers;
-            return StatusCode::OK;
-        }
-        return (std::regex_match(request_path, sm, kfs_serverliveRegex) ||
-                   std::regex_match(request_path, sm, configStatusRegex) ||
-                   std::regex_match(request_path, sm, kfs_serverreadyRegex) ||
-                   std::regex_match(request_path, sm, kfs_servermetadataRegex) ||
-                   std::regex_match(request_path, sm, kfs_modelmetadataRegex) ||
-                   std::regex_match(request_path, sm, kfs_modelreadyRegex) ||
-                   std::regex_match(request_path, sm, v3_ListModelsRegex) ||
-                   std::regex_match(request_path, sm, v3_RetrieveModelRegex) ||
-                   std::regex_match(request_path, sm, metricsRegex))
-                   ? StatusCode::REST_UNSUPPORTED_METHOD
-                   : StatusCode::REST_INVALID_URL;
-
-    } else if (http_method == "GET") {
-        if (std::regex_match(request_path, sm, configStatusRegex)) {
-            requestComponents.type = ConfigStatus;
-            return StatusCode::OK;
-        }
-        if (std::regex_match(request_path, sm, kfs_serverliveRegex)) {
-            requestComponents.type = KFS_GetServerLive;
-            return StatusCode::OK;
-        }
-        if (std::regex_match(request_path, sm, kfs_serverreadyRegex)) {
-            requestComponents.type = KFS_GetServerReady;
-            return StatusCode::OK;
-        }
-        if (std::regex_match(request_path, sm, kfs_servermetadataRegex)) {
-            requestComponents.type = KFS_GetServerMetadata;
-            return StatusCode::OK;
-        }
-        if (std::regex_match(request_path, sm, kfs_modelmetadataRegex)) {
-            requestComponents.model_name = urlDecode(sm[1]);
-            std::string model_version_str = sm[2];
-            auto status = parseModelVersion(model_version_str, requestComponents.model_version);
-            if (!status.ok())
-                return status;
-            requestComponents.type = KFS_GetModelMetadata;
-            return StatusCode::OK;
-        }
-        if (std::regex_match(request_path, sm, kfs_modelreadyRegex)) {
-            requestComponents.model_name = urlDecode(sm[1]);
-            std::string model_version_str = sm[2];
-            auto status = parseModelVersion(model_version_str, requestComponents.model_version);
-            if (!status.ok())
-                return status;
-            requestComponents.type = KFS_GetModelReady;
-            return StatusCode::OK;
-        }
-        if (std::regex_match(request_path, sm, metricsRegex)) {
-            std::string params = sm[3];
-            if (!params.empty()) {
-                SPDLOG_DEBUG("Discarded following url parameters: {}", params);
-            }
-            requestComponents.type = Metrics;
-            return StatusCode::OK;
-        }
-        if (std::regex_match(request_path, sm, v3_ListModelsRegex)) {
-            requestComponents.type = V3_ListModels;
-            return StatusCode::OK;
+    RestRouteMatch route;
+    auto lookup = this->router.match(http_method, request_path, route);
+    if (lookup == RestRouteLookup::METHOD_NOT_ALLOWED) {
+        return StatusCode::REST_UNSUPPORTED_METHOD;
+    }
+    if (lookup == RestRouteLookup::NOT_FOUND) {
+        return StatusCode::REST_INVALID_URL;
+    }
+    requestComponents.type = route.type;
+    switch (route.type) {
+    case KFS_Infer:
+    case KFS_GetModelMetadata:
+    case KFS_GetModelReady: {
+        requestComponents.model_name = urlDecode(std::string(route.modelName));
+        std::string model_version_str(route.modelVersion);
+        auto status = parseModelVersion(model_version_str, requestComponents.model_version);
+        if (!status.ok())
+            return status;
+        if (route.type == KFS_Infer) {
+            return parseInferenceHeaderContentLength(requestComponents, headers);
         }
-        if (std::regex_match(request_path, sm, v3_RetrieveModelRegex)) {
-            requestComponents.model_name = urlDecode(sm[2]);
-            requestComponents.type = V3_RetrieveModel;
-            return StatusCode::OK;
+        return StatusCode::OK;
+    }
+    case PipelineProfile:
+    case V3_RetrieveModel:
+        requestComponents.model_name = urlDecode(std::string(route.modelName));
+        return StatusCode::OK;
+    case Metrics:
+        if (!route.query.empty()) {
+            SPDLOG_DEBUG("Discarded following url parameters: {}", route.query);
         }
-        return (std::regex_match(request_path, sm, kfs_inferRegex, std::regex_constants::match_any) ||
-                   std::regex_match(request_path, sm, configReloadRegex))
-                   ? StatusCode::REST_UNSUPPORTED_METHOD
-                   : StatusCode::REST_INVALID_URL;
+        return StatusCode::OK;
+    case V3: {
+        auto status = parseInferenceHeaderContentLength(requestComponents, headers);
+        if (!status.ok())
+            return status;
+        requestComponents.headers = headers;
+        return StatusCode::OK;
     }
-    if (http_method == "OPTIONS") {
-        requestComponents.type = Options;
+    default:
         return StatusCode::OK;
     }
-    return StatusCode::REST_INVALID_URL;
 }
 
 Status HttpRestApiHandler::processRequest(
@@ -1069,7 +1014,6 @@ Status HttpRestApiHandler::processRequest(
     HttpResponseComponents& responseComponents,
     std::shared_ptr<HttpAsyncWriter> serverReaderWriter,
     std::shared_ptr<MultiPartParser> multiPartParser) {
-    std::smatch sm;
     std::string request_path_str(request_path);
     if (FileSystem::isPathEscaped(request_path_str)) {
         SPDLOG_DEBUG("Path {} escape with .. is forbidden.", request_path);
@@ -1168,6 +1112,17 @@ Status HttpRestApiHandler::processConfigStatusRequest(std::string& response, Mod
     return StatusCode::OK;
 }
 
+Status HttpRestApiHandler::processPipelineProfileRequest(const HttpRequestComponents& request_components, std::string& response) {
+    SPDLOG_DEBUG("Processing profile request of pipeline: {}", request_components.model_name);
+    auto definition = this->modelManager.getPipelineFactory().findDefinitionByName(request_components.model_name);
+    if (definition == nullptr) {
+        SPDLOG_DEBUG("Pipeline with requested name: {} does not exist", request_components.model_name);
+        return StatusCode::PIPELINE_DEFINITION_NAME_MISSING;
+    }
+    response = definition->getProfiler().toJson(request_components.model_name);
+    return StatusCode::OK;
+}
+
 std::string urlDecode(const std::string& encoded) {
     std::ostringstream decoded;
     for (size_t i = 0; i < encoded.size(); ++i) {
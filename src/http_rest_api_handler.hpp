@@ -19,7 +19,6 @@
 #include <map>
 #include <memory>
 #include <optional>
-#include <regex>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -28,6 +27,7 @@
 #include "http_async_writer_interface.hpp"
 #include "multi_part_parser.hpp"
 #include "rest_parser.hpp"
+#include "rest_router.hpp"
 #include "status.hpp"
 #include "tensorinfo_fwd.hpp"
 
@@ -37,21 +37,6 @@ class KFSInferenceServiceImpl;
 class Server;
 class ModelManager;
 
-// note since removal of TFS, V3 endpoints (from OpenAI) are will be also accepted as V1
-enum RequestType { ConfigReload,
-    ConfigStatus,
-    KFS_GetModelReady,
-    KFS_Infer,
-    KFS_GetModelMetadata,
-    KFS_GetServerReady,
-    KFS_GetServerLive,
-    KFS_GetServerMetadata,
-    V3_ListModels,
-    V3_RetrieveModel,
-    V3,
-    Metrics,
-    Options };
-
 struct HttpRequestComponents {
     RequestType type;
     std::string_view http_method;
@@ -87,23 +72,6 @@ std::string urlDecode(const std::string& encoded);
 
 class HttpRestApiHandler {
 public:
-    static const std::string configReloadRegexExp;
-    static const std::string configStatusRegexExp;
-
-    static const std::string kfs_modelreadyRegexExp;
-    static const std::string kfs_modelmetadataRegexExp;
-    static const std::string kfs_inferRegexExp;
-
-    static const std::string metricsRegexExp;
-
-    static const std::string kfs_serverreadyRegexExp;
-    static const std::string kfs_serverliveRegexExp;
-    static const std::string kfs_servermetadataRegexExp;
-
-    static const std::string v3_ListModelsRegexExp;
-    static const std::string v3_RetrieveModelRegexExp;
-    static const std::string v3_RegexExp;
-
     /**
      * @brief Construct a new HttpRest Api Handler
      *
@@ -117,7 +85,7 @@ public:
         const std::unordered_map<std::string, std::string>& headers = {});
 
     Status parseModelVersion(std::string& model_version_str, std::optional<int64_t>& model_version);
-    static Status prepareGrpcRequest(const std::string modelName, const std::optional<int64_t>& modelVersion, const std::string& request_body, ::KFSRequest& grpc_request, const std::optional<int>& inferenceHeaderContentLength = {});
+    static Status prepareGrpcRequest(const std::string modelName, const std::optional<int64_t>& modelVersion, const std::string& request_body, ::KFSRequest& grpc_request, const std::optional<int>& inferenceHeaderContentLength = {}, size_t* copiedBytes = nullptr);
 
     void registerHandler(RequestType type, HandlerCallbackFn);
     void registerAll();
@@ -163,6 +131,7 @@ public:
     Status processInferKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body, std::optional<int>& inferenceHeaderContentLength);
     Status processMetrics(const HttpRequestComponents& request_components, HttpResponseComponents& response_components, std::string& response, const std::string& request_body);
     Status processOptions(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
+    Status processPipelineProfileRequest(const HttpRequestComponents& request_components, std::string& response);
 
     Status processServerReadyKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
     Status processServerLiveKFSRequest(const HttpRequestComponents& request_components, std::string& response, const std::string& request_body);
@@ -175,22 +144,7 @@ public:
     const std::string apiKey;
 
 private:
-    const std::regex configReloadRegex;
-    const std::regex configStatusRegex;
-
-    const std::regex kfs_modelreadyRegex;
-    const std::regex kfs_modelmetadataRegex;
-
-    const std::regex kfs_inferRegex;
-    const std::regex kfs_serverreadyRegex;
-    const std::regex kfs_serverliveRegex;
-    const std::regex kfs_servermetadataRegex;
-
-    const std::regex v3_ListModelsRegex;
-    const std::regex v3_RetrieveModelRegex;
-    const std::regex v3_Regex;
-
-    const std::regex metricsRegex;
+    const RestRouter router;
 
     std::map<RequestType, HandlerCallbackFn> handlers;
     int timeout_in_ms;
@@ -132,6 +132,8 @@ static const ovms::HTTPStatusCode http(const ovms::Status& status) {
 
         // Inference
         {StatusCode::OV_INTERNAL_INFERENCE_ERROR, ovms::HTTPStatusCode::ERROR},
+        {StatusCode::INFERENCE_DEADLINE_EXCEEDED, ovms::HTTPStatusCode::GATEWAY_TO},
+        {StatusCode::SERVABLE_OVERLOADED, ovms::HTTPStatusCode::TOO_MANY_REQUESTS},
 
         // Serialization
 
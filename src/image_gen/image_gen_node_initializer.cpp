@@ -42,7 +42,8 @@ public:
         const std::string& graphName,
         const std::string& basePath,
         GraphSidePackets& sidePackets,
-        PythonBackend* /*pythonBackend*/) override {
+        PythonBackend* /*pythonBackend*/,
+        MediapipeServableMetricReporter* /*metricReporter*/) override {
         auto& imageGenPipelinesMap = sidePackets.imageGenPipelinesMap;
         if (!nodeConfig.node_options().size()) {
             SPDLOG_ERROR("Image Gen node missing options in graph: {}. ", graphName);
@@ -39,7 +39,7 @@ public:
     // Blocks until a pipeline slot becomes available.
     explicit PipelineSlotGuard(Queue<int>& queue) :
         queue_(queue),
-        streamId_(queue_.getIdleStream().get()) {}
+        streamId_(queue_.acquireIdleStream()) {}
     ~PipelineSlotGuard() {
         queue_.returnStream(streamId_);
     }
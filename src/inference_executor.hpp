@@ -16,7 +16,9 @@
 #pragma once
 
 #include <algorithm>
+#include <chrono>
 #include <cstdlib>
+#include <functional>
 #include <iostream>
 #include <memory>
 #include <optional>
@@ -25,6 +27,7 @@
 #include <thread>
 #include <utility>
 
+#include "dynamic_batching_scheduler.hpp"
 #include "executingstreamidguard.hpp"
 #include "logging.hpp"
 #include "modelinstance.hpp"
@@ -32,6 +35,7 @@
 #include "outputkeeper.hpp"
 #include "predict_request_validation_utils.hpp"
 #include "requestprocessor.hpp"
+#include "shape_variants_cache.hpp"
 
 #include "deserialization_common.hpp"
 #include "serialization_common.hpp"
@@ -39,6 +43,24 @@
 #include "timer.hpp"
 
 namespace ovms {
+// used only for KFS, other frontends do not carry inference timeout in request
+template <typename RequestType>
+std::optional<std::chrono::steady_clock::time_point> getRequestDeadline(const RequestType* request) {
+    return std::nullopt;
+}
+
+template <typename RequestType>
+std::optional<std::chrono::steady_clock::time_point> getEarliestDeadline(const RequestType* request, const std::optional<std::chrono::steady_clock::time_point>& clientDeadline) {
+    auto requestDeadline = getRequestDeadline(request);
+    if (!requestDeadline.has_value()) {
+        return clientDeadline;
+    }
+    if (!clientDeadline.has_value()) {
+        return requestDeadline;
+    }
+    return std::min(requestDeadline.value(), clientDeadline.value());
+}
+
 enum : unsigned int {
     GET_INFER_REQUEST,
     PREPROCESS,
@@ -61,8 +83,8 @@ Status modelInferAsync(ModelInstance& instance, const RequestType* request,
     //    return status;
     auto status = request_validation_utils::validate(
         *request,
-        instance.getInputsInfo(),
-        instance.getOutputsInfo(),
+        modelUnloadGuardPtr->getShapeVariant().inputsInfo,
+        modelUnloadGuardPtr->getShapeVariant().outputsInfo,
         instance.getName(),
         instance.getVersion(),
         instance.getOptionalInputNames(),
@@ -77,13 +99,15 @@ Status modelInferAsync(ModelInstance& instance, const RequestType* request,
     }
     if (!status.ok())
         return status;
+    // request executes on shape variant it was validated against, even if other request swaps it meanwhile
+    const auto& shapeVariant = modelUnloadGuardPtr->getShapeVariant();
     /* status = requestProcessor->prepare();
     if (!status.ok())
         return status;
 */
     timer.start(GET_INFER_REQUEST);
     OVMS_PROFILE_SYNC_BEGIN("getInferRequest");
-    auto executingStreamIdGuard = std::make_shared<ExecutingStreamIdGuard>(instance.getInferRequestsQueue(), instance.getMetricReporter());
+    auto executingStreamIdGuard = std::make_shared<ExecutingStreamIdGuard>(*shapeVariant.inferRequestsQueue, instance.getMetricReporter());
     // int executingInferId = executingStreamIdGuard->getId();
     ov::InferRequest& inferRequest = executingStreamIdGuard->getInferRequest();
     OVMS_PROFILE_SYNC_END("getInferRequest");
@@ -108,10 +132,10 @@ Status modelInferAsync(ModelInstance& instance, const RequestType* request,
     InputSink<ov::InferRequest&> inputSink(inferRequest);
     bool isPipeline = false;
     std::shared_ptr<OutputKeeper> outKeeper;
-    if (instance.doesSupportOutputReset()) {
-        outKeeper = std::make_shared<OutputKeeper>(executingStreamIdGuard->getInferRequest(), instance.getOutputsInfo());
+    if (shapeVariant.supportOutputTensorsReset) {
+        outKeeper = std::make_shared<OutputKeeper>(executingStreamIdGuard->getInferRequest(), shapeVariant.outputsInfo);
     }
-    status = deserializePredictRequest<ConcreteTensorProtoDeserializator, InputSink<ov::InferRequest&>>(*request, instance.getInputsInfo(), instance.getOutputsInfo(), inputSink, isPipeline, instance.getTensorFactories());
+    status = deserializePredictRequest<ConcreteTensorProtoDeserializator, InputSink<ov::InferRequest&>>(*request, shapeVariant.inputsInfo, shapeVariant.outputsInfo, inputSink, isPipeline, shapeVariant.tensorFactories);
     timer.stop(DESERIALIZE);
     if (!status.ok()) {
         SPDLOG_DEBUG("Deserialization of outputs failed for model {}, version {}", instance.getName(), instance.getVersion());
@@ -136,7 +160,7 @@ Status modelInferAsync(ModelInstance& instance, const RequestType* request,
     {
         // order is important here - destructors are called in order from right to left
         inferRequest.set_callback(
-            [&instance, request, &inferRequest, userCallback, userCallbackData, modelUnloadGuardPtrMoved = std::shared_ptr<ModelInstanceUnloadGuard>(std::move(modelUnloadGuardPtr)), streamIdGuardMoved = std::move(executingStreamIdGuard), movedOutputKeeper = std::move(outKeeper)](std::exception_ptr exception) mutable {
+            [&instance, &shapeVariant, request, &inferRequest, userCallback, userCallbackData, modelUnloadGuardPtrMoved = std::shared_ptr<ModelInstanceUnloadGuard>(std::move(modelUnloadGuardPtr)), streamIdGuardMoved = std::move(executingStreamIdGuard), movedOutputKeeper = std::move(outKeeper)](std::exception_ptr exception) mutable {
                 struct CallbackGuard {
                     OVMS_InferenceRequestCompletionCallback_t userCallback{nullptr};
                     void* userCallbackData{nullptr};
@@ -187,7 +211,7 @@ Status modelInferAsync(ModelInstance& instance, const RequestType* request,
                 OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
                 try {
                     // TODO created filter based on what is in request, then perform casual serialization for what was NOT in request, and rewrite tensors from request to response for those that were
-                    auto status = serializePredictResponse(outputGetter, instance.getName(), instance.getVersion(), instance.getOutputsInfo(), request, res.get(), getTensorInfoName, useSharedOutputContentFn(request));
+                    auto status = serializePredictResponse(outputGetter, instance.getName(), instance.getVersion(), shapeVariant.outputsInfo, request, res.get(), getTensorInfoName, useSharedOutputContentFn(request));
                     if (!status.ok()) {
                         SPDLOG_DEBUG("Encountered issue during response serialization:{}", status.string());
                         return;
@@ -214,11 +238,180 @@ Status modelInferAsync(ModelInstance& instance, const RequestType* request,
     }
     return StatusCode::OK;
 }
+/**
+ * @brief Starts inference of already prepared request on acquired stream
+ *
+ * Stream is returned when Status other than OK is returned, onComplete is not called then.
+ */
+template <typename RequestType, typename ResponseType>
+Status startModelInferenceOnStream(ModelInstance& instance, const RequestType* requestProto,
+    ResponseType* responseProto,
+    std::shared_ptr<RequestProcessor<RequestType, ResponseType>> requestProcessor,
+    std::shared_ptr<ModelInstanceUnloadGuard> modelUnloadGuard,
+    int streamId,
+    std::chrono::steady_clock::time_point getInferRequestStart,
+    const std::optional<std::chrono::steady_clock::time_point>& deadline,
+    std::function<void(const Status&)> onComplete) {
+    OVMS_PROFILE_FUNCTION();
+    Timer<TIMER_END> timer;
+    using std::chrono::microseconds;
+    const auto& shapeVariant = modelUnloadGuard->getShapeVariant();
+    auto executingStreamIdGuard = std::make_unique<ExecutingStreamIdGuard>(*shapeVariant.inferRequestsQueue, streamId, instance.getMetricReporter());
+    ov::InferRequest& inferRequest = executingStreamIdGuard->getInferRequest();
+    double getInferRequestTime = std::chrono::duration_cast<microseconds>(std::chrono::steady_clock::now() - getInferRequestStart).count();
+    OBSERVE_IF_ENABLED(instance.getMetricReporter().waitForInferReqTime, getInferRequestTime);
+    SPDLOG_DEBUG("Getting infer req duration in model {}, version {}, nireq {}: {:.3f} ms",
+        instance.getName(), instance.getVersion(), executingStreamIdGuard->getId(), getInferRequestTime / 1000);
+
+    auto status = requestProcessor->preInferenceProcessing(inferRequest);
+    if (!status.ok())
+        return status;
+
+    timer.start(DESERIALIZE);
+    InputSink<ov::InferRequest&> inputSink(inferRequest);
+    bool isPipeline = false;
+    std::unique_ptr<OutputKeeper> outKeeper;
+    if (shapeVariant.supportOutputTensorsReset) {
+        outKeeper = std::make_unique<OutputKeeper>(inferRequest, shapeVariant.outputsInfo);
+    }
+    status = deserializePredictRequest<ConcreteTensorProtoDeserializator, InputSink<ov::InferRequest&>>(*requestProto, shapeVariant.inputsInfo, shapeVariant.outputsInfo, inputSink, isPipeline, shapeVariant.tensorFactories);
+    timer.stop(DESERIALIZE);
+    if (!status.ok()) {
+        SPDLOG_DEBUG("Deserialization of outputs failed for model {}, version {}", instance.getName(), instance.getVersion());
+        return status;
+    }
+    SPDLOG_DEBUG("Deserialization duration in model {}, version {}: {:.3f} ms",
+        instance.getName(), instance.getVersion(), timer.elapsed<microseconds>(DESERIALIZE) / 1000);
+    status = instance.checkDeadline(deadline);
+    if (!status.ok())
+        return status;
+
+    const auto inferStart = std::chrono::steady_clock::now();
+    try {
+        // stream and unload guards are owned by the callback so both are released only after response is ready
+        inferRequest.set_callback(
+            [&instance, &shapeVariant, requestProto, responseProto, &inferRequest, inferStart, onComplete = std::move(onComplete), requestProcessor, modelUnloadGuard = std::move(modelUnloadGuard), streamIdGuard = std::shared_ptr<ExecutingStreamIdGuard>(std::move(executingStreamIdGuard)), outputKeeper = std::shared_ptr<OutputKeeper>(std::move(outKeeper))](std::exception_ptr exception) mutable {
+                Status status = StatusCode::OK;
+                if (exception) {
+                    try {
+                        std::rethrow_exception(exception);
+                    } catch (const std::exception& e) {
+                        status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+                        SPDLOG_ERROR("Async caught an exception {}: {}", status.string(), e.what());
+                    } catch (...) {
+                        status = StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+                        SPDLOG_ERROR("Async caught an exception {}", status.string());
+                    }
+                } else {
+                    double inferTime = std::chrono::duration_cast<microseconds>(std::chrono::steady_clock::now() - inferStart).count();
+                    OBSERVE_IF_ENABLED(instance.getMetricReporter().inferenceTime, inferTime);
+                    instance.getAdmissionController().recordServiceTime(inferTime);
+                    try {
+                        OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
+                        status = serializePredictResponse(outputGetter, instance.getName(), instance.getVersion(), shapeVariant.outputsInfo, requestProto, responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
+                        if (status.ok())
+                            status = requestProcessor->postInferenceProcessing(responseProto, inferRequest);
+                        if (status.ok())
+                            status = requestProcessor->release();
+                    } catch (const std::exception& e) {
+                        status = StatusCode::OV_INTERNAL_SERIALIZATION_ERROR;
+                        SPDLOG_DEBUG("{}: {}", status.string(), e.what());
+                    }
+                }
+                // restore infer request outputs before the stream can be reused
+                outputKeeper.reset();
+                onComplete(status);
+                OV_LOGGER("ov::InferRequest: {} set_callback() with empty lambda", reinterpret_cast<void*>(&inferRequest));
+                // destroys this callback state returning stream and releasing model unload guard
+                inferRequest.set_callback([](std::exception_ptr) {});
+            });
+        OV_LOGGER("ov::InferRequest: {}, inferRequest.start_async()", reinterpret_cast<void*>(&inferRequest));
+        inferRequest.start_async();
+    } catch (const std::exception& e) {
+        SPDLOG_ERROR("Caught exception when starting inference in model {}, version {}: {}", instance.getName(), instance.getVersion(), e.what());
+        inferRequest.set_callback([](std::exception_ptr) {});
+        return StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+    }
+    return StatusCode::OK;
+}
+
+/**
+ * @brief Starts single model inference without waiting for its result
+ *
+ * Caller is not blocked when no infer request is idle. Inference is then started by job passed
+ * to scheduleOnStreamReady once infer request is returned by other request, or directly from
+ * returning thread when scheduleOnStreamReady is not set.
+ * When OK is returned, onComplete is called exactly once, after response is serialized
+ * from OpenVINO completion callback or with error status if inference could not be started later.
+ * Otherwise onComplete is not called and request is not started.
+ * Client deadline is respected only with edf dispatch policy.
+ */
+template <typename RequestType, typename ResponseType>
+Status modelInferWithCallback(ModelInstance& instance, const RequestType* requestProto,
+    ResponseType* responseProto,
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    std::function<void(const Status&)> onComplete,
+    std::optional<std::chrono::steady_clock::time_point> clientDeadline = std::nullopt,
+    std::function<void(std::function<void()>)> scheduleOnStreamReady = {}) {
+    OVMS_PROFILE_FUNCTION();
+    auto requestProcessor = std::make_shared<RequestProcessor<RequestType, ResponseType>>();
+    auto status = requestProcessor->extractRequestParameters(requestProto);
+    if (!status.ok())
+        return status;
+    status = request_validation_utils::validate(
+        *requestProto,
+        modelUnloadGuardPtr->getShapeVariant().inputsInfo,
+        modelUnloadGuardPtr->getShapeVariant().outputsInfo,
+        instance.getName(),
+        instance.getVersion(),
+        instance.getOptionalInputNames(),
+        instance.getModelConfig().getBatchingMode(),
+        instance.getModelConfig().getShapes());
+    if (status.batchSizeChangeRequired() || status.reshapeRequired()) {
+        auto requestBatchSize = getRequestBatchSize(requestProto, instance.getBatchSizeIndex());
+        auto requestShapes = getRequestShapes(requestProto);
+        status = instance.reloadModelIfRequired(status, requestBatchSize, requestShapes, modelUnloadGuardPtr);
+    }
+    if (!status.ok())
+        return status;
+    status = requestProcessor->prepare();
+    if (!status.ok())
+        return status;
+
+    const auto deadline = getEarliestDeadline(requestProto, clientDeadline);
+    // unload guard is held until response is ready, also while waiting for infer request
+    auto modelUnloadGuard = std::shared_ptr<ModelInstanceUnloadGuard>(std::move(modelUnloadGuardPtr));
+    const auto getInferRequestStart = std::chrono::steady_clock::now();
+    std::optional<int> streamId;
+    status = instance.acquireInferRequestStreamOrNotify(*modelUnloadGuard->getShapeVariant().inferRequestsQueue, deadline, streamId,
+        [&instance, requestProto, responseProto, requestProcessor, modelUnloadGuard, getInferRequestStart, deadline, onComplete, scheduleOnStreamReady](const Status& acquireStatus, int acquiredStreamId) {
+            auto start = [&instance, requestProto, responseProto, requestProcessor, modelUnloadGuard, getInferRequestStart, deadline, onComplete, acquireStatus, acquiredStreamId]() {
+                Status status = acquireStatus;
+                if (status.ok()) {
+                    status = startModelInferenceOnStream(instance, requestProto, responseProto, requestProcessor, modelUnloadGuard, acquiredStreamId, getInferRequestStart, deadline, onComplete);
+                }
+                if (!status.ok()) {
+                    onComplete(status);
+                }
+            };
+            if (scheduleOnStreamReady) {
+                scheduleOnStreamReady(std::move(start));
+            } else {
+                start();
+            }
+        });
+    if (!status.ok() || !streamId.has_value()) {
+        return status;
+    }
+    return startModelInferenceOnStream(instance, requestProto, responseProto, requestProcessor, std::move(modelUnloadGuard), streamId.value(), getInferRequestStart, deadline, std::move(onComplete));
+}
+
 // TODO @atobisze rename to modelInfer to be clear it is for model
 template <typename RequestType, typename ResponseType>
 Status infer(ModelInstance& instance, const RequestType* requestProto,
     ResponseType* responseProto,
-    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr) {
+    std::unique_ptr<ModelInstanceUnloadGuard>& modelUnloadGuardPtr,
+    std::optional<std::chrono::steady_clock::time_point> clientDeadline = std::nullopt) {
     OVMS_PROFILE_FUNCTION();
     Timer<TIMER_END> timer;
     using std::chrono::microseconds;
@@ -229,8 +422,8 @@ Status infer(ModelInstance& instance, const RequestType* requestProto,
         return status;
     status = request_validation_utils::validate(
         *requestProto,
-        instance.getInputsInfo(),
-        instance.getOutputsInfo(),
+        modelUnloadGuardPtr->getShapeVariant().inputsInfo,
+        modelUnloadGuardPtr->getShapeVariant().outputsInfo,
         instance.getName(),
         instance.getVersion(),
         instance.getOptionalInputNames(),
@@ -249,9 +442,56 @@ Status infer(ModelInstance& instance, const RequestType* requestProto,
     if (!status.ok())
         return status;
 
+    const auto deadline = getEarliestDeadline(requestProto, clientDeadline);
+    // request executes on shape variant it was validated against, even if other request swaps it meanwhile
+    const auto& shapeVariant = modelUnloadGuardPtr->getShapeVariant();
+    // requests which cannot be merged fall through to regular path with tensors already deserialized for the scheduler
+    std::optional<TensorMap> deserializedInputs;
+    auto* dynamicBatchingScheduler = instance.getDynamicBatchingScheduler();
+    if (dynamicBatchingScheduler != nullptr) {
+        timer.start(DESERIALIZE);
+        TensorMap inputs;
+        InputSink<TensorMap&> inputSink(inputs);
+        bool isPipeline = false;
+        status = deserializePredictRequest<ConcreteTensorProtoDeserializator, InputSink<TensorMap&>>(*requestProto, shapeVariant.inputsInfo, shapeVariant.outputsInfo, inputSink, isPipeline, shapeVariant.tensorFactories);
+        timer.stop(DESERIALIZE);
+        if (!status.ok()) {
+            SPDLOG_DEBUG("Deserialization of outputs failed for model {}, version {}", instance.getName(), instance.getVersion());
+            return status;
+        }
+        if (dynamicBatchingScheduler->isBatchable(inputs)) {
+            TensorMap outputs;
+            timer.start(PREDICTION);
+            status = dynamicBatchingScheduler->infer(inputs, outputs, deadline);
+            timer.stop(PREDICTION);
+            if (!status.ok())
+                return status;
+            SPDLOG_DEBUG("Batched prediction duration in model {}, version {}: {:.3f} ms",
+                instance.getName(), instance.getVersion(), timer.elapsed<microseconds>(PREDICTION) / 1000);
+
+            timer.start(SERIALIZE);
+            OutputGetter<TensorMap&> outputGetter(outputs);
+            // batched requests never carry preallocated outputs so request independent serialization is sufficient
+            status = serializePredictResponse(outputGetter, instance.getName(), instance.getVersion(), shapeVariant.outputsInfo, responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
+            timer.stop(SERIALIZE);
+            if (!status.ok())
+                return status;
+            SPDLOG_DEBUG("Serialization duration in model {}, version {}: {:.3f} ms",
+                instance.getName(), instance.getVersion(), timer.elapsed<microseconds>(SERIALIZE) / 1000);
+            return requestProcessor->release();
+        }
+        deserializedInputs = std::move(inputs);
+    }
+
     timer.start(GET_INFER_REQUEST);
     OVMS_PROFILE_SYNC_BEGIN("getInferRequest");
-    ExecutingStreamIdGuard executingStreamIdGuard(instance.getInferRequestsQueue(), instance.getMetricReporter());
+    int streamId;
+    status = instance.acquireInferRequestStream(*shapeVariant.inferRequestsQueue, deadline, streamId);
+    if (!status.ok()) {
+        OVMS_PROFILE_SYNC_END("getInferRequest");
+        return status;
+    }
+    ExecutingStreamIdGuard executingStreamIdGuard(*shapeVariant.inferRequestsQueue, streamId, instance.getMetricReporter());
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-variable"
     int executingInferId = executingStreamIdGuard.getId();
@@ -277,10 +517,18 @@ Status infer(ModelInstance& instance, const RequestType* requestProto,
     bool isPipeline = false;
 
     std::unique_ptr<OutputKeeper> outKeeper;
-    if (instance.doesSupportOutputReset()) {
-        outKeeper = std::make_unique<OutputKeeper>(executingStreamIdGuard.getInferRequest(), instance.getOutputsInfo());
+    if (shapeVariant.supportOutputTensorsReset) {
+        outKeeper = std::make_unique<OutputKeeper>(executingStreamIdGuard.getInferRequest(), shapeVariant.outputsInfo);
+    }
+    if (deserializedInputs.has_value()) {
+        for (auto& [name, tensor] : deserializedInputs.value()) {
+            status = inputSink.give(name, tensor);
+            if (!status.ok())
+                break;
+        }
+    } else {
+        status = deserializePredictRequest<ConcreteTensorProtoDeserializator, InputSink<ov::InferRequest&>>(*requestProto, shapeVariant.inputsInfo, shapeVariant.outputsInfo, inputSink, isPipeline, shapeVariant.tensorFactories);
     }
-    status = deserializePredictRequest<ConcreteTensorProtoDeserializator, InputSink<ov::InferRequest&>>(*requestProto, instance.getInputsInfo(), instance.getOutputsInfo(), inputSink, isPipeline, instance.getTensorFactories());
     timer.stop(DESERIALIZE);
     if (!status.ok()) {
         SPDLOG_DEBUG("Deserialization of outputs failed for model {}, version {}", instance.getName(), instance.getVersion());
@@ -289,17 +537,21 @@ Status infer(ModelInstance& instance, const RequestType* requestProto,
     SPDLOG_DEBUG("Deserialization duration in model {}, version {}, nireq {}: {:.3f} ms",
         instance.getName(), instance.getVersion(), executingInferId, timer.elapsed<microseconds>(DESERIALIZE) / 1000);
 
+    status = instance.checkDeadline(deadline);
+    if (!status.ok())
+        return status;
     timer.start(PREDICTION);
     status = instance.performInference(inferRequest);
     timer.stop(PREDICTION);
     if (!status.ok())
         return status;
+    instance.getAdmissionController().recordServiceTime(timer.elapsed<microseconds>(PREDICTION));
     SPDLOG_DEBUG("Prediction duration in model {}, version {}, nireq {}: {:.3f} ms",
         instance.getName(), instance.getVersion(), executingInferId, timer.elapsed<microseconds>(PREDICTION) / 1000);
 
     timer.start(SERIALIZE);
     OutputGetter<ov::InferRequest&> outputGetter(inferRequest);
-    status = serializePredictResponse(outputGetter, instance.getName(), instance.getVersion(), instance.getOutputsInfo(), requestProto, responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
+    status = serializePredictResponse(outputGetter, instance.getName(), instance.getVersion(), shapeVariant.outputsInfo, requestProto, responseProto, getTensorInfoName, useSharedOutputContentFn(requestProto));
     timer.stop(SERIALIZE);
     if (!status.ok())
         return status;
@@ -38,7 +38,7 @@ OVMS_InferenceRequestCompletionCallback_t getCallback(const KFSRequest* request)
     return nullptr;
 }
 #pragma GCC diagnostic pop
-template Status infer<KFSRequest, KFSResponse>(ModelInstance& instance, const KFSRequest*, KFSResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&);
+template Status infer<KFSRequest, KFSResponse>(ModelInstance& instance, const KFSRequest*, KFSResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&, std::optional<std::chrono::steady_clock::time_point>);
 using TensorMap = std::unordered_map<std::string, ov::Tensor>;
 template class RequestTensorExtractor<KFSRequest, KFSTensorInputProto, ExtractChoice::EXTRACT_INPUT>;
 }  // namespace ovms
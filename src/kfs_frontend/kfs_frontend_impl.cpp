@@ -38,8 +38,9 @@ OVMS_InferenceRequestCompletionCallback_t getCallback(const KFSRequest* request)
     return nullptr;
 }
 #pragma GCC diagnostic pop
-template Status modelInferAsync<KFSRequest, KFSResponse>(ModelInstance& instance, const KFSRequest*, std::unique_ptr<ModelInstanceUnloadGuard>&);
-template Status infer<KFSRequest, KFSResponse>(ModelInstance& instance, const KFSRequest*, KFSResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&);
+template Status modelInferAsync<KFSRequest, KFSResponse>(ModelInstance& instance, const KFSRequest*, std::unique_ptr<ModelInstanceUnloadGuard>&, std::optional<std::chrono::steady_clock::time_point>);
+template Status infer<KFSRequest, KFSResponse>(ModelInstance& instance, const KFSRequest*, KFSResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&, std::optional<std::chrono::steady_clock::time_point>);
+template Status modelInferWithCallback<KFSRequest, KFSResponse>(ModelInstance& instance, const KFSRequest*, KFSResponse*, std::unique_ptr<ModelInstanceUnloadGuard>&, std::function<void(const Status&)>, std::optional<std::chrono::steady_clock::time_point>, std::function<void(std::function<void()>)>);
 
 // TODO @atobisze use from dags?
 using TensorMap = std::unordered_map<std::string, ov::Tensor>;
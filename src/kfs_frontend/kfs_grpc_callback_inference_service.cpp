@@ -0,0 +1,173 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "kfs_grpc_callback_inference_service.hpp"
+
+#include <chrono>
+#include <exception>
+#include <string>
+#include <utility>
+
+#include "../execution_context.hpp"
+#include "../grpc_utils.hpp"
+#include "../logging.hpp"
+#include "../model_metric_reporter.hpp"
+#include "../profiler.hpp"
+#include "../status.hpp"
+#include "src/metrics/metric.hpp"
+
+namespace ovms {
+
+KFSCallbackInferenceService::KFSCallbackInferenceService(KFSInferenceServiceImpl& impl) :
+    impl(impl) {}
+
+KFSCallbackInferenceService::~KFSCallbackInferenceService() {
+    shutdownWorkers();
+}
+
+void KFSCallbackInferenceService::startWorkers(uint32_t workersCount, size_t maxQueuedJobs) {
+    std::unique_lock<std::mutex> lock(jobsMtx);
+    stopWorkers = false;
+    this->maxQueuedJobs = maxQueuedJobs;
+    SPDLOG_DEBUG("Starting {} gRPC ModelInfer workers with limit of {} queued requests", workersCount, maxQueuedJobs);
+    for (uint32_t i = 0; i < workersCount; ++i) {
+        workers.emplace_back(&KFSCallbackInferenceService::workerLoop, this);
+    }
+}
+
+void KFSCallbackInferenceService::shutdownWorkers() {
+    {
+        std::unique_lock<std::mutex> lock(jobsMtx);
+        stopWorkers = true;
+    }
+    jobsCv.notify_all();
+    for (auto& worker : workers) {
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+    workers.clear();
+}
+
+void KFSCallbackInferenceService::workerLoop() {
+    while (true) {
+        std::function<void()> job;
+        {
+            std::unique_lock<std::mutex> lock(jobsMtx);
+            jobsCv.wait(lock, [this] { return stopWorkers || !continuations.empty() || !jobs.empty(); });
+            // requests holding infer request are started first
+            auto& source = continuations.empty() ? jobs : continuations;
+            if (source.empty()) {
+                return;
+            }
+            job = std::move(source.front());
+            source.pop();
+        }
+        job();
+    }
+}
+
+bool KFSCallbackInferenceService::tryDispatch(std::function<void()> job) {
+    {
+        std::unique_lock<std::mutex> lock(jobsMtx);
+        if (!workers.empty() && !stopWorkers) {
+            if (jobs.size() >= maxQueuedJobs) {
+                return false;
+            }
+            jobs.push(std::move(job));
+            jobsCv.notify_one();
+            return true;
+        }
+    }
+    // without workers (gRPC server not started by module) request is processed in calling thread
+    job();
+    return true;
+}
+
+void KFSCallbackInferenceService::dispatchContinuation(std::function<void()> job) {
+    {
+        std::unique_lock<std::mutex> lock(jobsMtx);
+        if (!workers.empty() && !stopWorkers) {
+            continuations.push(std::move(job));
+            jobsCv.notify_one();
+            return;
+        }
+    }
+    // processed in thread which returned infer request
+    job();
+}
+
+::grpc::Status KFSCallbackInferenceService::ServerLive(::grpc::ServerContext* context, const ::inference::ServerLiveRequest* request, ::inference::ServerLiveResponse* response) {
+    return impl.ServerLive(context, request, response);
+}
+
+::grpc::Status KFSCallbackInferenceService::ServerReady(::grpc::ServerContext* context, const ::inference::ServerReadyRequest* request, ::inference::ServerReadyResponse* response) {
+    return impl.ServerReady(context, request, response);
+}
+
+::grpc::Status KFSCallbackInferenceService::ModelReady(::grpc::ServerContext* context, const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response) {
+    return impl.ModelReady(context, request, response);
+}
+
+::grpc::Status KFSCallbackInferenceService::ServerMetadata(::grpc::ServerContext* context, const KFSServerMetadataRequest* request, KFSServerMetadataResponse* response) {
+    return impl.ServerMetadata(context, request, response);
+}
+
+::grpc::Status KFSCallbackInferenceService::ModelMetadata(::grpc::ServerContext* context, const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response) {
+    return impl.ModelMetadata(context, request, response);
+}
+
+::grpc::Status KFSCallbackInferenceService::ModelStreamInfer(::grpc::ServerContext* context, ::grpc::ServerReaderWriter<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream) {
+    return impl.ModelStreamInfer(context, stream);
+}
+
+::grpc::ServerUnaryReactor* KFSCallbackInferenceService::ModelInfer(::grpc::CallbackServerContext* context, const KFSRequest* request, KFSResponse* response) {
+    OVMS_PROFILE_FUNCTION();
+    ::grpc::ServerUnaryReactor* reactor = context->DefaultReactor();
+    SPDLOG_DEBUG("Processing gRPC request for model: {}; version: {}",
+        request->model_name(),
+        request->model_version());
+    const auto start = std::chrono::steady_clock::now();
+    const bool dispatched = tryDispatch([this, context, request, response, reactor, start]() {
+        const std::string servableName = request->model_name();
+        try {
+            impl.ModelInferWithCallbackImpl(
+                context, request, response, ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer},
+                [reactor, start](const Status& status, ServableMetricReporter* reporter) {
+                    double requestTotal = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+                    SPDLOG_DEBUG("Total gRPC request processing time: {} ms", requestTotal / 1000);
+                    // There is no request time metric for MediaPipe endpoints
+                    if (status.ok() && reporter) {
+                        OBSERVE_IF_ENABLED(reporter->requestTimeGrpc, requestTotal);
+                    }
+                    reactor->Finish(grpc(status));
+                },
+                [this](std::function<void()> job) { dispatchContinuation(std::move(job)); });
+        } catch (const std::exception& e) {
+            SPDLOG_ERROR("Caught exception in InferenceServiceImpl for servable: {} exception: {}", servableName, e.what());
+            reactor->Finish(grpc(Status(StatusCode::UNKNOWN_ERROR, e.what())));
+        } catch (...) {
+            SPDLOG_ERROR("Caught unknown exception in InferenceServiceImpl for servable: {}", servableName);
+            reactor->Finish(grpc(Status(StatusCode::UNKNOWN_ERROR)));
+        }
+    });
+    if (!dispatched) {
+        Status status(StatusCode::SERVABLE_OVERLOADED, "too many requests waiting for gRPC worker");
+        SPDLOG_DEBUG("Rejecting gRPC request for model: {}; version: {}: {}", request->model_name(), request->model_version(), status.string());
+        reactor->Finish(grpc(status));
+    }
+    return reactor;
+}
+}  // namespace ovms
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/server_context.h>
+#include <grpcpp/support/server_callback.h>
+
+#include "kfs_grpc_inference_service.hpp"
+#include "kfs_utils.hpp"
+#include "src/kfserving_api/grpc_predict_v2.grpc.pb.h"
+#include "src/kfserving_api/grpc_predict_v2.pb.h"
+
+namespace ovms {
+/**
+ * @brief KServe gRPC service exposed by gRPC server
+ *
+ * ModelInfer uses gRPC callback API and is finished from OpenVINO infer request
+ * completion callback, so in-flight single model inferences do not occupy gRPC threads.
+ * Work which may block (model reload, DAG, MediaPipe graph and dynamic batching execution)
+ * is dispatched to service workers, never run on gRPC reactor thread. Requests are rejected with
+ * RESOURCE_EXHAUSTED when the number of requests waiting for a worker exceeds the limit.
+ * Single model requests do not hold a worker while waiting for idle infer request, their inference
+ * is started by a worker once the infer request is returned, before requests waiting for a worker.
+ * Remaining methods are served synchronously by KFSInferenceServiceImpl.
+ */
+class KFSCallbackInferenceService : public GRPCInferenceService::WithCallbackMethod_ModelInfer<GRPCInferenceService::Service> {
+    KFSInferenceServiceImpl& impl;
+
+    std::vector<std::thread> workers;
+    std::queue<std::function<void()>> jobs;
+    // inference of requests which already got infer request, never limited since bounded by number of infer requests
+    std::queue<std::function<void()>> continuations;
+    size_t maxQueuedJobs = 0;
+    std::mutex jobsMtx;
+    std::condition_variable jobsCv;
+    bool stopWorkers = false;
+
+    void workerLoop();
+    /**
+     * @return false if job was rejected since limit of queued jobs is reached
+     */
+    bool tryDispatch(std::function<void()> job);
+    void dispatchContinuation(std::function<void()> job);
+
+public:
+    static constexpr size_t QUEUED_JOBS_PER_WORKER = 64;
+
+    KFSCallbackInferenceService(KFSInferenceServiceImpl& impl);
+    ~KFSCallbackInferenceService();
+    void startWorkers(uint32_t workersCount, size_t maxQueuedJobs);
+    /**
+     * @brief Finishes already dispatched jobs and joins workers. Has to be called after gRPC servers are shut down
+     */
+    void shutdownWorkers();
+    ::grpc::Status ServerLive(::grpc::ServerContext* context, const ::inference::ServerLiveRequest* request, ::inference::ServerLiveResponse* response) override;
+    ::grpc::Status ServerReady(::grpc::ServerContext* context, const ::inference::ServerReadyRequest* request, ::inference::ServerReadyResponse* response) override;
+    ::grpc::Status ModelReady(::grpc::ServerContext* context, const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response) override;
+    ::grpc::Status ServerMetadata(::grpc::ServerContext* context, const KFSServerMetadataRequest* request, KFSServerMetadataResponse* response) override;
+    ::grpc::Status ModelMetadata(::grpc::ServerContext* context, const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response) override;
+    ::grpc::ServerUnaryReactor* ModelInfer(::grpc::CallbackServerContext* context, const KFSRequest* request, KFSResponse* response) override;
+    ::grpc::Status ModelStreamInfer(::grpc::ServerContext* context, ::grpc::ServerReaderWriter<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream) override;
+};
+}  // namespace ovms
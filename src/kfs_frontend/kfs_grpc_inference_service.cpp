@@ -15,11 +15,14 @@
 //*****************************************************************************
 #include "kfs_grpc_inference_service.hpp"
 
+#include <chrono>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "deserialization.hpp"
@@ -62,7 +65,18 @@ enum : unsigned int {
     TOTAL,
     TIMER_END
 };
+
+std::optional<std::chrono::steady_clock::time_point> getClientDeadline(const ::grpc::ServerContextBase* context) {
+    if (context == nullptr) {
+        return std::nullopt;
+    }
+    const auto deadline = context->deadline();
+    if (deadline == std::chrono::system_clock::time_point::max()) {
+        return std::nullopt;
+    }
+    return std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(deadline - std::chrono::system_clock::now());
 }
+}  // namespace
 
 namespace ovms {
 
@@ -277,7 +291,7 @@ Status KFSInferenceServiceImpl::ModelMetadataImpl(::grpc::ServerContext* context
     return grpc(ModelStreamInferImpl(context, stream));
 }
 
-Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) {
+Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContextBase* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut) {
     OVMS_PROFILE_FUNCTION();
     std::shared_ptr<ovms::ModelInstance> modelInstance;
     std::unique_ptr<ovms::Pipeline> pipelinePtr;
@@ -315,7 +329,7 @@ Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, c
         status = pipelinePtr->execute(executionContext);
     } else if (modelInstance) {
         reporterOut = &modelInstance->getMetricReporter();
-        status = infer(*modelInstance, request, response, modelInstanceUnloadGuard);
+        status = infer(*modelInstance, request, response, modelInstanceUnloadGuard, getClientDeadline(context));
     }
     INCREMENT_IF_ENABLED(reporterOut->getInferRequestMetric(executionContext, status.ok()));
     if (!status.ok()) {
@@ -325,6 +339,36 @@ Status KFSInferenceServiceImpl::ModelInferImpl(::grpc::ServerContext* context, c
     return StatusCode::OK;
 }
 
+void KFSInferenceServiceImpl::ModelInferWithCallbackImpl(::grpc::ServerContextBase* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, std::function<void(const Status&, ServableMetricReporter*)> onComplete, std::function<void(std::function<void()>)> scheduleOnStreamReady) {
+    OVMS_PROFILE_FUNCTION();
+    std::shared_ptr<ovms::ModelInstance> modelInstance;
+    std::unique_ptr<ModelInstanceUnloadGuard> modelInstanceUnloadGuard;
+    SPDLOG_DEBUG("ModelInfer with callback requested name: {}, version: {}", request->model_name(), request->model_version());
+    auto status = getModelInstance(request, modelInstance, modelInstanceUnloadGuard);
+    if (!status.ok() || modelInstance->getDynamicBatchingScheduler() != nullptr) {
+        // pipelines, mediapipe graphs and batched models are executed synchronously in calling service worker thread
+        modelInstanceUnloadGuard.reset();
+        ServableMetricReporter* reporter = nullptr;
+        status = ModelInferImpl(context, request, response, executionContext, reporter);
+        onComplete(status, reporter);
+        return;
+    }
+    ServableMetricReporter* reporter = &modelInstance->getMetricReporter();
+    status = modelInferWithCallback(*modelInstance, request, response, modelInstanceUnloadGuard,
+        [request, response, executionContext, reporter, onComplete](const Status& status) {
+            INCREMENT_IF_ENABLED(reporter->getInferRequestMetric(executionContext, status.ok()));
+            if (status.ok()) {
+                response->set_id(request->id());
+            }
+            onComplete(status, reporter);
+        },
+        getClientDeadline(context), std::move(scheduleOnStreamReady));
+    if (!status.ok()) {
+        INCREMENT_IF_ENABLED(reporter->getInferRequestMetric(executionContext, status.ok()));
+        onComplete(status, reporter);
+    }
+}
+
 Status KFSInferenceServiceImpl::ModelStreamInferImpl(::grpc::ServerContext* context, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, KFSRequest>* serverReaderWriter) {
     OVMS_PROFILE_FUNCTION();
 #if (MEDIAPIPE_DISABLE == 0)
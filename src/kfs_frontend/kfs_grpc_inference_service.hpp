@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <string>
 #include <utility>
@@ -54,7 +55,16 @@ public:
     Status ModelReadyImpl(::grpc::ServerContext* context, const KFSGetModelStatusRequest* request, KFSGetModelStatusResponse* response, ExecutionContext executionContext);
     Status ServerMetadataImpl(::grpc::ServerContext* context, const KFSServerMetadataRequest* request, KFSServerMetadataResponse* response);
     Status ModelMetadataImpl(::grpc::ServerContext* context, const KFSModelMetadataRequest* request, KFSModelMetadataResponse* response, ExecutionContext executionContext, KFSModelExtraMetadata& extraMetadata);
-    Status ModelInferImpl(::grpc::ServerContext* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut);
+    Status ModelInferImpl(::grpc::ServerContextBase* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, ServableMetricReporter*& reporterOut);
+    /**
+     * @brief Runs ModelInfer without blocking calling thread for single model inference
+     *
+     * onComplete is always called exactly once - either from OpenVINO completion callback or,
+     * for DAGs, MediaPipe graphs and failed requests, before this function returns.
+     * When no infer request is idle, single model inference is started by job passed to scheduleOnStreamReady
+     * once infer request is returned.
+     */
+    void ModelInferWithCallbackImpl(::grpc::ServerContextBase* context, const KFSRequest* request, KFSResponse* response, ExecutionContext executionContext, std::function<void(const Status&, ServableMetricReporter*)> onComplete, std::function<void(std::function<void()>)> scheduleOnStreamReady = {});
     Status ModelStreamInferImpl(::grpc::ServerContext* context, ::grpc::ServerReaderWriterInterface<::inference::ModelStreamInferResponse, ::inference::ModelInferRequest>* stream);
     KFSInferenceServiceImpl(const Server& server);
     ::grpc::Status ServerLive(::grpc::ServerContext* context, const ::inference::ServerLiveRequest* request, ::inference::ServerLiveResponse* response) override;
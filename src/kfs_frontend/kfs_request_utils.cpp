@@ -55,6 +55,20 @@ std::map<std::string, shape_t> getRequestShapes(const ::KFSRequest* request) {
     }
     return requestShapes;
 }
+const std::string INFERENCE_TIMEOUT_PARAMETER_NAME = "inference_timeout";
+
+std::optional<std::chrono::steady_clock::time_point> getRequestDeadline(const ::KFSRequest* request) {
+    auto it = request->parameters().find(INFERENCE_TIMEOUT_PARAMETER_NAME);
+    if (it == request->parameters().end()) {
+        return std::nullopt;
+    }
+    if (it->second.parameter_choice_case() != inference::InferParameter::ParameterChoiceCase::kInt64Param || it->second.int64_param() <= 0) {
+        SPDLOG_DEBUG("Ignoring {} parameter in request for: {}; it should be positive int64", INFERENCE_TIMEOUT_PARAMETER_NAME, request->model_name());
+        return std::nullopt;
+    }
+    return std::chrono::steady_clock::now() + std::chrono::microseconds(it->second.int64_param());
+}
+
 bool useSharedOutputContentFn(const ::KFSRequest* request) {
     return true;
 }
@@ -14,8 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 #pragma once
+#include <chrono>
 #include <map>
 #include <memory>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -29,6 +31,12 @@ namespace ovms {
 std::optional<Dimension> getRequestBatchSize(const ::KFSRequest* request, const size_t batchSizeIndex);
 std::map<std::string, shape_t> getRequestShapes(const ::KFSRequest* request);
 
+extern const std::string INFERENCE_TIMEOUT_PARAMETER_NAME;
+/**
+ * Deadline requested with int64 inference_timeout parameter in microseconds, counted from now.
+ */
+std::optional<std::chrono::steady_clock::time_point> getRequestDeadline(const ::KFSRequest* request);
+
 template <>
 class RequestTensorExtractor<KFSRequest, KFSTensorInputProto, ExtractChoice::EXTRACT_OUTPUT> {
 public:
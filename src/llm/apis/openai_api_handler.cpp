@@ -525,6 +525,23 @@ absl::Status OpenAIApiHandler::parseCommonPart(std::optional<uint32_t> maxTokens
         request.ignoreEOS = it->value.GetBool();
     }
 
+    // priority: string; optional
+    // Extension, unsupported by OpenAI API. Selects priority class configured in the graph
+    it = doc.FindMember("priority");
+    if (it != doc.MemberEnd() && !it->value.IsNull()) {
+        if (!it->value.IsString())
+            return absl::InvalidArgumentError("priority is not a string");
+        request.priority = it->value.GetString();
+    }
+
+    // user: string; optional
+    it = doc.FindMember("user");
+    if (it != doc.MemberEnd() && !it->value.IsNull()) {
+        if (!it->value.IsString())
+            return absl::InvalidArgumentError("user is not a string");
+        request.user = it->value.GetString();
+    }
+
     // max_tokens: uint; optional
     // Common part checked here, specific parts are checked in parseCompletionsPart and parseChatCompletionsPart
     // TODO: Deprecated - this will need to be removed in the future
@@ -81,6 +81,12 @@ struct OpenAIRequest {
 
     bool skipSpecialTokens{true};
 
+    // Admission scheduling specific
+    // Priority class name, extension unsupported by OpenAI API
+    std::optional<std::string> priority{std::nullopt};
+    // End-user identifier, requests of the same user are treated as single tenant
+    std::optional<std::string> user{std::nullopt};
+
     // Audio output (Omni pipeline)
     enum class AudioFormat { WAV,
         PCM16 };
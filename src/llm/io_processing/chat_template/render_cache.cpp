@@ -0,0 +1,102 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "render_cache.hpp"
+
+#include <utility>
+
+#include "../../../metrics/metric.hpp"
+#include "../../../model_metric_reporter.hpp"
+
+namespace ovms {
+
+ChatTemplateRenderCache::ChatTemplateRenderCache(size_t capacityBytes) :
+    capacityBytes(capacityBytes) {}
+
+bool ChatTemplateRenderCache::get(const std::string& requestBody, std::string& output) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto it = entriesByBody.find(requestBody);
+    if (it == entriesByBody.end()) {
+        misses++;
+        if (metricReporter) {
+            INCREMENT_IF_ENABLED(metricReporter->chatTemplateCacheMisses);
+        }
+        return false;
+    }
+    entries.splice(entries.begin(), entries, it->second);
+    output = it->second->output;
+    hits++;
+    renderTimeSaved += it->second->renderTime;
+    if (metricReporter) {
+        INCREMENT_IF_ENABLED(metricReporter->chatTemplateCacheHits);
+        if (metricReporter->chatTemplateRenderTimeSaved) {
+            metricReporter->chatTemplateRenderTimeSaved->increment(it->second->renderTime.count());
+        }
+    }
+    return true;
+}
+
+void ChatTemplateRenderCache::put(const std::string& requestBody, const std::string& output, std::chrono::microseconds renderTime) {
+    const size_t entrySize = requestBody.size() + output.size();
+    if (entrySize > capacityBytes) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(mtx);
+    // concurrent requests with the same body may render it at the same time
+    if (entriesByBody.find(requestBody) != entriesByBody.end()) {
+        return;
+    }
+    while (sizeBytes + entrySize > capacityBytes) {
+        const Entry& leastRecentlyUsed = entries.back();
+        sizeBytes -= leastRecentlyUsed.requestBody.size() + leastRecentlyUsed.output.size();
+        entriesByBody.erase(leastRecentlyUsed.requestBody);
+        entries.pop_back();
+    }
+    entries.push_front(Entry{requestBody, output, renderTime});
+    entriesByBody.emplace(entries.front().requestBody, entries.begin());
+    sizeBytes += entrySize;
+}
+
+size_t ChatTemplateRenderCache::getEntriesCount() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return entries.size();
+}
+
+size_t ChatTemplateRenderCache::getSizeBytes() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return sizeBytes;
+}
+
+size_t ChatTemplateRenderCache::getHits() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return hits;
+}
+
+size_t ChatTemplateRenderCache::getMisses() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return misses;
+}
+
+std::chrono::microseconds ChatTemplateRenderCache::getRenderTimeSaved() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return renderTimeSaved;
+}
+
+void ChatTemplateRenderCache::setMetricReporter(std::shared_ptr<LLMNodeMetricReporter> reporter) {
+    std::unique_lock<std::mutex> lock(mtx);
+    metricReporter = std::move(reporter);
+}
+
+}  // namespace ovms
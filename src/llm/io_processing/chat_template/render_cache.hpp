@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace ovms {
+
+class LLMNodeMetricReporter;
+
+/**
+ * @brief Bounded LRU cache of prompts rendered by Python Jinja chat template.
+ *
+ * Key is the template input serialized by ChatTemplateProcessor - messages, tools and chat template kwargs,
+ * without sampling parameters and with whitespace normalized by serialization. Only exact matches are served,
+ * since templates may render any message depending on the rest of conversation (e.g. last message checks,
+ * loop indices, default system prompt). Least recently used entries are evicted when total size of keys and
+ * rendered prompts exceeds capacity, single entry larger than capacity is not cached.
+ */
+class ChatTemplateRenderCache {
+    struct Entry {
+        std::string requestBody;
+        std::string output;
+        std::chrono::microseconds renderTime;
+    };
+
+    const size_t capacityBytes;
+    mutable std::mutex mtx;
+    // most recently used first
+    std::list<Entry> entries;
+    // keys point to requestBody of entries
+    std::unordered_map<std::string_view, std::list<Entry>::iterator> entriesByBody;
+    size_t sizeBytes = 0;
+    size_t hits = 0;
+    size_t misses = 0;
+    std::chrono::microseconds renderTimeSaved{0};
+    std::shared_ptr<LLMNodeMetricReporter> metricReporter;
+
+public:
+    explicit ChatTemplateRenderCache(size_t capacityBytes);
+
+    // Returns true and sets output when the same request body was rendered before, counts hit or miss
+    bool get(const std::string& requestBody, std::string& output);
+
+    // Stores output rendered from request body, renderTime is counted as saved on each subsequent hit
+    void put(const std::string& requestBody, const std::string& output, std::chrono::microseconds renderTime);
+
+    size_t getEntriesCount() const;
+    size_t getSizeBytes() const;
+    size_t getHits() const;
+    size_t getMisses() const;
+    std::chrono::microseconds getRenderTimeSaved() const;
+
+    void setMetricReporter(std::shared_ptr<LLMNodeMetricReporter> reporter);
+};
+
+}  // namespace ovms
@@ -69,7 +69,7 @@ InputProcessor::InputProcessor(InputProcessorContext& context,
         // (shouldn't happen on a properly initialized servable), fall back to the native path.
         if (!context.config.useMinja && context.templateProcessor != nullptr) {
             processors.emplace_back(std::make_unique<ChatTemplateProcessor>(
-                context.tokenizer, *context.templateProcessor));
+                context.tokenizer, *context.templateProcessor, context.renderCache));
         } else {
             processors.emplace_back(std::make_unique<ChatTemplateProcessor>(context.tokenizer));
         }
@@ -23,6 +23,7 @@
 #include "input_processing_config.hpp"
 #if (PYTHON_DISABLE == 0)
 #include "../py_jinja_template_processor.hpp"
+#include "chat_template/render_cache.hpp"
 #endif
 
 namespace ovms {
@@ -35,6 +36,8 @@ struct InputProcessorContext {
     ov::genai::Tokenizer tokenizer;
 #if (PYTHON_DISABLE == 0)
     PyJinjaTemplateProcessor* templateProcessor = nullptr;
+    // nullptr when rendered prompts are not cached
+    ChatTemplateRenderCache* renderCache = nullptr;
 #endif
 };
 
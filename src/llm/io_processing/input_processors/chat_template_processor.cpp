@@ -16,6 +16,7 @@
 
 #include "chat_template_processor.hpp"
 
+#include <chrono>
 #include <optional>
 #include <string>
 #include <utility>
@@ -27,9 +28,10 @@ namespace ovms {
 
 #if (PYTHON_DISABLE == 0)
 ChatTemplateProcessor::ChatTemplateProcessor(ov::genai::Tokenizer& tokenizer,
-    PyJinjaTemplateProcessor& templateProcessor) :
+    PyJinjaTemplateProcessor& templateProcessor, ChatTemplateRenderCache* renderCache) :
     tokenizer(tokenizer),
-    templateProcessor(templateProcessor) {}
+    templateProcessor(templateProcessor),
+    renderCache(renderCache) {}
 
 ChatTemplateProcessor::ChatTemplateProcessor(ov::genai::Tokenizer& tokenizer) :
     tokenizer(tokenizer),
@@ -89,10 +91,20 @@ absl::Status ChatTemplateProcessor::process(InputRequest& req) {
     if (templateProcessor.has_value()) {
         const std::string jsonBody = serializeForPyJinja(chatHistory);
         std::string promptText;
-        const bool success = PyJinjaTemplateProcessor::applyChatTemplate(
-            templateProcessor.value().get(), jsonBody, promptText);
-        if (!success) {
-            return absl::Status(absl::StatusCode::kInvalidArgument, promptText);
+        // Serialized template input is the cache key, rendering depends only on it and the loaded template
+        if (renderCache != nullptr && renderCache->get(jsonBody, promptText)) {
+            SPDLOG_LOGGER_TRACE(llm_calculator_logger, "Using prompt from rendered chat template cache");
+        } else {
+            const auto renderStart = std::chrono::steady_clock::now();
+            const bool success = PyJinjaTemplateProcessor::applyChatTemplate(
+                templateProcessor.value().get(), jsonBody, promptText);
+            if (!success) {
+                return absl::Status(absl::StatusCode::kInvalidArgument, promptText);
+            }
+            if (renderCache != nullptr) {
+                renderCache->put(jsonBody, promptText,
+                    std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - renderStart));
+            }
         }
         req.promptText = std::move(promptText);
     } else {
@@ -25,6 +25,7 @@
 
 #if (PYTHON_DISABLE == 0)
 #include "../../py_jinja_template_processor.hpp"
+#include "../chat_template/render_cache.hpp"
 #endif
 
 namespace ovms {
@@ -40,8 +41,9 @@ class ChatTemplateProcessor : public BaseInputProcessor {
 public:
 #if (PYTHON_DISABLE == 0)
     // PyJinja path: templateProcessor must be valid (guaranteed by non-null reference param).
+    // Prompts are looked up in renderCache before rendering when it is set.
     ChatTemplateProcessor(ov::genai::Tokenizer& tokenizer,
-        PyJinjaTemplateProcessor& templateProcessor);
+        PyJinjaTemplateProcessor& templateProcessor, ChatTemplateRenderCache* renderCache = nullptr);
     // Minja / native-OV path: no PyJinja processor needed.
     explicit ChatTemplateProcessor(ov::genai::Tokenizer& tokenizer);
 #else
@@ -61,6 +63,7 @@ private:
 #if (PYTHON_DISABLE == 0)
     // Present only on the PyJinja path; nullopt → use tokenizer.apply_chat_template().
     std::optional<std::reference_wrapper<PyJinjaTemplateProcessor>> templateProcessor;
+    ChatTemplateRenderCache* renderCache = nullptr;  // non-owning; lifetime tied to servable properties
     // Serialises chatHistory to {"messages":[...], "tools":[...], "chat_template_kwargs":{...}}
     // for the Python Jinja template engine.
     static std::string serializeForPyJinja(const ov::genai::ChatHistory& chatHistory);
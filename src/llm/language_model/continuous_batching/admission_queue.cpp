@@ -0,0 +1,229 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "admission_queue.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace ovms {
+
+const std::string LLMAdmissionQueue::DEFAULT_PRIORITY_CLASS = "default";
+
+// share of the limit proportional to class weight, rounded up so that each class can queue at least one request
+static size_t classLimit(size_t limit, uint32_t weight, uint64_t weightsSum) {
+    if (limit == 0) {
+        return 0;
+    }
+    return (limit * weight + weightsSum - 1) / weightsSum;
+}
+
+LLMAdmissionQueue::LLMAdmissionQueue(const LLMAdmissionLimits& limits) :
+    limits(limits) {
+    std::vector<LLMPriorityClass> priorityClasses = limits.priorityClasses;
+    if (priorityClasses.empty()) {
+        priorityClasses.push_back({DEFAULT_PRIORITY_CLASS, 1});
+    }
+    uint64_t weightsSum = 0;
+    for (const auto& priorityClass : priorityClasses) {
+        weightsSum += std::max<uint32_t>(priorityClass.weight, 1);
+    }
+    for (const auto& priorityClass : priorityClasses) {
+        const uint32_t weight = std::max<uint32_t>(priorityClass.weight, 1);
+        ClassQueue classQueue;
+        classQueue.stride = STRIDE / weight;
+        classQueue.maxWaitingRequests = classLimit(limits.maxWaitingRequests, weight, weightsSum);
+        classQueue.maxWaitingPromptTokens = classLimit(limits.maxWaitingPromptTokens, weight, weightsSum);
+        classQueues.emplace_back(priorityClass.name, std::move(classQueue));
+    }
+    defaultPriorityClass = priorityClasses.front().name;
+}
+
+LLMAdmissionQueue::ClassQueue* LLMAdmissionQueue::findClassQueue(const std::string& priorityClass) {
+    for (auto& [name, classQueue] : classQueues) {
+        if (name == priorityClass) {
+            return &classQueue;
+        }
+    }
+    return nullptr;
+}
+
+bool LLMAdmissionQueue::hasPriorityClass(const std::string& priorityClass) const {
+    return std::any_of(classQueues.begin(), classQueues.end(), [&priorityClass](const auto& entry) { return entry.first == priorityClass; });
+}
+
+bool LLMAdmissionQueue::canAdmitLocked(size_t promptTokens) const {
+    if (freeSlots == 0) {
+        return false;
+    }
+    // first request of the step is admitted even when its prompt alone exceeds the budget
+    if (limits.maxWaitingPromptTokens > 0 && stepAdmittedPromptTokens > 0 && stepAdmittedPromptTokens + promptTokens > limits.maxWaitingPromptTokens) {
+        return false;
+    }
+    // cache usage of idle pipeline is not checked since it may be held by prefix cache
+    if (pipelineEmpty) {
+        return true;
+    }
+    if (unscheduledRequests > 0) {
+        return false;
+    }
+    return limits.maxCacheUsage == 0 || cacheUsage < limits.maxCacheUsage;
+}
+
+void LLMAdmissionQueue::chargeLocked(ClassQueue& classQueue) {
+    // class which was idle does not get credit for the time it was not competing
+    classQueue.pass = std::max(classQueue.pass, virtualTime);
+    virtualTime = classQueue.pass;
+    classQueue.pass += classQueue.stride;
+}
+
+void LLMAdmissionQueue::admitLocked(const std::shared_ptr<Ticket>& ticket) {
+    ticket->admitted = true;
+    stepAdmittedPromptTokens += ticket->promptTokens;
+    if (freeSlots != std::numeric_limits<size_t>::max()) {
+        --freeSlots;
+    }
+}
+
+size_t LLMAdmissionQueue::admitWaitingLocked() {
+    size_t admittedCount = 0;
+    while (waitingRequests > 0) {
+        ClassQueue* selected = nullptr;
+        for (auto& [name, classQueue] : classQueues) {
+            if (classQueue.waitingRequests > 0 && (selected == nullptr || std::max(classQueue.pass, virtualTime) < std::max(selected->pass, virtualTime))) {
+                selected = &classQueue;
+            }
+        }
+        auto tenantIt = selected->tenantQueues.find(selected->tenantOrder.front());
+        auto ticket = tenantIt->second.front();
+        // shorter requests are not let ahead, so that the next one in fair order is not starved
+        if (!canAdmitLocked(ticket->promptTokens)) {
+            break;
+        }
+        selected->tenantOrder.pop_front();
+        tenantIt->second.pop_front();
+        if (tenantIt->second.empty()) {
+            selected->tenantQueues.erase(tenantIt);
+        } else {
+            selected->tenantOrder.push_back(ticket->tenant);
+        }
+        selected->waitingRequests--;
+        selected->waitingPromptTokens -= ticket->promptTokens;
+        waitingRequests--;
+        waitingPromptTokens -= ticket->promptTokens;
+        chargeLocked(*selected);
+        admitLocked(ticket);
+        ++admittedCount;
+    }
+    if (admittedCount > 0) {
+        admittedCv.notify_all();
+    }
+    return admittedCount;
+}
+
+std::shared_ptr<LLMAdmissionQueue::Ticket> LLMAdmissionQueue::enqueue(size_t promptTokens, const std::string& priorityClass, const std::string& tenant) {
+    std::unique_lock<std::mutex> lock(mtx);
+    ClassQueue* classQueue = findClassQueue(priorityClass);
+    if (classQueue == nullptr) {
+        return nullptr;
+    }
+    auto ticket = std::make_shared<Ticket>(promptTokens, priorityClass, tenant);
+    if (waitingRequests == 0 && canAdmitLocked(promptTokens)) {
+        chargeLocked(*classQueue);
+        admitLocked(ticket);
+        return ticket;
+    }
+    if (classQueue->maxWaitingRequests > 0 && classQueue->waitingRequests >= classQueue->maxWaitingRequests) {
+        return nullptr;
+    }
+    // single request longer than the limit is accepted to empty queue, otherwise it could never be served
+    if (classQueue->maxWaitingPromptTokens > 0 && classQueue->waitingRequests > 0 && classQueue->waitingPromptTokens + promptTokens > classQueue->maxWaitingPromptTokens) {
+        return nullptr;
+    }
+    auto& tenantQueue = classQueue->tenantQueues[tenant];
+    if (tenantQueue.empty()) {
+        classQueue->tenantOrder.push_back(tenant);
+    }
+    tenantQueue.push_back(ticket);
+    classQueue->waitingRequests++;
+    classQueue->waitingPromptTokens += promptTokens;
+    waitingRequests++;
+    waitingPromptTokens += promptTokens;
+    return ticket;
+}
+
+bool LLMAdmissionQueue::waitForAdmission(const std::shared_ptr<Ticket>& ticket) {
+    std::unique_lock<std::mutex> lock(mtx);
+    admittedCv.wait(lock, [&ticket] { return ticket->admitted || ticket->cancelled; });
+    return ticket->admitted;
+}
+
+bool LLMAdmissionQueue::waitForAdmission(const std::shared_ptr<Ticket>& ticket, std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(mtx);
+    admittedCv.wait_for(lock, timeout, [&ticket] { return ticket->admitted || ticket->cancelled; });
+    return ticket->admitted;
+}
+
+void LLMAdmissionQueue::cancel(const std::shared_ptr<Ticket>& ticket) {
+    std::unique_lock<std::mutex> lock(mtx);
+    ClassQueue* classQueue = findClassQueue(ticket->priorityClass);
+    if (classQueue == nullptr) {
+        return;
+    }
+    auto tenantIt = classQueue->tenantQueues.find(ticket->tenant);
+    if (tenantIt == classQueue->tenantQueues.end()) {
+        return;
+    }
+    auto& tenantQueue = tenantIt->second;
+    auto it = std::find(tenantQueue.begin(), tenantQueue.end(), ticket);
+    if (it == tenantQueue.end()) {
+        return;
+    }
+    tenantQueue.erase(it);
+    if (tenantQueue.empty()) {
+        classQueue->tenantQueues.erase(tenantIt);
+        classQueue->tenantOrder.erase(std::find(classQueue->tenantOrder.begin(), classQueue->tenantOrder.end(), ticket->tenant));
+    }
+    classQueue->waitingRequests--;
+    classQueue->waitingPromptTokens -= ticket->promptTokens;
+    waitingRequests--;
+    waitingPromptTokens -= ticket->promptTokens;
+    ticket->cancelled = true;
+    admittedCv.notify_all();
+}
+
+size_t LLMAdmissionQueue::updatePipelineState(size_t requests, size_t scheduledRequests, float cacheUsage) {
+    std::unique_lock<std::mutex> lock(mtx);
+    this->pipelineEmpty = (requests == 0);
+    this->unscheduledRequests = requests > scheduledRequests ? requests - scheduledRequests : 0;
+    this->cacheUsage = cacheUsage;
+    this->stepAdmittedPromptTokens = 0;
+    if (limits.maxPipelineRequests > 0) {
+        this->freeSlots = limits.maxPipelineRequests > requests ? limits.maxPipelineRequests - requests : 0;
+    }
+    return admitWaitingLocked();
+}
+
+size_t LLMAdmissionQueue::getWaitingRequests() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return waitingRequests;
+}
+
+size_t LLMAdmissionQueue::getWaitingPromptTokens() const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return waitingPromptTokens;
+}
+
+}  // namespace ovms
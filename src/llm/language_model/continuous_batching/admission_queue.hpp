@@ -0,0 +1,155 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ovms {
+
+struct LLMPriorityClass {
+    std::string name;
+    // share of admissions when requests of several classes are waiting
+    uint32_t weight = 1;
+};
+
+struct LLMAdmissionLimits {
+    // 0 disables the limit
+    size_t maxWaitingRequests = 0;
+    size_t maxWaitingPromptTokens = 0;
+    // KV cache usage in percents above which waiting requests are not admitted, 0 disables gating
+    float maxCacheUsage = 0;
+    // requests in the pipeline above which waiting requests are not admitted, 0 disables the limit
+    size_t maxPipelineRequests = 0;
+    // single default class is used when not set, first class is the default one
+    std::vector<LLMPriorityClass> priorityClasses;
+
+    bool isEnabled() const {
+        return maxWaitingRequests > 0 || maxWaitingPromptTokens > 0 || maxCacheUsage > 0 || !priorityClasses.empty();
+    }
+};
+
+/**
+ * @brief Bounded queue of requests waiting to be added to continuous batching pipeline.
+ *
+ * Requests are admitted to the pipeline only when all requests already added were scheduled in the last
+ * pipeline step, pipeline holds less than maxPipelineRequests requests and KV cache usage is below configured
+ * threshold. Otherwise they wait, and new requests are rejected when waiting requests or their prompt tokens
+ * exceed the limits. Limits are split among priority classes proportionally to their weights.
+ * Prompt tokens admitted between two pipeline steps are limited by maxWaitingPromptTokens, so that a burst of
+ * waiting requests is prefilled over several steps instead of all at once.
+ *
+ * Waiting requests are admitted in weighted fair order - each class is charged with stride inversely proportional
+ * to its weight for every admitted request and the class with the lowest charge goes first. Within a class,
+ * tenants are served in round robin order and requests of single tenant in arrival order.
+ * Pipeline state is observed once per step, so the limits are not exact.
+ */
+class LLMAdmissionQueue {
+public:
+    static const std::string DEFAULT_PRIORITY_CLASS;
+
+    struct Ticket {
+        const size_t promptTokens;
+        const std::string priorityClass;
+        const std::string tenant;
+        bool admitted = false;
+        bool cancelled = false;
+
+        Ticket(size_t promptTokens, const std::string& priorityClass, const std::string& tenant) :
+            promptTokens(promptTokens),
+            priorityClass(priorityClass),
+            tenant(tenant) {}
+    };
+
+private:
+    static const uint64_t STRIDE = 1 << 20;
+
+    struct ClassQueue {
+        uint64_t stride;
+        uint64_t pass = 0;
+        size_t maxWaitingRequests;
+        size_t maxWaitingPromptTokens;
+        size_t waitingRequests = 0;
+        size_t waitingPromptTokens = 0;
+        std::map<std::string, std::deque<std::shared_ptr<Ticket>>> tenantQueues;
+        // tenants with waiting requests in round robin order
+        std::deque<std::string> tenantOrder;
+    };
+
+    const LLMAdmissionLimits limits;
+    std::string defaultPriorityClass;
+    mutable std::mutex mtx;
+    std::condition_variable admittedCv;
+    // ordered the same as configured priority classes to break ties
+    std::vector<std::pair<std::string, ClassQueue>> classQueues;
+    size_t waitingRequests = 0;
+    size_t waitingPromptTokens = 0;
+    // pass of the last charged class, idle classes are not allowed to stay behind it
+    uint64_t virtualTime = 0;
+    // last observed pipeline state
+    size_t unscheduledRequests = 0;
+    size_t freeSlots = std::numeric_limits<size_t>::max();
+    float cacheUsage = 0;
+    bool pipelineEmpty = true;
+    size_t stepAdmittedPromptTokens = 0;
+
+    ClassQueue* findClassQueue(const std::string& priorityClass);
+    bool canAdmitLocked(size_t promptTokens) const;
+    void chargeLocked(ClassQueue& classQueue);
+    void admitLocked(const std::shared_ptr<Ticket>& ticket);
+    size_t admitWaitingLocked();
+
+public:
+    LLMAdmissionQueue(const LLMAdmissionLimits& limits);
+
+    bool hasPriorityClass(const std::string& priorityClass) const;
+    const std::string& getDefaultPriorityClass() const { return defaultPriorityClass; }
+
+    /**
+     * @brief Returns ticket of the request, already admitted when pipeline can accept it right away.
+     * Returns nullptr when the request would exceed the limits of waiting requests of its priority class.
+     * Priority class has to be one of configured classes.
+     */
+    std::shared_ptr<Ticket> enqueue(size_t promptTokens, const std::string& priorityClass = DEFAULT_PRIORITY_CLASS, const std::string& tenant = "");
+
+    // Returns true when ticket got admitted, false when it was cancelled
+    bool waitForAdmission(const std::shared_ptr<Ticket>& ticket);
+    // Returns true when ticket got admitted before timeout
+    bool waitForAdmission(const std::shared_ptr<Ticket>& ticket, std::chrono::milliseconds timeout);
+
+    // Removes ticket which was not admitted yet, e.g. after client disconnection, and wakes up its waiter
+    void cancel(const std::shared_ptr<Ticket>& ticket);
+
+    /**
+     * @brief Called by executor thread with pipeline metrics after each step. Admits waiting requests
+     * if the pipeline can accept them and returns number of admitted requests.
+     */
+    size_t updatePipelineState(size_t requests, size_t scheduledRequests, float cacheUsage);
+
+    size_t getWaitingRequests() const;
+    size_t getWaitingPromptTokens() const;
+};
+
+}  // namespace ovms
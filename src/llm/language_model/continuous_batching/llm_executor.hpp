@@ -21,14 +21,20 @@
 #include <cstdint>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <string>
 #include <thread>
 #include <utility>
+#include <vector>
 
 #include <openvino/genai/continuous_batching_pipeline.hpp>
 
 #include "../../../logging.hpp"
+#include "../../../metrics/metric.hpp"
+#include "../../../model_metric_reporter.hpp"
 #include "../../../profiler.hpp"
+#include "../../../systeminfo.hpp"
+#include "admission_queue.hpp"
 
 namespace ovms {
 struct LLMExecutor {
@@ -37,10 +43,33 @@ struct LLMExecutor {
     std::mutex mutex;
     std::condition_variable cv;
     std::shared_ptr<ov::genai::ContinuousBatchingPipeline> pipe = nullptr;
-
-    LLMExecutor(std::shared_ptr<ov::genai::ContinuousBatchingPipeline> pipe, bool isDynamicKVCacheSet = false) {
+    // guarded by mutex, set after executor thread is started
+    std::shared_ptr<LLMNodeMetricReporter> metricReporter = nullptr;
+    // optional, requests waiting for admission to the pipeline
+    std::shared_ptr<LLMAdmissionQueue> admissionQueue = nullptr;
+    // set when pipeline is one of data parallel replicas of the servable
+    std::optional<size_t> replica;
+    // CPUs of NUMA node the replica is bound to, executor thread is not pinned when empty
+    std::vector<uint16_t> cpus;
+
+    LLMExecutor(std::shared_ptr<ov::genai::ContinuousBatchingPipeline> pipe, bool isDynamicKVCacheSet = false, std::shared_ptr<LLMAdmissionQueue> admissionQueue = nullptr,
+        std::optional<size_t> replica = std::nullopt, std::vector<uint16_t> cpus = {}) {
         this->pipe = std::move(pipe);
         this->isDynamicKVCache = isDynamicKVCacheSet;
+        this->admissionQueue = std::move(admissionQueue);
+        this->replica = replica;
+        this->cpus = std::move(cpus);
+    }
+
+    void pinThread() {
+#ifdef __linux__
+        if (cpus.empty()) {
+            return;
+        }
+        if (!setCurrentThreadCpus(cpus)) {
+            SPDLOG_LOGGER_WARN(llm_executor_logger, "Failed to pin executor thread of pipeline replica {} to its NUMA node CPUs", replica.value_or(0));
+        }
+#endif
     }
 
     bool hasRequests() {
@@ -62,6 +91,62 @@ struct LLMExecutor {
         cv.notify_one();
     }
 
+    void setMetricReporter(std::shared_ptr<LLMNodeMetricReporter> reporter) {
+        std::unique_lock<std::mutex> lock(mutex);
+        metricReporter = std::move(reporter);
+    }
+
+    std::shared_ptr<LLMNodeMetricReporter> getMetricReporter() {
+        std::unique_lock<std::mutex> lock(mutex);
+        return metricReporter;
+    }
+
+    void updateAdmissionQueue(size_t requests, size_t scheduledRequests, float cacheUsage) {
+        if (admissionQueue == nullptr) {
+            return;
+        }
+        size_t admittedCount = admissionQueue->updatePipelineState(requests, scheduledRequests, cacheUsage);
+        if (admittedCount == 0) {
+            return;
+        }
+        SPDLOG_LOGGER_DEBUG(llm_executor_logger, "Admitted {} waiting requests to the pipeline", admittedCount);
+        // queues of all replicas are summed up by the servable
+        auto reporter = getMetricReporter();
+        if (reporter != nullptr && !replica.has_value()) {
+            SET_IF_ENABLED(reporter->queuedRequests, admissionQueue->getWaitingRequests());
+        }
+    }
+
+    // pipeline state is checked after every step only when admission queue is enabled
+    void updateAdmissionQueue() {
+        if (admissionQueue == nullptr) {
+            return;
+        }
+        ov::genai::PipelineMetrics metrics = pipe->get_metrics();
+        updateAdmissionQueue(metrics.requests, metrics.scheduled_requests, metrics.cache_usage);
+    }
+
+    void reportMetrics(size_t requests, size_t scheduledRequests, float cacheUsage, size_t cacheBytes) {
+        auto reporter = getMetricReporter();
+        if (reporter == nullptr) {
+            return;
+        }
+        if (replica.has_value()) {
+            // pipeline state of data parallel replicas is reported per replica
+            auto replicaReporter = reporter->getReplicaMetricReporter(replica.value());
+            if (replicaReporter != nullptr) {
+                SET_IF_ENABLED(replicaReporter->runningRequests, scheduledRequests);
+                SET_IF_ENABLED(replicaReporter->kvCacheUsagePercent, cacheUsage);
+            }
+            return;
+        }
+        SET_IF_ENABLED(reporter->waitingRequests, requests > scheduledRequests ? requests - scheduledRequests : 0);
+        SET_IF_ENABLED(reporter->runningRequests, scheduledRequests);
+        // cache usage is reported by pipeline in percents
+        SET_IF_ENABLED(reporter->kvCacheUsageBytes, cacheBytes * cacheUsage / 100);
+        SET_IF_ENABLED(reporter->kvCacheUsagePercent, cacheUsage);
+    }
+
     std::string formatCacheInfo(float cacheUsage, size_t cacheBytes, bool isCacheDynamic) {
         std::ostringstream oss;
         oss << std::fixed << std::setprecision(1);
@@ -103,6 +188,7 @@ struct LLMExecutor {
         ov::genai::PipelineMetrics metrics = pipe->get_metrics();
         SPDLOG_LOGGER_INFO(llm_executor_logger, "All requests: {}; Scheduled requests: {}; Cache {};",
             metrics.requests, metrics.scheduled_requests, formatCacheInfo(metrics.cache_usage, metrics.kv_cache_size_in_bytes, this->isDynamicKVCache));
+        reportMetrics(metrics.requests, metrics.scheduled_requests, metrics.cache_usage, metrics.kv_cache_size_in_bytes);
     }
 };
 #pragma GCC diagnostic pop
@@ -115,6 +201,7 @@ class LLMExecutorWrapper {
     static void run(LLMExecutor* llmExecutor, std::atomic<bool>* receivedEndSignal) {
         const uint8_t printMetricsEveryNumberOfSteps = 10;
         uint8_t stepCounter = 0;
+        llmExecutor->pinThread();
         while (!(*receivedEndSignal)) {
             try {
                 if (stepCounter == printMetricsEveryNumberOfSteps) {
@@ -124,8 +211,11 @@ class LLMExecutorWrapper {
                 if (llmExecutor->hasRequests()) {
                     stepCounter++;
                     llmExecutor->step();
+                    llmExecutor->updateAdmissionQueue();
                 } else {
                     SPDLOG_LOGGER_INFO(llm_executor_logger, "All requests: {}; Scheduled requests: {};", 0, 0);
+                    llmExecutor->reportMetrics(0, 0, 0, 0);
+                    llmExecutor->updateAdmissionQueue(0, 0, 0);
                     llmExecutor->waitForRequests(receivedEndSignal);
                 }
             } catch (std::exception& e) {
@@ -136,8 +226,9 @@ class LLMExecutorWrapper {
     }
 
 public:
-    LLMExecutorWrapper(std::shared_ptr<ov::genai::ContinuousBatchingPipeline> pipe, bool isDynamicKVCache = false) :
-        llmExecutor(std::move(pipe), isDynamicKVCache) {
+    LLMExecutorWrapper(std::shared_ptr<ov::genai::ContinuousBatchingPipeline> pipe, bool isDynamicKVCache = false, std::shared_ptr<LLMAdmissionQueue> admissionQueue = nullptr,
+        std::optional<size_t> replica = std::nullopt, std::vector<uint16_t> cpus = {}) :
+        llmExecutor(std::move(pipe), isDynamicKVCache, std::move(admissionQueue), replica, std::move(cpus)) {
         llmExecutorThread = std::thread(LLMExecutorWrapper::run, &llmExecutor, &finishExecutorThread);
     }
 
@@ -150,6 +241,10 @@ public:
     void notifyNewRequestArrived() {
         llmExecutor.notify();
     }
+
+    void setMetricReporter(std::shared_ptr<LLMNodeMetricReporter> reporter) {
+        llmExecutor.setMetricReporter(std::move(reporter));
+    }
 };
 
 }  // namespace ovms
@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "replica_router.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "../../../metrics/metric.hpp"
+#include "../../../model_metric_reporter.hpp"
+
+namespace ovms {
+
+LLMReplicaRouter::Route::~Route() {
+    router->release(replica, tokens);
+}
+
+LLMReplicaRouter::LLMReplicaRouter(size_t replicasCount, size_t affinityPrefixTokens, size_t affinityToleranceTokens) :
+    affinityPrefixTokens(affinityPrefixTokens),
+    affinityToleranceTokens(affinityToleranceTokens),
+    loads(std::max<size_t>(replicasCount, 1)) {}
+
+std::optional<uint64_t> LLMReplicaRouter::getPrefixHash(const int64_t* promptTokens, size_t promptTokensCount) const {
+    if (affinityPrefixTokens == 0 || promptTokensCount == 0) {
+        return std::nullopt;
+    }
+    // FNV-1a over the first tokens, prompts shorter than the prefix are hashed whole
+    uint64_t hash = 14695981039346656037ULL;
+    const size_t count = std::min(promptTokensCount, affinityPrefixTokens);
+    for (size_t i = 0; i < count; ++i) {
+        uint64_t token = static_cast<uint64_t>(promptTokens[i]);
+        for (int byte = 0; byte < 8; ++byte) {
+            hash ^= (token >> (byte * 8)) & 0xff;
+            hash *= 1099511628211ULL;
+        }
+    }
+    return hash;
+}
+
+void LLMReplicaRouter::rememberPrefixLocked(uint64_t prefixHash, size_t replica) {
+    auto [it, inserted] = replicaByPrefix.emplace(prefixHash, replica);
+    if (!inserted) {
+        it->second = replica;
+        return;
+    }
+    prefixesOrder.push_back(prefixHash);
+    if (prefixesOrder.size() > AFFINITY_CAPACITY) {
+        replicaByPrefix.erase(prefixesOrder.front());
+        prefixesOrder.pop_front();
+    }
+}
+
+void LLMReplicaRouter::reportLoadLocked(size_t replica) {
+    if (replica >= replicaMetricReporters.size() || replicaMetricReporters[replica] == nullptr) {
+        return;
+    }
+    SET_IF_ENABLED(replicaMetricReporters[replica]->outstandingTokens, loads[replica].outstandingTokens);
+}
+
+std::unique_ptr<LLMReplicaRouter::Route> LLMReplicaRouter::route(std::optional<uint64_t> prefixHash, size_t tokens) {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto leastLoaded = std::min_element(loads.begin(), loads.end(), [](const ReplicaLoad& a, const ReplicaLoad& b) {
+        return a.outstandingTokens < b.outstandingTokens || (a.outstandingTokens == b.outstandingTokens && a.outstandingRequests < b.outstandingRequests);
+    });
+    size_t replica = std::distance(loads.begin(), leastLoaded);
+    bool affinityHit = false;
+    if (prefixHash.has_value()) {
+        auto it = replicaByPrefix.find(prefixHash.value());
+        // prefix cache hit is not worth waiting behind much more work than on the least loaded replica
+        if (it != replicaByPrefix.end() && loads[it->second].outstandingTokens <= leastLoaded->outstandingTokens + affinityToleranceTokens) {
+            replica = it->second;
+            affinityHit = true;
+        }
+        rememberPrefixLocked(prefixHash.value(), replica);
+    }
+    loads[replica].outstandingTokens += tokens;
+    loads[replica].outstandingRequests++;
+    if (replica < replicaMetricReporters.size() && replicaMetricReporters[replica] != nullptr) {
+        INCREMENT_IF_ENABLED(replicaMetricReporters[replica]->routedRequests);
+        if (affinityHit) {
+            INCREMENT_IF_ENABLED(replicaMetricReporters[replica]->affinityRoutedRequests);
+        }
+    }
+    reportLoadLocked(replica);
+    return std::unique_ptr<Route>(new Route(shared_from_this(), replica, tokens, affinityHit));
+}
+
+void LLMReplicaRouter::release(size_t replica, size_t tokens) {
+    std::unique_lock<std::mutex> lock(mtx);
+    loads[replica].outstandingTokens -= tokens;
+    loads[replica].outstandingRequests--;
+    reportLoadLocked(replica);
+}
+
+size_t LLMReplicaRouter::getOutstandingTokens(size_t replica) const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return loads[replica].outstandingTokens;
+}
+
+size_t LLMReplicaRouter::getOutstandingRequests(size_t replica) const {
+    std::unique_lock<std::mutex> lock(mtx);
+    return loads[replica].outstandingRequests;
+}
+
+void LLMReplicaRouter::setMetricReporter(std::shared_ptr<LLMNodeMetricReporter> reporter) {
+    std::unique_lock<std::mutex> lock(mtx);
+    metricReporter = std::move(reporter);
+    replicaMetricReporters.assign(loads.size(), nullptr);
+    if (metricReporter == nullptr) {
+        return;
+    }
+    for (size_t replica = 0; replica < loads.size(); ++replica) {
+        replicaMetricReporters[replica] = metricReporter->getReplicaMetricReporter(replica);
+        reportLoadLocked(replica);
+    }
+}
+
+}  // namespace ovms
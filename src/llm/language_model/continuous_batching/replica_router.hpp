@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ovms {
+
+class LLMNodeMetricReporter;
+struct LLMReplicaMetricReporter;
+
+/**
+ * @brief Spreads requests among data parallel replicas of continuous batching pipeline.
+ *
+ * Request goes to the replica with the least outstanding tokens - prompt and requested output tokens of
+ * routed requests which are not finished yet. Ties are broken by the number of outstanding requests.
+ * When affinity is enabled, request is routed to the replica which served request with the same first
+ * prompt tokens most recently, since its prefix cache likely holds them, unless that replica has more
+ * outstanding tokens than the least loaded one by affinityToleranceTokens.
+ */
+class LLMReplicaRouter : public std::enable_shared_from_this<LLMReplicaRouter> {
+public:
+    // returns tokens of the request to the router when destroyed
+    class Route {
+        friend class LLMReplicaRouter;
+        std::shared_ptr<LLMReplicaRouter> router;
+        const size_t replica;
+        const size_t tokens;
+        const bool affinityHit;
+
+        Route(std::shared_ptr<LLMReplicaRouter> router, size_t replica, size_t tokens, bool affinityHit) :
+            router(std::move(router)),
+            replica(replica),
+            tokens(tokens),
+            affinityHit(affinityHit) {}
+
+    public:
+        ~Route();
+        Route(const Route&) = delete;
+        Route& operator=(const Route&) = delete;
+
+        size_t getReplica() const { return replica; }
+        bool isAffinityHit() const { return affinityHit; }
+    };
+
+    // number of remembered prompt prefixes, the oldest ones are forgotten first
+    static constexpr size_t AFFINITY_CAPACITY = 4096;
+
+private:
+    struct ReplicaLoad {
+        size_t outstandingTokens = 0;
+        size_t outstandingRequests = 0;
+    };
+
+    const size_t affinityPrefixTokens;
+    const size_t affinityToleranceTokens;
+    mutable std::mutex mtx;
+    std::vector<ReplicaLoad> loads;
+    std::unordered_map<uint64_t, size_t> replicaByPrefix;
+    std::deque<uint64_t> prefixesOrder;
+    std::shared_ptr<LLMNodeMetricReporter> metricReporter;
+    // per replica, owned by metricReporter
+    std::vector<LLMReplicaMetricReporter*> replicaMetricReporters;
+
+    void rememberPrefixLocked(uint64_t prefixHash, size_t replica);
+    void reportLoadLocked(size_t replica);
+    void release(size_t replica, size_t tokens);
+
+public:
+    // affinityPrefixTokens equal to 0 disables affinity
+    LLMReplicaRouter(size_t replicasCount, size_t affinityPrefixTokens, size_t affinityToleranceTokens);
+
+    size_t getReplicasCount() const { return loads.size(); }
+
+    // hash of the first affinityPrefixTokens prompt tokens, std::nullopt when affinity is disabled or prompt is empty
+    std::optional<uint64_t> getPrefixHash(const int64_t* promptTokens, size_t promptTokensCount) const;
+
+    /**
+     * @brief Selects replica for the request and adds its tokens to replica outstanding tokens.
+     * Request without prefix hash, e.g. with prompt tokenized by the pipeline, is routed only by load.
+     */
+    std::unique_ptr<Route> route(std::optional<uint64_t> prefixHash, size_t tokens);
+
+    size_t getOutstandingTokens(size_t replica) const;
+    size_t getOutstandingRequests(size_t replica) const;
+
+    void setMetricReporter(std::shared_ptr<LLMNodeMetricReporter> reporter);
+};
+
+}  // namespace ovms
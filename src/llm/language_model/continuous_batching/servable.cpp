@@ -14,10 +14,15 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 
 #include "../../../logging.hpp"
@@ -33,17 +38,21 @@
 
 #include "../../../http_payload.hpp"
 #include "../../../mediapipe_internal/mediapipe_utils.hpp"
+#include "../../../model_metric_reporter.hpp"
+#include "../../../stringutils.hpp"
 #include "../../apis/openai_completions.hpp"
 #include "../../text_utils.hpp"
 #if (PYTHON_DISABLE == 0)
 #include "../../py_jinja_template_processor.hpp"
 #endif
+#include "admission_queue.hpp"
 #include "llm_executor.hpp"
+#include "replica_router.hpp"
 #include "servable.hpp"
 
 namespace ovms {
 
-void ContinuousBatchingServable::logPerfMetrics(ov::genai::PerfMetrics& perfMetrics) {
+void ContinuousBatchingServable::logPerfMetrics(const ContinuousBatchingServableExecutionContext& executionContext, ov::genai::PerfMetrics& perfMetrics) {
     const size_t inputTokenCount = perfMetrics.get_num_input_tokens();
     const size_t outputTokenCount = perfMetrics.get_num_generated_tokens();
     // GenerationHandle metrics are scoped to this request; TTFT contains one sample.
@@ -58,6 +67,47 @@ void ContinuousBatchingServable::logPerfMetrics(ov::genai::PerfMetrics& perfMetr
         inputTokenCount + outputTokenCount,
         ttftMs,
         prefillSpeedTps);
+    reportPerfMetrics(executionContext, inputTokenCount, outputTokenCount, ttftMs, perfMetrics.get_tpot().mean, prefillSpeedTps);
+}
+
+bool ContinuousBatchingServable::shouldCollectPerfMetrics() const {
+    return properties->metricReporter != nullptr || llm_calculator_logger->should_log(spdlog::level::debug);
+}
+
+void ContinuousBatchingServable::reportPerfMetrics(const ContinuousBatchingServableExecutionContext& executionContext, size_t inputTokenCount, size_t outputTokenCount, double ttftMs, double tpotMs, double prefillSpeedTps) {
+    auto& reporter = properties->metricReporter;
+    if (reporter == nullptr) {
+        return;
+    }
+    OBSERVE_IF_ENABLED(reporter->timeToFirstToken, ttftMs * 1000);
+    if (!executionContext.priorityClass.empty()) {
+        // admission queue wait is not included in TTFT measured by the pipeline
+        auto classTimeToFirstToken = reporter->getClassTimeToFirstToken(executionContext.priorityClass);
+        OBSERVE_IF_ENABLED(classTimeToFirstToken, (executionContext.admissionWaitMs + ttftMs) * 1000);
+    }
+    // time per output token is measured between consecutive tokens
+    if (outputTokenCount > 1) {
+        OBSERVE_IF_ENABLED(reporter->timePerOutputToken, tpotMs * 1000);
+    }
+    OBSERVE_IF_ENABLED(reporter->prefillSpeed, prefillSpeedTps);
+    if (reporter->promptTokens) {
+        reporter->promptTokens->increment(inputTokenCount);
+    }
+    if (reporter->generatedTokens) {
+        reporter->generatedTokens->increment(outputTokenCount);
+    }
+}
+
+void ContinuousBatchingServable::setMetricReporter(std::shared_ptr<LLMNodeMetricReporter> reporter) {
+    GenAiServable::setMetricReporter(std::move(reporter));
+    for (auto& replica : properties->replicas) {
+        if (replica->llmExecutorWrapper != nullptr) {
+            replica->llmExecutorWrapper->setMetricReporter(properties->metricReporter);
+        }
+    }
+    if (properties->replicaRouter != nullptr) {
+        properties->replicaRouter->setMetricReporter(properties->metricReporter);
+    }
 }
 
 // CB stepping thread writes metrics in _free_non_running_requests() slightly after
@@ -74,13 +124,140 @@ static std::optional<ov::genai::PerfMetrics> tryGetPerfMetrics(const ov::genai::
     return std::nullopt;
 }
 
-void ContinuousBatchingServable::notifyExecutorThread() {
+void ContinuousBatchingServable::notifyExecutorThread(const ContinuousBatchingReplica& replica) {
     SPDLOG_LOGGER_TRACE(llm_calculator_logger, "Notifying executor thread");
-    if (properties->llmExecutorWrapper == nullptr) {
+    if (replica.llmExecutorWrapper == nullptr) {
         SPDLOG_LOGGER_ERROR(llm_calculator_logger, "LLMExecutorWrapper is not initialized");
         return;
     }
-    properties->llmExecutorWrapper->notifyNewRequestArrived();
+    replica.llmExecutorWrapper->notifyNewRequestArrived();
+}
+
+void ContinuousBatchingServable::selectReplica(std::shared_ptr<ContinuousBatchingServableExecutionContext>& executionContext) {
+    auto& router = properties->replicaRouter;
+    if (router == nullptr) {
+        executionContext->replica = properties->replicas.front();
+        return;
+    }
+    // prompt of VLM request is tokenized by the pipeline, hence it is routed only by load
+    const auto& inputIds = executionContext->inputRequest.inputIds;
+    std::optional<uint64_t> prefixHash;
+    size_t tokens = 0;
+    if (inputIds) {
+        prefixHash = router->getPrefixHash(inputIds.data<int64_t>(), inputIds.get_size());
+        tokens = inputIds.get_size();
+    }
+    const size_t maxNewTokens = executionContext->inputRequest.generationConfig.max_new_tokens;
+    if (maxNewTokens != std::numeric_limits<size_t>::max()) {
+        tokens += maxNewTokens;
+    }
+    executionContext->replicaRoute = router->route(prefixHash, tokens);
+    executionContext->replica = properties->replicas[executionContext->replicaRoute->getReplica()];
+    SPDLOG_LOGGER_TRACE(llm_calculator_logger, "Request routed to pipeline replica: {}; prefix affinity: {}",
+        executionContext->replicaRoute->getReplica(), executionContext->replicaRoute->isAffinityHit());
+}
+
+// requests waiting in admission queues of all replicas
+static size_t getQueuedRequests(const ContinuousBatchingServableProperties& properties) {
+    size_t queuedRequests = 0;
+    for (const auto& replica : properties.replicas) {
+        if (replica->admissionQueue != nullptr) {
+            queuedRequests += replica->admissionQueue->getWaitingRequests();
+        }
+    }
+    return queuedRequests;
+}
+
+static std::optional<std::string> getBearerToken(const std::unordered_map<std::string, std::string>& headers) {
+    static const std::string BEARER_PREFIX = "Bearer ";
+    for (const auto& [key, value] : headers) {
+        std::string lowercaseKey = key;
+        std::transform(lowercaseKey.begin(), lowercaseKey.end(), lowercaseKey.begin(), ::tolower);
+        if (lowercaseKey == "authorization" && startsWith(value, BEARER_PREFIX)) {
+            return value.substr(BEARER_PREFIX.size());
+        }
+    }
+    return std::nullopt;
+}
+
+absl::Status ContinuousBatchingServable::resolvePriorityClass(std::shared_ptr<ContinuousBatchingServableExecutionContext>& executionContext, std::string& tenant) {
+    auto& admissionQueue = executionContext->replica->admissionQueue;
+    const auto& request = executionContext->apiHandler->getRequest();
+    auto apiKey = getBearerToken(executionContext->payload.headers);
+    auto apiKeyClassIt = apiKey ? properties->priorityClassByApiKey.find(apiKey.value()) : properties->priorityClassByApiKey.end();
+    if (apiKeyClassIt != properties->priorityClassByApiKey.end()) {
+        executionContext->priorityClass = apiKeyClassIt->second;
+    } else if (request.priority.has_value()) {
+        if (!admissionQueue->hasPriorityClass(request.priority.value())) {
+            return absl::InvalidArgumentError("priority does not match any priority class configured for the model: " + request.priority.value());
+        }
+        executionContext->priorityClass = request.priority.value();
+    } else {
+        executionContext->priorityClass = admissionQueue->getDefaultPriorityClass();
+    }
+    // requests without user identifier share tenant of their API key
+    if (request.user.has_value()) {
+        tenant = request.user.value();
+    } else if (apiKey.has_value()) {
+        tenant = apiKey.value();
+    }
+    return absl::OkStatus();
+}
+
+absl::Status ContinuousBatchingServable::waitForAdmission(std::shared_ptr<ContinuousBatchingServableExecutionContext>& executionContext) {
+    auto& admissionQueue = executionContext->replica->admissionQueue;
+    auto& reporter = properties->metricReporter;
+    std::string tenant;
+    auto status = resolvePriorityClass(executionContext, tenant);
+    if (!status.ok()) {
+        return status;
+    }
+    // prompt of VLM request is tokenized by the pipeline, hence its tokens are not counted
+    const auto& inputIds = executionContext->inputRequest.inputIds;
+    const size_t promptTokens = inputIds ? inputIds.get_size() : 0;
+    auto waitStart = std::chrono::steady_clock::now();
+    auto ticket = admissionQueue->enqueue(promptTokens, executionContext->priorityClass, tenant);
+    if (ticket == nullptr) {
+        SPDLOG_LOGGER_DEBUG(llm_calculator_logger, "Request of priority class: {} rejected by admission queue; waiting requests: {}; waiting prompt tokens: {}",
+            executionContext->priorityClass, admissionQueue->getWaitingRequests(), admissionQueue->getWaitingPromptTokens());
+        if (reporter) {
+            INCREMENT_IF_ENABLED(reporter->rejectedRequests);
+        }
+        return absl::ResourceExhaustedError("Too many requests waiting for generation");
+    }
+    if (!ticket->admitted) {
+        if (reporter) {
+            SET_IF_ENABLED(reporter->queuedRequests, getQueuedRequests(*properties));
+        }
+        // waiting request is woken up by cancellation as soon as client disconnects
+        auto& client = executionContext->payload.client;
+        client->registerDisconnectionCallback([weakAdmissionQueue = std::weak_ptr<LLMAdmissionQueue>(admissionQueue), ticket]() {
+            if (auto queue = weakAdmissionQueue.lock()) {
+                queue->cancel(ticket);
+            }
+        });
+        // client could have disconnected before the callback was registered
+        if (client->isDisconnected()) {
+            admissionQueue->cancel(ticket);
+        }
+        // executor thread might be idle before the first request is admitted
+        notifyExecutorThread(*executionContext->replica);
+        if (!admissionQueue->waitForAdmission(ticket)) {
+            if (reporter) {
+                SET_IF_ENABLED(reporter->queuedRequests, getQueuedRequests(*properties));
+            }
+            return absl::CancelledError();
+        }
+        // executor threads of replicas leave the gauge to the servable
+        if (reporter && properties->replicaRouter != nullptr) {
+            SET_IF_ENABLED(reporter->queuedRequests, getQueuedRequests(*properties));
+        }
+    }
+    executionContext->admissionWaitMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - waitStart).count();
+    if (reporter) {
+        INCREMENT_IF_ENABLED(reporter->admittedRequests);
+    }
+    return absl::OkStatus();
 }
 
 absl::Status ContinuousBatchingServable::addRequestToPipeline(std::shared_ptr<ContinuousBatchingServableExecutionContext>& executionContext) {
@@ -91,7 +268,7 @@ absl::Status ContinuousBatchingServable::addRequestToPipeline(std::shared_ptr<Co
         return absl::InvalidArgumentError("Input length exceeds pipeline capabilities: " + std::to_string(executionContext->inputRequest.inputIds.get_size()) +
                                           " > " + std::to_string(properties->schedulerConfig.max_num_batched_tokens));
     }
-    executionContext->generationHandle = properties->pipeline->add_request(currentRequestId++,
+    executionContext->generationHandle = executionContext->replica->pipeline->add_request(currentRequestId++,
         executionContext->inputRequest.inputIds,
         executionContext->inputRequest.generationConfig);
     return absl::OkStatus();
@@ -112,6 +289,13 @@ absl::Status ContinuousBatchingServable::scheduleExecution(std::shared_ptr<GenAi
         return absl::CancelledError();
     }
 
+    selectReplica(cbExecutionContext);
+    if (cbExecutionContext->replica->admissionQueue != nullptr) {
+        auto status = waitForAdmission(cbExecutionContext);
+        if (!status.ok()) {
+            return status;
+        }
+    }
     auto status = addRequestToPipeline(cbExecutionContext);
     if (!status.ok()) {
         return status;
@@ -120,7 +304,7 @@ absl::Status ContinuousBatchingServable::scheduleExecution(std::shared_ptr<GenAi
     cbExecutionContext->payload.client->registerDisconnectionCallback([genHandle = cbExecutionContext->generationHandle]() {
         genHandle->stop();
     });
-    notifyExecutorThread();
+    notifyExecutorThread(*cbExecutionContext->replica);
 
     return absl::OkStatus();
 }
@@ -178,11 +362,11 @@ absl::Status ContinuousBatchingServable::readPartialExecutionResults(std::shared
 
 absl::Status ContinuousBatchingServable::prepareCompleteResponse(std::shared_ptr<GenAiServableExecutionContext>& executionContext) {
     auto status = GenAiServable::prepareCompleteResponse(executionContext);
-    if (status.ok() && llm_calculator_logger->should_log(spdlog::level::debug)) {
+    if (status.ok() && shouldCollectPerfMetrics()) {
         auto cbExecutionContext = std::static_pointer_cast<ContinuousBatchingServableExecutionContext>(executionContext);
         auto perfMetrics = tryGetPerfMetrics(cbExecutionContext->generationHandle);
         if (perfMetrics)
-            logPerfMetrics(*perfMetrics);
+            logPerfMetrics(*cbExecutionContext, *perfMetrics);
     }
     return status;
 }
@@ -191,11 +375,11 @@ absl::Status ContinuousBatchingServable::preparePartialResponse(std::shared_ptr<
     auto status = GenAiServable::preparePartialResponse(executionContext);
     if (status.ok() &&
         !executionContext->sendLoopbackSignal &&
-        llm_calculator_logger->should_log(spdlog::level::debug)) {
+        shouldCollectPerfMetrics()) {
         auto cbExecutionContext = std::static_pointer_cast<ContinuousBatchingServableExecutionContext>(executionContext);
         auto perfMetrics = tryGetPerfMetrics(cbExecutionContext->generationHandle);
         if (perfMetrics)
-            logPerfMetrics(*perfMetrics);
+            logPerfMetrics(*cbExecutionContext, *perfMetrics);
     }
     return status;
 }
@@ -16,31 +16,62 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include <openvino/genai/continuous_batching_pipeline.hpp>
 
 #include "../../servable.hpp"
 #include "src/llm/llm_calculator.pb.h"
+#include "replica_router.hpp"
 
 namespace ovms {
 
+class LLMAdmissionQueue;
 class LLMExecutorWrapper;
 
+// continuous batching pipeline stepped by its own executor thread
+struct ContinuousBatchingReplica {
+    std::shared_ptr<ov::genai::ContinuousBatchingPipeline> pipeline;
+    std::shared_ptr<LLMExecutorWrapper> llmExecutorWrapper;
+    // set only when admission limits or priority classes are configured
+    std::shared_ptr<LLMAdmissionQueue> admissionQueue;
+};
+
 struct ContinuousBatchingServableExecutionContext : public GenAiServableExecutionContext {
     ov::genai::GenerationHandle generationHandle;
+    // set when request is scheduled
+    std::shared_ptr<ContinuousBatchingReplica> replica;
+    // holds outstanding tokens of the request in the router until execution context is released
+    std::unique_ptr<LLMReplicaRouter::Route> replicaRoute;
+    // set when request passed admission queue
+    std::string priorityClass;
+    double admissionWaitMs = 0;
 };
 
 struct ContinuousBatchingServableProperties : public GenAiServableProperties {
     ov::genai::SchedulerConfig schedulerConfig;
-    std::shared_ptr<ov::genai::ContinuousBatchingPipeline> pipeline;
-    std::shared_ptr<LLMExecutorWrapper> llmExecutorWrapper;
+    // data parallel replicas of the pipeline, single one unless data_parallel_replicas is configured
+    std::vector<std::shared_ptr<ContinuousBatchingReplica>> replicas;
+    // set only when there is more than one replica
+    std::shared_ptr<LLMReplicaRouter> replicaRouter;
+    std::unordered_map<std::string, std::string> priorityClassByApiKey;
 };
 
 class ContinuousBatchingServable : public GenAiServable {
 protected:
     std::shared_ptr<ContinuousBatchingServableProperties> properties;
-    void notifyExecutorThread();
-    void logPerfMetrics(ov::genai::PerfMetrics& perfMetrics);
+    // routes request among replicas and sets replica in execution context
+    void selectReplica(std::shared_ptr<ContinuousBatchingServableExecutionContext>& executionContext);
+    void notifyExecutorThread(const ContinuousBatchingReplica& replica);
+    // priority class from API key mapping or request parameter, tenant from user request parameter or API key
+    absl::Status resolvePriorityClass(std::shared_ptr<ContinuousBatchingServableExecutionContext>& executionContext, std::string& tenant);
+    // blocks until request is admitted to the pipeline, returns ResourceExhausted when admission queue is full
+    absl::Status waitForAdmission(std::shared_ptr<ContinuousBatchingServableExecutionContext>& executionContext);
+    void logPerfMetrics(const ContinuousBatchingServableExecutionContext& executionContext, ov::genai::PerfMetrics& perfMetrics);
+    // perf metrics are read from generation handle only when they are logged or reported
+    bool shouldCollectPerfMetrics() const;
+    void reportPerfMetrics(const ContinuousBatchingServableExecutionContext& executionContext, size_t inputTokenCount, size_t outputTokenCount, double ttftMs, double tpotMs, double prefillSpeedTps);
 
 public:
     ContinuousBatchingServable() {
@@ -52,6 +83,7 @@ public:
     virtual absl::Status addRequestToPipeline(std::shared_ptr<ContinuousBatchingServableExecutionContext>& executionContext);
 
     // Interface methods
+    void setMetricReporter(std::shared_ptr<LLMNodeMetricReporter> reporter) override;
     std::shared_ptr<GenAiServableExecutionContext> createExecutionContext() override;
     std::shared_ptr<GenAiServableProperties> getProperties() override;
     absl::Status scheduleExecution(std::shared_ptr<GenAiServableExecutionContext>& executionContext) override;
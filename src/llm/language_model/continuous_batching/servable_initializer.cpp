@@ -16,8 +16,11 @@
 #include <algorithm>
 #include <fstream>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 #include <openvino/genai/cache_eviction.hpp>
 #include <openvino/genai/sparse_attention.hpp>
@@ -41,7 +44,9 @@
 #include "../../../status.hpp"
 #include "../../../systeminfo.hpp"
 #include "../../io_processing/parser_config_validation.hpp"
+#include "admission_queue.hpp"
 #include "llm_executor.hpp"
+#include "replica_router.hpp"
 #include "servable.hpp"
 #include "servable_initializer.hpp"
 
@@ -132,6 +137,37 @@ ov::genai::SchedulerConfig ContinuousBatchingServableInitializer::prepareDraftPi
     return config;
 }
 
+// Pipeline of replica bound to NUMA node is created by thread running on the node CPUs,
+// so that memory allocated and first touched during compilation is local to the node.
+static Status createPipeline(std::shared_ptr<ov::genai::ContinuousBatchingPipeline>& pipeline, const std::string& modelsPath,
+    const ContinuousBatchingServableProperties& properties, const ov::AnyMap& pluginConfig, const std::vector<uint16_t>& cpus) {
+    Status status = StatusCode::OK;
+    auto create = [&]() {
+#ifdef __linux__
+        if (!cpus.empty() && !setCurrentThreadCpus(cpus)) {
+            SPDLOG_WARN("Failed to pin LLM pipeline initialization thread to NUMA node CPUs");
+        }
+#endif
+        try {
+            pipeline = std::make_shared<ov::genai::ContinuousBatchingPipeline>(modelsPath,
+                properties.schedulerConfig, properties.device,
+                pluginConfig, properties.tokenizerPluginConfig);
+        } catch (const std::exception& e) {
+            SPDLOG_ERROR("Error during llm node initialization for models_path: {} exception: {}", modelsPath, e.what());
+            status = StatusCode::LLM_NODE_RESOURCE_STATE_INITIALIZATION_FAILED;
+        } catch (...) {
+            SPDLOG_ERROR("Error during llm node initialization for models_path: {}", modelsPath);
+            status = StatusCode::LLM_NODE_RESOURCE_STATE_INITIALIZATION_FAILED;
+        }
+    };
+    if (cpus.empty()) {
+        create();
+    } else {
+        std::thread(create).join();
+    }
+    return status;
+}
+
 Status ContinuousBatchingServableInitializer::initialize(std::shared_ptr<GenAiServable>& servable, const mediapipe::LLMCalculatorOptions& nodeOptions, std::string graphPath) {
     std::string parsedModelsPath;
     auto status = parseModelsPath(parsedModelsPath, nodeOptions.models_path(), graphPath);
@@ -230,6 +266,7 @@ Status ContinuousBatchingServableInitializer::initialize(std::shared_ptr<GenAiSe
         SPDLOG_ERROR("Error during llm node plugin_config option parsing to JSON: {}", nodeOptions.plugin_config());
         return status;
     }
+    const bool isNumThreadsConfigured = properties->pluginConfig.count(ov::inference_num_threads.name()) > 0;
 
     applyGlobalCacheDir(properties);
 
@@ -253,25 +290,91 @@ Status ContinuousBatchingServableInitializer::initialize(std::shared_ptr<GenAiSe
     }
     properties->tokenizerPluginConfig = tokenProperties;
 
-    try {
-        properties->pipeline = std::make_shared<ov::genai::ContinuousBatchingPipeline>(parsedModelsPath,
-            properties->schedulerConfig, properties->device,
-            properties->pluginConfig, properties->tokenizerPluginConfig);
-        properties->tokenizer = properties->pipeline->get_tokenizer();
-    } catch (const std::exception& e) {
-        SPDLOG_ERROR("Error during llm node initialization for models_path: {} exception: {}", parsedModelsPath, e.what());
-        return StatusCode::LLM_NODE_RESOURCE_STATE_INITIALIZATION_FAILED;
-    } catch (...) {
-        SPDLOG_ERROR("Error during llm node initialization for models_path: {}", parsedModelsPath);
+    const uint32_t replicasCount = nodeOptions.data_parallel_replicas();
+    if (replicasCount == 0) {
+        SPDLOG_ERROR("data_parallel_replicas should be positive");
         return StatusCode::LLM_NODE_RESOURCE_STATE_INITIALIZATION_FAILED;
     }
+    std::vector<std::vector<uint16_t>> numaNodesCpus;
+#ifdef __linux__
+    if (replicasCount > 1 && properties->device == "CPU") {
+        numaNodesCpus = getNumaNodesCpus();
+        // replicas on single node compete for the same CPUs anyway
+        if (numaNodesCpus.size() < 2) {
+            numaNodesCpus.clear();
+        }
+    }
+#endif
+    std::vector<std::shared_ptr<ov::genai::ContinuousBatchingPipeline>> pipelines(replicasCount);
+    std::vector<std::vector<uint16_t>> replicasCpus(replicasCount);
+    for (uint32_t i = 0; i < replicasCount; ++i) {
+        ov::AnyMap replicaPluginConfig = properties->pluginConfig;
+        if (!numaNodesCpus.empty()) {
+            // replicas are assigned to nodes in round robin order and share CPUs of their node
+            const size_t node = i % numaNodesCpus.size();
+            const size_t nodeReplicasCount = replicasCount / numaNodesCpus.size() + (node < replicasCount % numaNodesCpus.size() ? 1 : 0);
+            replicasCpus[i] = numaNodesCpus[node];
+            if (!isNumThreadsConfigured) {
+                replicaPluginConfig[ov::inference_num_threads.name()] = static_cast<int>(std::max<size_t>(replicasCpus[i].size() / nodeReplicasCount, 1));
+            }
+            SPDLOG_INFO("Creating LLM pipeline replica {} on NUMA node {} with {} CPUs", i, node, replicasCpus[i].size());
+        }
+        status = createPipeline(pipelines[i], parsedModelsPath, *properties, replicaPluginConfig, replicasCpus[i]);
+        if (!status.ok()) {
+            return status;
+        }
+    }
+    properties->tokenizer = pipelines.front()->get_tokenizer();
     loadChatTemplate(properties, parsedModelsPath);
     if (nodeOptions.has_max_tokens_limit()) {
         properties->maxTokensLimit = nodeOptions.max_tokens_limit();
     }
     properties->maxModelLength = parseMaxModelLength(parsedModelsPath);
 
-    properties->llmExecutorWrapper = std::make_shared<LLMExecutorWrapper>(properties->pipeline, properties->schedulerConfig.cache_size == 0);
+    LLMAdmissionLimits admissionLimits;
+    admissionLimits.maxWaitingRequests = nodeOptions.max_waiting_requests();
+    admissionLimits.maxWaitingPromptTokens = nodeOptions.max_waiting_prompt_tokens();
+    admissionLimits.maxCacheUsage = nodeOptions.admission_cache_usage_threshold();
+    if (admissionLimits.maxCacheUsage < 0 || admissionLimits.maxCacheUsage > 100) {
+        SPDLOG_ERROR("admission_cache_usage_threshold should be in range [0, 100], got: {}", admissionLimits.maxCacheUsage);
+        return StatusCode::LLM_NODE_RESOURCE_STATE_INITIALIZATION_FAILED;
+    }
+    for (const auto& priorityClass : nodeOptions.priority_classes()) {
+        bool isDuplicate = std::any_of(admissionLimits.priorityClasses.begin(), admissionLimits.priorityClasses.end(),
+            [&priorityClass](const LLMPriorityClass& other) { return other.name == priorityClass.name(); });
+        if (priorityClass.name().empty() || isDuplicate || priorityClass.weight() == 0) {
+            SPDLOG_ERROR("Priority class name should be unique and not empty and its weight should be positive, got name: \"{}\" weight: {}", priorityClass.name(), priorityClass.weight());
+            return StatusCode::LLM_NODE_RESOURCE_STATE_INITIALIZATION_FAILED;
+        }
+        admissionLimits.priorityClasses.push_back({priorityClass.name(), priorityClass.weight()});
+        for (const auto& apiKey : priorityClass.api_keys()) {
+            if (!properties->priorityClassByApiKey.emplace(apiKey, priorityClass.name()).second) {
+                SPDLOG_ERROR("API key is assigned to more than one priority class");
+                return StatusCode::LLM_NODE_RESOURCE_STATE_INITIALIZATION_FAILED;
+            }
+        }
+    }
+    if (!admissionLimits.priorityClasses.empty()) {
+        // priority order is kept only while requests wait for admission, so the pipeline is not filled above its capacity
+        admissionLimits.maxPipelineRequests = properties->schedulerConfig.max_num_seqs;
+    }
+    // each replica admits requests routed to it, hence the limits apply per replica
+    for (uint32_t i = 0; i < replicasCount; ++i) {
+        auto replica = std::make_shared<ContinuousBatchingReplica>();
+        replica->pipeline = pipelines[i];
+        if (admissionLimits.isEnabled()) {
+            replica->admissionQueue = std::make_shared<LLMAdmissionQueue>(admissionLimits);
+        }
+        std::optional<size_t> replicaIndex = replicasCount > 1 ? std::optional<size_t>(i) : std::nullopt;
+        replica->llmExecutorWrapper = std::make_shared<LLMExecutorWrapper>(replica->pipeline, properties->schedulerConfig.cache_size == 0, replica->admissionQueue,
+            replicaIndex, std::move(replicasCpus[i]));
+        properties->replicas.push_back(std::move(replica));
+    }
+    if (replicasCount > 1) {
+        // affinity is worth following only when the replicas keep prompt prefixes in their caches
+        const size_t affinityPrefixTokens = properties->schedulerConfig.enable_prefix_caching ? nodeOptions.replica_affinity_prefix_tokens() : 0;
+        properties->replicaRouter = std::make_shared<LLMReplicaRouter>(replicasCount, affinityPrefixTokens, properties->schedulerConfig.max_num_batched_tokens);
+    }
 
     return StatusCode::OK;
 }
@@ -19,6 +19,7 @@
 
 #include "src/mediapipe_internal/graph_side_packets.hpp"
 #include "src/mediapipe_internal/node_initializer.hpp"
+#include "src/model_metric_reporter.hpp"
 #include "src/stringutils.hpp"
 #include "servable.hpp"
 #include "servable_initializer.hpp"
@@ -39,7 +40,8 @@ public:
         const std::string& graphName,
         const std::string& basePath,
         GraphSidePackets& sidePackets,
-        PythonBackend* /*pythonBackend*/) override {
+        PythonBackend* /*pythonBackend*/,
+        MediapipeServableMetricReporter* metricReporter) override {
         auto& genAiServableMap = sidePackets.genAiServableMap;
         if (!nodeConfig.node_options().size()) {
             SPDLOG_ERROR("LLM node missing options in graph: {}. ", graphName);
@@ -60,6 +62,12 @@ public:
             SPDLOG_ERROR("Failed to process LLM node graph {}", graphName);
             return status;
         }
+        if (metricReporter != nullptr) {
+            auto nodeMetricReporter = metricReporter->createLLMNodeMetricReporter(nodeName);
+            if (nodeMetricReporter != nullptr) {
+                servable->setMetricReporter(std::move(nodeMetricReporter));
+            }
+        }
         genAiServableMap.insert(std::pair<std::string, std::shared_ptr<GenAiServable>>(nodeName, std::move(servable)));
         sidePackets.genAiExecutionContextMap.emplace(
             nodeName, std::make_shared<GenAiExecutionContextHolder>());
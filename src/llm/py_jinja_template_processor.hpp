@@ -35,6 +35,8 @@ public:
     std::string eosToken = "";
     std::unique_ptr<PyObjectWrapper<py::object>> chatTemplate = nullptr;
     std::unique_ptr<PyObjectWrapper<py::object>> toolTemplate = nullptr;
+    // Template renders current date or time, so the same input does not always produce the same prompt
+    bool usesCurrentTime = false;
 
     static bool applyChatTemplate(PyJinjaTemplateProcessor& templateProcessor, const std::string& requestBody, std::string& output);
 };
@@ -41,10 +41,13 @@
 #include "io_processing/input_processor_context.hpp"
 #include "io_processing/input_request.hpp"
 #if (PYTHON_DISABLE == 0)
+#include "io_processing/chat_template/render_cache.hpp"
 #include "py_jinja_template_processor.hpp"
 #endif
 
 namespace ovms {
+class LLMNodeMetricReporter;
+
 // Some pipelines internals rely on request_id, so for now we provide increasing ID
 static std::atomic<uint64_t> currentRequestId = 0;
 
@@ -193,9 +196,13 @@ struct GenAiServableProperties {
     // Controls which steps InputProcessor builds for this servable type.
     // Aggregated per-deployment context for InputProcessor.
     InputProcessorContext inputProcessorContext;
+    // Set only when any of LLM metrics is enabled
+    std::shared_ptr<LLMNodeMetricReporter> metricReporter;
 
 #if (PYTHON_DISABLE == 0)
     PyJinjaTemplateProcessor templateProcessor;
+    // Set only when prompts rendered by Python Jinja chat template are cached
+    std::unique_ptr<ChatTemplateRenderCache> chatTemplateRenderCache;
 #endif
 };
 
@@ -210,6 +217,20 @@ public:
 
     void determineDecodingMethod();
 
+    /*
+    setMetricReporter method is called once after the servable is initialized, when any of LLM metrics is enabled.
+    Base implementation stores the reporter in properties and passes it to rendered chat template cache.
+    Derived classes with background executors override it to pass the reporter further.
+    */
+    virtual void setMetricReporter(std::shared_ptr<LLMNodeMetricReporter> reporter) {
+        getProperties()->metricReporter = std::move(reporter);
+#if (PYTHON_DISABLE == 0)
+        if (getProperties()->chatTemplateRenderCache) {
+            getProperties()->chatTemplateRenderCache->setMetricReporter(getProperties()->metricReporter);
+        }
+#endif
+    }
+
     // ----------- Tokenize scenario ------------
     /*
     processTokenizeRequest method implements tokenization of the input text provided in executionContext payload.
@@ -395,11 +395,15 @@ void GenAiServableInitializer::loadPyTemplateProcessor(std::shared_ptr<GenAiServ
                 tool_template = jinja_env.from_string(tool_chat_template)
             else:
                 tool_template = template
+
+            # Templates rendering current date produce different prompts for the same messages
+            uses_current_time = "strftime_now" in chat_template or (tool_chat_template is not None and "strftime_now" in tool_chat_template)
         )",
             py::globals(), locals);
 
         properties->templateProcessor.chatTemplate = std::make_unique<PyObjectWrapper<py::object>>(locals["template"]);
         properties->templateProcessor.toolTemplate = std::make_unique<PyObjectWrapper<py::object>>(locals["tool_template"]);
+        properties->templateProcessor.usesCurrentTime = locals["uses_current_time"].cast<bool>();
 
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Loaded Python Jinja template processor. Bos token: {}, Eos token: {}, Chat template: \n{}",
             bosToken, eosToken, locals["chat_template"].cast<std::string>());
@@ -605,6 +609,17 @@ Status initializeGenAiServable(std::shared_ptr<GenAiServable>& servable, const :
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "LLM node requires models_path to be set.");
         return StatusCode::INTERNAL_ERROR;
     }
+#if (PYTHON_DISABLE == 0)
+    auto properties = servable->getProperties();
+    if (properties->chatTemplateMode == ChatTemplateMode::JINJA && properties->templateProcessor.chatTemplate != nullptr && nodeOptions.chat_template_cache_size_mb() > 0) {
+        if (properties->templateProcessor.usesCurrentTime) {
+            SPDLOG_LOGGER_INFO(llm_calculator_logger, "Rendered chat template cache disabled since chat template uses current time");
+        } else {
+            properties->chatTemplateRenderCache = std::make_unique<ChatTemplateRenderCache>(nodeOptions.chat_template_cache_size_mb() * 1024 * 1024);
+            properties->inputProcessorContext.renderCache = properties->chatTemplateRenderCache.get();
+        }
+    }
+#endif
     servable->determineDecodingMethod();
     return StatusCode::OK;
 }
@@ -51,7 +51,7 @@ static std::optional<ov::genai::VLMPerfMetrics> tryGetVlmPerfMetrics(const ov::g
     return std::nullopt;
 }
 
-void VisualLanguageModelServable::logPerfMetrics(ov::genai::VLMPerfMetrics& perfMetrics) {
+void VisualLanguageModelServable::logPerfMetrics(const ContinuousBatchingServableExecutionContext& executionContext, ov::genai::VLMPerfMetrics& perfMetrics) {
     const size_t inputTokenCount = perfMetrics.get_num_input_tokens();
     const size_t outputTokenCount = perfMetrics.get_num_generated_tokens();
     const double prepareEmbeddingsTimeMs = perfMetrics.get_prepare_embeddings_duration().mean;
@@ -71,11 +71,12 @@ void VisualLanguageModelServable::logPerfMetrics(ov::genai::VLMPerfMetrics& perf
         ttftMs,
         prefillSpeedTps,
         perfMetrics.get_total_image_slice_count());
+    reportPerfMetrics(executionContext, inputTokenCount, outputTokenCount, ttftMs, perfMetrics.get_tpot().mean, prefillSpeedTps);
 }
 
 absl::Status VisualLanguageModelServable::addRequestToPipeline(std::shared_ptr<ContinuousBatchingServableExecutionContext>& executionContext) {
     auto vlmExecutionContext = std::static_pointer_cast<VisualLanguageModelServableExecutionContext>(executionContext);
-    vlmExecutionContext->generationHandle = properties->pipeline->add_request(currentRequestId++,  // to be removed from API?
+    vlmExecutionContext->generationHandle = vlmExecutionContext->replica->pipeline->add_request(currentRequestId++,  // to be removed from API?
         vlmExecutionContext->inputRequest.promptText, vlmExecutionContext->inputRequest.inputImages,
         vlmExecutionContext->inputRequest.generationConfig);
     return absl::OkStatus();
@@ -98,11 +99,11 @@ std::shared_ptr<GenAiServableProperties> VisualLanguageModelServable::getPropert
 
 absl::Status VisualLanguageModelServable::prepareCompleteResponse(std::shared_ptr<GenAiServableExecutionContext>& executionContext) {
     auto status = GenAiServable::prepareCompleteResponse(executionContext);
-    if (status.ok() && llm_calculator_logger->should_log(spdlog::level::debug)) {
+    if (status.ok() && shouldCollectPerfMetrics()) {
         auto vlmExecutionContext = std::static_pointer_cast<VisualLanguageModelServableExecutionContext>(executionContext);
         auto perfMetrics = tryGetVlmPerfMetrics(vlmExecutionContext->generationHandle);
         if (perfMetrics)
-            logPerfMetrics(*perfMetrics);
+            logPerfMetrics(*vlmExecutionContext, *perfMetrics);
     }
     return status;
 }
@@ -111,11 +112,11 @@ absl::Status VisualLanguageModelServable::preparePartialResponse(std::shared_ptr
     auto status = GenAiServable::preparePartialResponse(executionContext);
     if (status.ok() &&
         !executionContext->sendLoopbackSignal &&
-        llm_calculator_logger->should_log(spdlog::level::debug)) {
+        shouldCollectPerfMetrics()) {
         auto vlmExecutionContext = std::static_pointer_cast<VisualLanguageModelServableExecutionContext>(executionContext);
         auto perfMetrics = tryGetVlmPerfMetrics(vlmExecutionContext->generationHandle);
         if (perfMetrics)
-            logPerfMetrics(*perfMetrics);
+            logPerfMetrics(*vlmExecutionContext, *perfMetrics);
     }
     return status;
 }
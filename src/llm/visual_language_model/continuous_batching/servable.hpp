@@ -35,7 +35,7 @@ struct VisualLanguageModelServableExecutionContext : public ContinuousBatchingSe
 };
 
 class VisualLanguageModelServable : public ContinuousBatchingServable {
-    void logPerfMetrics(ov::genai::VLMPerfMetrics& perfMetrics);
+    void logPerfMetrics(const ContinuousBatchingServableExecutionContext& executionContext, ov::genai::VLMPerfMetrics& perfMetrics);
 
 public:
     VisualLanguageModelServable() {
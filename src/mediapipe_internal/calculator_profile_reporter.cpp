@@ -0,0 +1,95 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "calculator_profile_reporter.hpp"
+
+#include <vector>
+
+#pragma warning(push)
+#pragma warning(disable : 4324 6001 6385 6386 6326 6011 4309 4005 4456 6246)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wdeprecated-declarations"
+#include "mediapipe/framework/calculator_graph.h"
+#include "mediapipe/framework/calculator_profile.pb.h"
+#include "mediapipe/framework/profiler/graph_profiler.h"
+#pragma GCC diagnostic pop
+#pragma warning(pop)
+
+#include "../logging.hpp"
+#include "../model_metric_reporter.hpp"
+
+namespace ovms {
+
+static int64_t getSamplesCount(const ::mediapipe::TimeHistogram& histogram) {
+    int64_t count = 0;
+    for (auto intervalCount : histogram.count()) {
+        count += intervalCount;
+    }
+    return count;
+}
+
+void CalculatorProfileReporter::report(::mediapipe::CalculatorGraph& graph, MediapipeServableMetricReporter& reporter) {
+    auto profiler = graph.profiler();
+    if (!profiler) {
+        return;
+    }
+    std::vector<::mediapipe::CalculatorProfile> profiles;
+    auto absStatus = profiler->GetCalculatorProfiles(&profiles);
+    if (!absStatus.ok()) {
+        SPDLOG_DEBUG("Failed to get MediaPipe calculator profiles: {}", absStatus.ToString());
+        return;
+    }
+    for (const auto& profile : profiles) {
+        CalculatorTotals current;
+        current.processTimeUs = profile.process_runtime().total();
+        current.processCount = getSamplesCount(profile.process_runtime());
+        for (const auto& streamProfile : profile.input_stream_profiles()) {
+            if (streamProfile.back_edge()) {
+                continue;
+            }
+            current.inputWaitTimeUs += streamProfile.latency().total();
+            current.inputWaitCount += getSamplesCount(streamProfile.latency());
+        }
+        auto averages = update(profile.name(), current);
+        auto* calculatorReporter = reporter.getCalculatorMetricReporter(profile.name());
+        if (!calculatorReporter) {
+            continue;
+        }
+        if (averages.processTimeUs) {
+            OBSERVE_IF_ENABLED(calculatorReporter->processTime, averages.processTimeUs.value());
+        }
+        if (averages.inputWaitTimeUs) {
+            OBSERVE_IF_ENABLED(calculatorReporter->inputWaitTime, averages.inputWaitTimeUs.value());
+        }
+    }
+}
+
+CalculatorProfileReporter::CalculatorAverages CalculatorProfileReporter::update(const std::string& calculatorName, const CalculatorTotals& current) {
+    auto& last = this->lastTotals[calculatorName];
+    // totals smaller than previously reported mean that profiler was reset, then all samples are new
+    if (current.processCount < last.processCount || current.inputWaitCount < last.inputWaitCount) {
+        last = CalculatorTotals();
+    }
+    CalculatorAverages averages;
+    if (current.processCount > last.processCount) {
+        averages.processTimeUs = (current.processTimeUs - last.processTimeUs) / (current.processCount - last.processCount);
+    }
+    if (current.inputWaitCount > last.inputWaitCount) {
+        averages.inputWaitTimeUs = (current.inputWaitTimeUs - last.inputWaitTimeUs) / (current.inputWaitCount - last.inputWaitCount);
+    }
+    last = current;
+    return averages;
+}
+}  // namespace ovms
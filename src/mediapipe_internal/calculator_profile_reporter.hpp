@@ -0,0 +1,60 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace mediapipe {
+class CalculatorGraph;
+}  // namespace mediapipe
+
+namespace ovms {
+class MediapipeServableMetricReporter;
+
+/**
+ * @brief Reports calculator statistics collected by MediaPipe graph profiler as OVMS metrics.
+ *
+ * Profiler accumulates totals for the lifetime of the graph, so for graphs reused
+ * from graph queue only the difference since previous report is observed.
+ * Both metrics are averages over single graph execution: process time per Process() call
+ * and input wait time per packet.
+ */
+class CalculatorProfileReporter {
+public:
+    struct CalculatorTotals {
+        int64_t processTimeUs = 0;
+        int64_t processCount = 0;
+        int64_t inputWaitTimeUs = 0;
+        int64_t inputWaitCount = 0;
+    };
+    struct CalculatorAverages {
+        std::optional<int64_t> processTimeUs;
+        std::optional<int64_t> inputWaitTimeUs;
+    };
+
+    void report(::mediapipe::CalculatorGraph& graph, MediapipeServableMetricReporter& reporter);
+    void reset() { lastTotals.clear(); }
+
+    // averages of samples collected since previous update of the calculator, empty when there are no new samples
+    CalculatorAverages update(const std::string& calculatorName, const CalculatorTotals& current);
+
+private:
+    std::unordered_map<std::string, CalculatorTotals> lastTotals;
+};
+}  // namespace ovms
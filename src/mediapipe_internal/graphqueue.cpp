@@ -15,7 +15,9 @@
 //*****************************************************************************
 #include "graphqueue.hpp"
 
+#include <algorithm>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <future>
 #include <map>
@@ -27,7 +29,9 @@
 #include <utility>
 #include <vector>
 
+#include "../model_metric_reporter.hpp"
 #include "../queue.hpp"
+#include "src/metrics/metric.hpp"
 #if (PYTHON_DISABLE == 0)
 #include "src/python/pythonnoderesources.hpp"
 #endif
@@ -44,28 +48,167 @@
 namespace ovms {
 GraphQueue::GraphQueue(const ::mediapipe::CalculatorGraphConfig& config, std::shared_ptr<GraphSidePackets> sidePacketMaps, int streamsLength) :
     Queue(streamsLength),
-    sidePacketMaps(sidePacketMaps) {
+    config(config),
+    sidePacketMaps(sidePacketMaps),
+    minSize(streamsLength),
+    idleTimeout(0) {
     inferRequests.reserve(streamsLength);
     for (auto i = 0; i < streamsLength; ++i) {
-        // Build observer map locally before constructing GraphHelper (const map)
-        std::unordered_map<std::string, std::shared_ptr<ObserverHolder>> observers;
-        for (auto& name : config.output_stream()) {
-            std::string streamName = getStreamName(name);
-            auto observerHolder = std::make_shared<ObserverHolder>();
-            observerHolder->current = std::make_shared<NullOutputStreamObserver>();
-            observers[streamName] = observerHolder;
+        this->inferRequests.emplace_back(createGraphHelper());
+    }
+    graphsCount = streamsLength;
+}
+
+GraphQueue::GraphQueue(const ::mediapipe::CalculatorGraphConfig& config, std::shared_ptr<GraphSidePackets> sidePacketMaps, int minSize, int maxSize, std::chrono::milliseconds idleTimeout) :
+    Queue(maxSize, minSize),
+    config(config),
+    sidePacketMaps(sidePacketMaps),
+    minSize(minSize),
+    idleTimeout(idleTimeout) {
+    inferRequests.resize(maxSize);
+    for (auto i = 0; i < minSize; ++i) {
+        this->inferRequests[i] = createGraphHelper();
+    }
+    graphsCount = minSize;
+    // lowest ids are taken first
+    for (auto i = maxSize - 1; i >= minSize; --i) {
+        freeSlots.push_back(i);
+    }
+    if (isElastic() && idleTimeout.count() > 0) {
+        evictionThread = std::thread(&GraphQueue::evictionRoutine, this);
+    }
+}
+
+std::shared_ptr<GraphHelper> GraphQueue::createGraphHelper() {
+    // Build observer map locally before constructing GraphHelper (const map)
+    std::unordered_map<std::string, std::shared_ptr<ObserverHolder>> observers;
+    for (auto& name : config.output_stream()) {
+        std::string streamName = getStreamName(name);
+        auto observerHolder = std::make_shared<ObserverHolder>();
+        observerHolder->current = std::make_shared<NullOutputStreamObserver>();
+        observers[streamName] = observerHolder;
+    }
+
+    auto graphHelper = std::make_shared<GraphHelper>(std::move(observers));
+    for (const auto& [nodeName, _] : this->sidePacketMaps->genAiServableMap) {
+        graphHelper->genAiExecutionContextMap[nodeName] = std::make_shared<GenAiExecutionContextHolder>();
+    }
+    auto absStatus = graphHelper->initialize(config, *(this->sidePacketMaps));
+    if (!absStatus.ok()) {
+        SPDLOG_ERROR("Graph queue initialization failed: {}", absStatus.ToString());
+        throw std::runtime_error(absStatus.ToString());
+    }
+    return graphHelper;
+}
+
+void GraphQueue::setMetricReporter(MediapipeServableMetricReporter* reporter) {
+    this->reporter = reporter;
+    if (this->reporter) {
+        SET_IF_ENABLED(this->reporter->graphPoolSize, getGraphsCount());
+        SET_IF_ENABLED(this->reporter->graphPoolInUse, inUse.load(std::memory_order_relaxed));
+    }
+}
+
+std::optional<int> GraphQueue::tryToCreateGraph() {
+    int id;
+    {
+        std::unique_lock<std::mutex> lock(poolMtx);
+        if (freeSlots.empty()) {
+            return std::nullopt;
         }
+        id = freeSlots.back();
+        freeSlots.pop_back();
+    }
+    // graph is created without lock so that other requests can return and take graphs in the meantime
+    auto creationStart = std::chrono::steady_clock::now();
+    std::shared_ptr<GraphHelper> graphHelper;
+    try {
+        graphHelper = createGraphHelper();
+    } catch (const std::exception& e) {
+        SPDLOG_ERROR("Failed to create additional graph in graph queue: {}", e.what());
+        std::unique_lock<std::mutex> lock(poolMtx);
+        freeSlots.push_back(id);
+        return std::nullopt;
+    }
+    auto creationTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - creationStart).count();
+    {
+        std::unique_lock<std::mutex> lock(poolMtx);
+        this->inferRequests[id] = std::move(graphHelper);
+    }
+    int count = graphsCount.fetch_add(1, std::memory_order_relaxed) + 1;
+    SPDLOG_DEBUG("Graph queue grew to {} graphs, graph created in {} ms", count, creationTimeUs / 1000);
+    if (this->reporter) {
+        OBSERVE_IF_ENABLED(this->reporter->graphPoolCreationTime, creationTimeUs);
+        SET_IF_ENABLED(this->reporter->graphPoolSize, count);
+    }
+    return id;
+}
 
-        auto graphHelper = std::make_shared<GraphHelper>(std::move(observers));
-        for (const auto& [nodeName, _] : this->sidePacketMaps->genAiServableMap) {
-            graphHelper->genAiExecutionContextMap[nodeName] = std::make_shared<GenAiExecutionContextHolder>();
+int GraphQueue::acquireGraph() {
+    auto id = tryToGetIdleStream();
+    if (!id.has_value() && isElastic()) {
+        id = tryToCreateGraph();
+    }
+    if (!id.has_value()) {
+        auto waitStart = std::chrono::steady_clock::now();
+        id = acquireIdleStream();
+        if (this->reporter) {
+            OBSERVE_IF_ENABLED(this->reporter->graphPoolWaitTime, std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStart).count());
         }
-        auto absStatus = graphHelper->initialize(config, *(this->sidePacketMaps));
-        if (!absStatus.ok()) {
-            SPDLOG_ERROR("Graph queue initialization failed: {}", absStatus.ToString());
-            throw std::runtime_error(absStatus.ToString());
+    }
+    int current = inUse.fetch_add(1, std::memory_order_relaxed) + 1;
+    int peak = peakInUse.load(std::memory_order_relaxed);
+    while (peak < current && !peakInUse.compare_exchange_weak(peak, current, std::memory_order_relaxed)) {
+    }
+    if (this->reporter) {
+        SET_IF_ENABLED(this->reporter->graphPoolInUse, current);
+    }
+    return id.value();
+}
+
+void GraphQueue::returnGraph(int id) {
+    int current = inUse.fetch_sub(1, std::memory_order_relaxed) - 1;
+    if (this->reporter) {
+        SET_IF_ENABLED(this->reporter->graphPoolInUse, current);
+    }
+    returnStream(id);
+}
+
+size_t GraphQueue::evictIdleGraphs() {
+    // graphs used at once in last interval are kept so that steady load does not recreate them
+    int target = std::max(minSize, peakInUse.exchange(inUse.load(std::memory_order_relaxed), std::memory_order_relaxed));
+    std::vector<std::shared_ptr<GraphHelper>> evicted;
+    {
+        std::unique_lock<std::mutex> lock(poolMtx);
+        while (getGraphsCount() > target && getWaitersCount() == 0) {
+            auto id = tryToGetIdleStream();
+            if (!id.has_value()) {
+                break;
+            }
+            evicted.emplace_back(std::move(this->inferRequests[id.value()]));
+            freeSlots.push_back(id.value());
+            graphsCount.fetch_sub(1, std::memory_order_relaxed);
         }
-        this->inferRequests.emplace_back(std::move(graphHelper));
+    }
+    if (evicted.empty()) {
+        return 0;
+    }
+    SPDLOG_DEBUG("Graph queue evicted {} idle graphs, {} graphs left", evicted.size(), getGraphsCount());
+    if (this->reporter) {
+        SET_IF_ENABLED(this->reporter->graphPoolSize, getGraphsCount());
+    }
+    // graphs are destroyed outside of the lock, waiting for the graph run to finish
+    size_t evictedCount = evicted.size();
+    evicted.clear();
+    return evictedCount;
+}
+
+void GraphQueue::evictionRoutine() {
+    std::unique_lock<std::mutex> lock(evictionMtx);
+    while (!evictionCv.wait_for(lock, idleTimeout, [this]() { return evictionStopped; })) {
+        lock.unlock();
+        evictIdleGraphs();
+        lock.lock();
     }
 }
 GraphHelper::~GraphHelper() {
@@ -90,6 +233,7 @@ GraphHelper::~GraphHelper() {
 absl::Status GraphHelper::initialize(const ::mediapipe::CalculatorGraphConfig& config, const GraphSidePackets& sidePacketMaps) {
     this->graph = std::make_unique<::mediapipe::CalculatorGraph>();
     this->currentTimestamp = ::mediapipe::Timestamp(STARTING_TIMESTAMP_VALUE);
+    this->profileReporter.reset();
     auto absStatus = this->graph->Initialize(config);
     if (!absStatus.ok()) {
         SPDLOG_ERROR("Graph initialize failed: {}", absStatus.ToString());
@@ -117,8 +261,7 @@ absl::Status GraphHelper::initialize(const ::mediapipe::CalculatorGraphConfig& c
     return absl::OkStatus();
 }
 
-void GraphHelper::reinitialize(const ::mediapipe::CalculatorGraphConfig& config, const GraphSidePackets& sidePacketMaps) {
-    SPDLOG_DEBUG("Reinitializing graph after error");
+void GraphHelper::teardown() {
     // Tear down the old graph (best-effort, errors expected since graph is in bad state)
     if (this->graph) {
         auto absStatus = this->graph->CloseAllPacketSources();
@@ -139,6 +282,11 @@ void GraphHelper::reinitialize(const ::mediapipe::CalculatorGraphConfig& config,
     for (auto& [nodeName, ctx] : this->genAiExecutionContextMap) {
         ctx->reset();
     }
+}
+
+void GraphHelper::reinitialize(const ::mediapipe::CalculatorGraphConfig& config, const GraphSidePackets& sidePacketMaps) {
+    SPDLOG_DEBUG("Reinitializing graph after error");
+    teardown();
     auto absStatus = initialize(config, sidePacketMaps);
     if (!absStatus.ok()) {
         SPDLOG_ERROR("Graph reinitialize failed: {}", absStatus.ToString());
@@ -146,5 +294,142 @@ void GraphHelper::reinitialize(const ::mediapipe::CalculatorGraphConfig& config,
     }
     SPDLOG_DEBUG("Graph reinitialized successfully");
 }
-GraphQueue::~GraphQueue() = default;
+void GraphQueue::setSpareGraphsCount(size_t count) {
+    {
+        std::unique_lock<std::mutex> lock(rebuildMtx);
+        spareGraphsTarget = count;
+        if (spareGraphs.size() > count) {
+            spareGraphs.resize(count);
+        }
+        if (count > 0 && !rebuildThread.joinable()) {
+            rebuildThread = std::thread(&GraphQueue::rebuildRoutine, this);
+        }
+    }
+    rebuildCv.notify_one();
+}
+
+size_t GraphQueue::getSpareGraphsCount() {
+    std::unique_lock<std::mutex> lock(rebuildMtx);
+    return spareGraphs.size();
+}
+
+bool GraphQueue::waitForSpareGraphs(std::chrono::milliseconds timeout) {
+    std::unique_lock<std::mutex> lock(rebuildMtx);
+    return spareGraphsCv.wait_for(lock, timeout, [this]() { return spareGraphs.size() >= spareGraphsTarget; });
+}
+
+void GraphQueue::returnErroredGraph(int id) {
+    int current = inUse.fetch_sub(1, std::memory_order_relaxed) - 1;
+    if (this->reporter) {
+        SET_IF_ENABLED(this->reporter->graphPoolInUse, current);
+    }
+    std::shared_ptr<GraphHelper> spare;
+    {
+        std::unique_lock<std::mutex> lock(rebuildMtx);
+        if (!spareGraphs.empty()) {
+            spare = std::move(spareGraphs.back());
+            spareGraphs.pop_back();
+        }
+    }
+    if (!spare) {
+        // slot is out of service until the graph is rebuilt
+        SPDLOG_DEBUG("No spare graph available, graph: {} is returned to graph queue after rebuild", id);
+        scheduleRebuild({this->inferRequests[id], id});
+        return;
+    }
+    std::shared_ptr<GraphHelper> errored;
+    {
+        std::unique_lock<std::mutex> lock(poolMtx);
+        errored = std::move(this->inferRequests[id]);
+        this->inferRequests[id] = std::move(spare);
+    }
+    SPDLOG_DEBUG("Errored graph: {} replaced with spare graph", id);
+    returnStream(id);
+    scheduleRebuild({std::move(errored), std::nullopt});
+}
+
+void GraphQueue::scheduleRebuild(RebuildTask&& task) {
+    {
+        std::unique_lock<std::mutex> lock(rebuildMtx);
+        rebuildTasks.emplace_back(std::move(task));
+        if (!rebuildThread.joinable()) {
+            rebuildThread = std::thread(&GraphQueue::rebuildRoutine, this);
+        }
+    }
+    rebuildCv.notify_one();
+}
+
+void GraphQueue::rebuildRoutine() {
+    // delay before next try when spare graph cannot be created
+    static constexpr std::chrono::seconds SPARE_RETRY_INTERVAL{1};
+    std::unique_lock<std::mutex> lock(rebuildMtx);
+    while (true) {
+        rebuildCv.wait(lock, [this]() { return rebuildStopped || !rebuildTasks.empty() || spareGraphs.size() < spareGraphsTarget; });
+        if (rebuildStopped) {
+            return;
+        }
+        if (rebuildTasks.empty()) {
+            lock.unlock();
+            std::shared_ptr<GraphHelper> spare;
+            try {
+                spare = createGraphHelper();
+            } catch (const std::exception& e) {
+                SPDLOG_ERROR("Failed to create spare graph: {}", e.what());
+            }
+            lock.lock();
+            if (!spare) {
+                rebuildCv.wait_for(lock, SPARE_RETRY_INTERVAL, [this]() { return rebuildStopped; });
+            } else if (spareGraphs.size() < spareGraphsTarget) {
+                spareGraphs.emplace_back(std::move(spare));
+                spareGraphsCv.notify_all();
+            }
+            continue;
+        }
+        RebuildTask task = std::move(rebuildTasks.front());
+        rebuildTasks.pop_front();
+        lock.unlock();
+        auto rebuildStart = std::chrono::steady_clock::now();
+        auto absStatus = task.graphHelper->initialize(this->config, *(this->sidePacketMaps));
+        auto rebuildTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - rebuildStart).count();
+        if (absStatus.ok()) {
+            SPDLOG_DEBUG("Graph rebuilt in background in {} ms", rebuildTimeUs / 1000);
+        } else {
+            SPDLOG_ERROR("Graph rebuild failed: {}", absStatus.ToString());
+        }
+        if (this->reporter) {
+            INCREMENT_IF_ENABLED(this->reporter->graphRebuilds);
+            OBSERVE_IF_ENABLED(this->reporter->graphRebuildTime, rebuildTimeUs);
+        }
+        if (task.id.has_value()) {
+            // failed rebuild is returned as well, next request using the graph will trigger another one
+            returnStream(task.id.value());
+            lock.lock();
+            continue;
+        }
+        lock.lock();
+        if (absStatus.ok() && spareGraphs.size() < spareGraphsTarget) {
+            spareGraphs.emplace_back(std::move(task.graphHelper));
+            spareGraphsCv.notify_all();
+        }
+    }
+}
+
+GraphQueue::~GraphQueue() {
+    if (rebuildThread.joinable()) {
+        {
+            std::unique_lock<std::mutex> lock(rebuildMtx);
+            rebuildStopped = true;
+        }
+        rebuildCv.notify_all();
+        rebuildThread.join();
+    }
+    if (evictionThread.joinable()) {
+        {
+            std::unique_lock<std::mutex> lock(evictionMtx);
+            evictionStopped = true;
+        }
+        evictionCv.notify_all();
+        evictionThread.join();
+    }
+}
 }  // namespace ovms
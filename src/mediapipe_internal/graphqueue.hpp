@@ -16,7 +16,9 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <exception>
 #include <future>
 #include <memory>
@@ -29,6 +31,7 @@
 #include <utility>
 #include <vector>
 
+#include "src/admission_controller.hpp"
 #include "src/queue.hpp"
 
 #pragma warning(push)
@@ -42,10 +45,12 @@
 
 #include "src/logging.hpp"
 
+#include "calculator_profile_reporter.hpp"
 #include "graph_executor_constants.hpp"
 #include "graph_side_packets.hpp"
 #include "outputstreamobserver.hpp"
 namespace ovms {
+class MediapipeServableMetricReporter;
 class OutputStreamObserverI;
 class NullOutputStreamObserver;
 struct ObserverHolder;
@@ -56,6 +61,7 @@ struct GraphHelper {
     const std::unordered_map<std::string, std::shared_ptr<ObserverHolder>> outStreamObservers;
     GenAiExecutionContextMap genAiExecutionContextMap;
     ::mediapipe::Timestamp currentTimestamp;
+    CalculatorProfileReporter profileReporter;
     GraphHelper() = default;
     // Constructor that takes the pre-built observer map
     GraphHelper(std::unordered_map<std::string, std::shared_ptr<ObserverHolder>>&& observers) :
@@ -66,58 +72,116 @@ struct GraphHelper {
         graph(std::move(gh.graph)),
         outStreamObservers(std::move(const_cast<std::unordered_map<std::string, std::shared_ptr<ObserverHolder>>&>(gh.outStreamObservers))),
         genAiExecutionContextMap(std::move(gh.genAiExecutionContextMap)),
-        currentTimestamp(gh.currentTimestamp) {}
+        currentTimestamp(gh.currentTimestamp),
+        profileReporter(std::move(gh.profileReporter)) {}
     GraphHelper& operator=(GraphHelper&&) = delete;
     ~GraphHelper();
     // Creates a fresh CalculatorGraph, initializes it with the config,
     // wires up output stream observers, builds side packets and starts the run.
     absl::Status initialize(const ::mediapipe::CalculatorGraphConfig& config, const GraphSidePackets& sidePacketMaps);
+    // Stops the current (errored) graph and resets observers and execution
+    // contexts, so that no callback refers to the failed request anymore.
+    void teardown();
     // Tears down the current (errored) graph and rebuilds a fresh one
     // with the same observers and side packets. Called when inference
     // encounters a graph error to avoid returning a poisoned graph to the pool.
     void reinitialize(const ::mediapipe::CalculatorGraphConfig& config, const GraphSidePackets& sidePacketMaps);
 };
 
-// RAII guard that reinitializes the graph if inference exits with an error.
-// Construct before the first graph interaction (packet push). Call dismiss()
-// on the success path. If not dismissed, the destructor rebuilds the graph
-// so the next request from the pool gets a clean graph.
-class GraphReinitGuard {
-    GraphHelper& helper;
-    const ::mediapipe::CalculatorGraphConfig& config;
-    const GraphSidePackets& sidePacketMaps;
-    bool dismissed = false;
-
-public:
-    GraphReinitGuard(GraphHelper& helper,
-        const ::mediapipe::CalculatorGraphConfig& config,
-        const GraphSidePackets& sidePacketMaps) :
-        helper(helper),
-        config(config),
-        sidePacketMaps(sidePacketMaps) {}
-    void dismiss() { dismissed = true; }
-    ~GraphReinitGuard() {
-        if (!dismissed) {
-            try {
-                helper.reinitialize(config, sidePacketMaps);
-            } catch (const std::exception& e) {
-                SPDLOG_ERROR("GraphReinitGuard: reinitialize threw: {}", e.what());
-            } catch (...) {
-                SPDLOG_ERROR("GraphReinitGuard: reinitialize threw unknown exception");
-            }
-        }
-    }
-    GraphReinitGuard(const GraphReinitGuard&) = delete;
-    GraphReinitGuard& operator=(const GraphReinitGuard&) = delete;
-};
-
 // we need to keep Graph alive during MP reload hence shared_ptr
+//
+// Elastic queue starts with minSize graphs and creates new ones up to maxSize
+// when all are in use. Every idleTimeout graphs above the peak usage in last
+// interval are destroyed, but never below minSize.
 class GraphQueue : public Queue<std::shared_ptr<GraphHelper>> {
+    // copy since graphs of elastic queue are created after construction
+    const ::mediapipe::CalculatorGraphConfig config;
     std::shared_ptr<GraphSidePackets> sidePacketMaps;
+    AdmissionController admissionController;
+    MediapipeServableMetricReporter* reporter = nullptr;
+
+    const int minSize;
+    const std::chrono::milliseconds idleTimeout;
+    // guards freeSlots and moving graphs in and out of inferRequests
+    std::mutex poolMtx;
+    // ids without created graph
+    std::vector<int> freeSlots;
+    std::atomic<int> graphsCount{0};
+    std::atomic<int> inUse{0};
+    // highest number of graphs used at once since last eviction
+    std::atomic<int> peakInUse{0};
+
+    std::mutex evictionMtx;
+    std::condition_variable evictionCv;
+    bool evictionStopped = false;
+    std::thread evictionThread;
+
+    // errored graphs are rebuilt by background thread started on first use
+    struct RebuildTask {
+        std::shared_ptr<GraphHelper> graphHelper;
+        // slot waiting for the graph, std::nullopt when rebuilt graph becomes spare
+        std::optional<int> id;
+    };
+    std::mutex rebuildMtx;
+    std::condition_variable rebuildCv;
+    std::deque<RebuildTask> rebuildTasks;
+    // prebuilt graphs swapped in place of errored graphs
+    std::vector<std::shared_ptr<GraphHelper>> spareGraphs;
+    size_t spareGraphsTarget = 0;
+    // notified when background thread adds spare graph
+    std::condition_variable spareGraphsCv;
+    bool rebuildStopped = false;
+    std::thread rebuildThread;
 
 public:
     GraphQueue(const ::mediapipe::CalculatorGraphConfig& config, std::shared_ptr<GraphSidePackets> sidePacketMaps, int streamsLength);
+    GraphQueue(const ::mediapipe::CalculatorGraphConfig& config, std::shared_ptr<GraphSidePackets> sidePacketMaps, int minSize, int maxSize, std::chrono::milliseconds idleTimeout);
     ~GraphQueue();
+    AdmissionController& getAdmissionController() { return admissionController; }
+    void setMetricReporter(MediapipeServableMetricReporter* reporter);
+
+    /**
+     * @brief Sets number of graphs prebuilt in background to replace errored graphs without waiting for rebuild
+     */
+    void setSpareGraphsCount(size_t count);
+    size_t getSpareGraphsCount();
+
+    /**
+     * @brief Blocks until spare graphs count reaches the number set with setSpareGraphsCount or timeout passes
+     *
+     * @return true if all spare graphs are built
+     */
+    bool waitForSpareGraphs(std::chrono::milliseconds timeout);
+
+    /**
+     * @brief Takes idle graph, creates new one if elastic queue is not full, otherwise blocks until any graph is returned
+     */
+    int acquireGraph();
+    void returnGraph(int id);
+
+    /**
+     * @brief Returns graph which failed during execution and has already been torn down
+     *
+     * Slot is back in service immediately with spare graph if available, errored graph is rebuilt in background.
+     */
+    void returnErroredGraph(int id);
+
+    /**
+     * @brief Destroys idle graphs above the peak usage since last call, keeping at least minSize graphs
+     *
+     * @return number of destroyed graphs
+     */
+    size_t evictIdleGraphs();
+
+    int getGraphsCount() const { return graphsCount.load(std::memory_order_relaxed); }
+    bool isElastic() const { return minSize < static_cast<int>(getStreamsCount()); }
+
+private:
+    std::shared_ptr<GraphHelper> createGraphHelper();
+    std::optional<int> tryToCreateGraph();
+    void evictionRoutine();
+    void scheduleRebuild(RebuildTask&& task);
+    void rebuildRoutine();
 };
 
 struct GraphIdGuard {
@@ -129,18 +193,61 @@ struct GraphIdGuard {
     // the old graph until completion.
     std::shared_ptr<GraphHelper> graphHelper;
     ::mediapipe::CalculatorGraph& graph;
+    // graph hold time is used by admission control to estimate wait for graph
+    const std::chrono::steady_clock::time_point acquired;
+    // graph failed and is rebuilt before being used again
+    bool errored = false;
     GraphIdGuard(std::shared_ptr<GraphQueue>& queue) :
         weakQueue(queue),
-        id(queue->getIdleStream().get()),
+        id(queue->acquireGraph()),
         graphHelper((queue->getInferRequest(id))),
-        graph(*graphHelper->graph) {
+        graph(*graphHelper->graph),
+        acquired(std::chrono::steady_clock::now()) {
     }
     GraphIdGuard(GraphIdGuard&&) = default;
     GraphIdGuard(const GraphIdGuard&) = delete;
     ~GraphIdGuard() {
         auto existingQueue = weakQueue.lock();
-        if (existingQueue)
-            existingQueue->returnStream(this->id);
+        if (existingQueue) {
+            auto& admissionController = existingQueue->getAdmissionController();
+            if (admissionController.isEnabled()) {
+                admissionController.recordServiceTime(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - acquired).count());
+            }
+            if (errored) {
+                existingQueue->returnErroredGraph(this->id);
+            } else {
+                existingQueue->returnGraph(this->id);
+            }
+        }
     }
 };
+
+// RAII guard that rebuilds the graph if inference exits with an error.
+// Construct before the first graph interaction (packet push). Call dismiss()
+// on the success path. If not dismissed, the destructor stops the errored graph
+// and marks it for rebuild, which is done by the queue in the background
+// so the failed request does not wait for it.
+class GraphReinitGuard {
+    GraphIdGuard& guard;
+    bool dismissed = false;
+
+public:
+    GraphReinitGuard(GraphIdGuard& guard) :
+        guard(guard) {}
+    void dismiss() { dismissed = true; }
+    ~GraphReinitGuard() {
+        if (!dismissed) {
+            try {
+                guard.graphHelper->teardown();
+            } catch (const std::exception& e) {
+                SPDLOG_ERROR("GraphReinitGuard: teardown threw: {}", e.what());
+            } catch (...) {
+                SPDLOG_ERROR("GraphReinitGuard: teardown threw unknown exception");
+            }
+            guard.errored = true;
+        }
+    }
+    GraphReinitGuard(const GraphReinitGuard&) = delete;
+    GraphReinitGuard& operator=(const GraphReinitGuard&) = delete;
+};
 }  // namespace ovms
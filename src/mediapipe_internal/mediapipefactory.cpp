@@ -67,10 +67,19 @@ Status MediapipeFactory::createDefinition(const std::string& pipelineName,
     if (stat.getCode() == StatusCode::MEDIAPIPE_GRAPH_NAME_OCCUPIED) {
         return stat;
     }
+    // graphs are validated concurrently on config load, so existence has to be checked again under the same lock as insertion
     std::unique_lock lock(definitionsMtx);
-    definitions.insert({pipelineName, std::move(graphDefinition)});
+    if (loraAliases.find(pipelineName) != loraAliases.end()) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Mediapipe graph definition: {} is already created", pipelineName);
+        return StatusCode::PIPELINE_DEFINITION_ALREADY_EXIST;
+    }
+    auto [it, inserted] = definitions.try_emplace(pipelineName, std::move(graphDefinition));
+    if (!inserted) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Mediapipe graph definition: {} is already created", pipelineName);
+        return StatusCode::PIPELINE_DEFINITION_ALREADY_EXIST;
+    }
     // Register LoRA aliases discovered during validation (image gen graphs)
-    const auto& def = definitions[pipelineName];
+    const auto& def = it->second;
     for (const auto& alias : def->getLoraAliases()) {
         loraAliases[alias] = pipelineName;
         SPDLOG_LOGGER_INFO(modelmanager_logger, "Registered LoRA alias: {} -> {}", alias, pipelineName);
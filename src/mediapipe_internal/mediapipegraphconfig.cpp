@@ -72,6 +72,14 @@ bool MediapipeGraphConfig::isReloadRequired(const MediapipeGraphConfig& rhs) con
         SPDLOG_DEBUG("MediapipeGraphConfig {} reload required due to subconfigPath mismatch", this->graphName);
         return true;
     }
+    if (this->maxPendingRequests != rhs.maxPendingRequests || this->maxQueueWaitMs != rhs.maxQueueWaitMs) {
+        SPDLOG_DEBUG("MediapipeGraphConfig {} reload required due to admission control limits mismatch", this->graphName);
+        return true;
+    }
+    if (this->calculatorMetrics != rhs.calculatorMetrics) {
+        SPDLOG_DEBUG("MediapipeGraphConfig {} reload required due to calculator metrics setting mismatch", this->graphName);
+        return true;
+    }
     // Checking if graph pbtxt has been modified
     if (currentGraphPbTxtMD5 != "") {
         std::string newGraphPbTxtMD5 = FileSystem::getFileMD5(rhs.graphPath);
@@ -119,6 +127,15 @@ Status MediapipeGraphConfig::parseNode(const rapidjson::Value& v) {
             this->setSubconfigPath(DEFAULT_SUBCONFIG_FILENAME);
             this->setModelMeshSubconfigPath(DEFAULT_MODELMESH_SUBCONFIG_FILENAME);
         }
+        if (v.HasMember("max_pending_requests")) {
+            this->setMaxPendingRequests(v["max_pending_requests"].GetUint());
+        }
+        if (v.HasMember("max_queue_wait_ms")) {
+            this->setMaxQueueWaitMs(v["max_queue_wait_ms"].GetUint());
+        }
+        if (v.HasMember("calculator_metrics")) {
+            this->setCalculatorMetrics(v["calculator_metrics"].GetBool());
+        }
     } catch (std::logic_error& e) {
         SPDLOG_DEBUG("Relative path error: {}", e.what());
         return StatusCode::INTERNAL_ERROR;
@@ -15,6 +15,8 @@
 //*****************************************************************************
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <optional>
 #include <string>
 
@@ -65,7 +67,41 @@ private:
      */
     std::optional<int> graphQueueSize;
 
+    /**
+     * @brief Minimal number of graphs kept in graph queue, when lower than graphQueueSize queue grows with load up to graphQueueSize
+     *
+     * - std::nullopt => queue keeps graphQueueSize graphs
+     */
+    std::optional<int> graphQueueMinSize;
+
+    /**
+     * @brief Interval in milliseconds after which graphs above peak usage are destroyed in elastic graph queue
+     */
+    uint32_t graphQueueIdleTimeoutMs = DEFAULT_GRAPH_QUEUE_IDLE_TIMEOUT_MS;
+
+    /**
+     * @brief Number of graphs prebuilt to replace graphs from graph queue which failed during execution
+     */
+    uint32_t graphQueueSpareGraphs = 0;
+
+    /**
+     * @brief Maximum number of requests waiting for graph from graph queue, 0 means no limit
+     */
+    uint32_t maxPendingRequests = 0;
+
+    /**
+     * @brief Maximum estimated time request would wait for graph from graph queue in milliseconds, 0 means no limit
+     */
+    uint32_t maxQueueWaitMs = 0;
+
+    /**
+     * @brief Enables MediaPipe graph profiler and reporting of per calculator metrics
+     */
+    bool calculatorMetrics = false;
+
 public:
+    static constexpr uint32_t DEFAULT_GRAPH_QUEUE_IDLE_TIMEOUT_MS = 60000;
+
     MediapipeGraphConfig(const std::string& graphName = "",
         const std::string& basePath = "",
         const std::string& graphPath = "",
@@ -147,6 +183,30 @@ public:
      *
      * @return const std::optional<int>& - nullopt if disabled, positive int if enabled
      */
+    uint32_t getMaxPendingRequests() const {
+        return this->maxPendingRequests;
+    }
+
+    void setMaxPendingRequests(uint32_t maxPendingRequests) {
+        this->maxPendingRequests = maxPendingRequests;
+    }
+
+    uint32_t getMaxQueueWaitMs() const {
+        return this->maxQueueWaitMs;
+    }
+
+    void setMaxQueueWaitMs(uint32_t maxQueueWaitMs) {
+        this->maxQueueWaitMs = maxQueueWaitMs;
+    }
+
+    bool isCalculatorMetricsEnabled() const {
+        return this->calculatorMetrics;
+    }
+
+    void setCalculatorMetrics(bool calculatorMetrics) {
+        this->calculatorMetrics = calculatorMetrics;
+    }
+
     const std::optional<int>& getGraphQueueSize() const {
         return this->graphQueueSize;
     }
@@ -170,6 +230,37 @@ public:
         return this->graphQueueSize.value_or(0);
     }
 
+    void setGraphQueueMinSize(int size) {
+        this->graphQueueMinSize = size;
+    }
+
+    void clearGraphQueueMinSize() {
+        this->graphQueueMinSize.reset();
+    }
+
+    /**
+     * @brief Get the minimal graph queue size, equal to graph queue size unless queue is elastic.
+     */
+    int getGraphQueueMinSize() const {
+        return std::min(this->graphQueueMinSize.value_or(getInitialQueueSize()), getInitialQueueSize());
+    }
+
+    uint32_t getGraphQueueIdleTimeoutMs() const {
+        return this->graphQueueIdleTimeoutMs;
+    }
+
+    void setGraphQueueIdleTimeoutMs(uint32_t idleTimeoutMs) {
+        this->graphQueueIdleTimeoutMs = idleTimeoutMs;
+    }
+
+    uint32_t getGraphQueueSpareGraphs() const {
+        return this->graphQueueSpareGraphs;
+    }
+
+    void setGraphQueueSpareGraphs(uint32_t spareGraphs) {
+        this->graphQueueSpareGraphs = spareGraphs;
+    }
+
     bool isReloadRequired(const MediapipeGraphConfig& rhs) const;
 
     /**
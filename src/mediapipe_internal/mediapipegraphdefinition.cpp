@@ -16,6 +16,7 @@
 #include "mediapipegraphdefinition.hpp"
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <regex>
@@ -146,6 +147,10 @@ Status MediapipeGraphDefinition::resolveGraphQueueSize() {
             }
             this->mgconfig.setGraphQueueSize(queueSize);
         }
+        auto status = resolveGraphQueuePoolSettings();
+        if (!status.ok()) {
+            return status;
+        }
         // 2. Reject PythonExecutorCalculator nodes using LOOPBACK with graph queue enabled.
         //    Generative Python nodes hold per-request iterator state that cannot be shared
         //    across pooled graph instances.
@@ -195,6 +200,58 @@ Status MediapipeGraphDefinition::resolveGraphQueueSize() {
     return StatusCode::OK;
 }
 
+// Optional pbtxt directives making graph queue grow with load from OVMS_GRAPH_QUEUE_MIN_SIZE
+// up to OVMS_GRAPH_QUEUE_MAX_SIZE graphs and shrink after OVMS_GRAPH_QUEUE_IDLE_TIMEOUT_MS without load.
+// OVMS_GRAPH_QUEUE_SPARE_GRAPHS sets number of graphs prebuilt to replace errored graphs.
+Status MediapipeGraphDefinition::resolveGraphQueuePoolSettings() {
+    this->mgconfig.clearGraphQueueMinSize();
+    this->mgconfig.setGraphQueueIdleTimeoutMs(MediapipeGraphConfig::DEFAULT_GRAPH_QUEUE_IDLE_TIMEOUT_MS);
+    this->mgconfig.setGraphQueueSpareGraphs(0);
+    static const std::regex minSizeRegex(
+        R"((?:^|\n)\s*#\s*OVMS_GRAPH_QUEUE_MIN_SIZE\s*:\s*(\S+)\s*(?:\r?\n|$))");
+    static const std::regex idleTimeoutRegex(
+        R"((?:^|\n)\s*#\s*OVMS_GRAPH_QUEUE_IDLE_TIMEOUT_MS\s*:\s*(\S+)\s*(?:\r?\n|$))");
+    static const std::regex spareGraphsRegex(
+        R"((?:^|\n)\s*#\s*OVMS_GRAPH_QUEUE_SPARE_GRAPHS\s*:\s*(\S+)\s*(?:\r?\n|$))");
+    std::smatch match;
+    if (std::regex_search(this->chosenConfig, match, minSizeRegex)) {
+        std::string value = match[1].str();
+        auto parsed = stoi32(value);
+        if (!parsed.has_value() || parsed.value() < 1) {
+            SPDLOG_ERROR("Invalid OVMS_GRAPH_QUEUE_MIN_SIZE value: '{}'. Must be a positive integer.", value);
+            return StatusCode::MEDIAPIPE_GRAPH_CONFIG_FILE_INVALID;
+        }
+        int maxSize = this->mgconfig.getInitialQueueSize();
+        if (parsed.value() > maxSize) {
+            SPDLOG_WARN("OVMS_GRAPH_QUEUE_MIN_SIZE value: {} exceeds graph queue size: {}. Clamping to {}.", parsed.value(), maxSize, maxSize);
+        }
+        this->mgconfig.setGraphQueueMinSize(std::min(parsed.value(), maxSize));
+    }
+    if (std::regex_search(this->chosenConfig, match, idleTimeoutRegex)) {
+        std::string value = match[1].str();
+        auto parsed = stou32(value);
+        if (!parsed.has_value() || parsed.value() == 0) {
+            SPDLOG_ERROR("Invalid OVMS_GRAPH_QUEUE_IDLE_TIMEOUT_MS value: '{}'. Must be a positive integer.", value);
+            return StatusCode::MEDIAPIPE_GRAPH_CONFIG_FILE_INVALID;
+        }
+        this->mgconfig.setGraphQueueIdleTimeoutMs(parsed.value());
+    }
+    if (std::regex_search(this->chosenConfig, match, spareGraphsRegex)) {
+        std::string value = match[1].str();
+        auto parsed = stou32(value);
+        if (!parsed.has_value()) {
+            SPDLOG_ERROR("Invalid OVMS_GRAPH_QUEUE_SPARE_GRAPHS value: '{}'. Must be 0 or a positive integer.", value);
+            return StatusCode::MEDIAPIPE_GRAPH_CONFIG_FILE_INVALID;
+        }
+        uint32_t maxSize = static_cast<uint32_t>(this->mgconfig.getInitialQueueSize());
+        if (parsed.value() > maxSize) {
+            SPDLOG_WARN("OVMS_GRAPH_QUEUE_SPARE_GRAPHS value: {} exceeds graph queue size: {}. Clamping to {}.", parsed.value(), maxSize, maxSize);
+        }
+        this->mgconfig.setGraphQueueSpareGraphs(std::min(parsed.value(), maxSize));
+    }
+    return StatusCode::OK;
+}
+
 Status MediapipeGraphDefinition::validateForConfigLoadableness() {
     if (this->chosenConfig.empty()) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Trying to parse empty mediapipe graph definition: {} failed", this->getName(), this->chosenConfig);
@@ -229,6 +286,7 @@ Status MediapipeGraphDefinition::dryInitializeTest() {
 }
 Status MediapipeGraphDefinition::validate(const ServableNameChecker& checker) {
     SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Started validation of mediapipe: {}", getName());
+    auto loadStart = std::chrono::steady_clock::now();
     if (!this->sidePacketMaps->empty()) {
         SPDLOG_ERROR("Internal Error: MediaPipe definition is in unexpected state.");
         return StatusCode::INTERNAL_ERROR;
@@ -250,6 +308,9 @@ Status MediapipeGraphDefinition::validate(const ServableNameChecker& checker) {
     if (!validationResult.ok()) {
         return validationResult;
     }
+    if (this->mgconfig.isCalculatorMetricsEnabled()) {
+        this->config.mutable_profiler_config()->set_enable_profiler(true);
+    }
     std::unique_lock lock(metadataMtx);
     auto status = createInputsInfo();
     if (!status.ok()) {
@@ -297,6 +358,9 @@ Status MediapipeGraphDefinition::validate(const ServableNameChecker& checker) {
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Mediapipe: {} inputs: {}", getName(), getTensorMapString(inputsInfo));
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Mediapipe: {} outputs: {}", getName(), getTensorMapString(outputsInfo));
     SPDLOG_LOGGER_INFO(modelmanager_logger, "Mediapipe: {} kfs pass through: {}", getName(), this->passKfsRequestFlag);
+    auto loadTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - loadStart).count();
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Loaded mediapipe: {} in {} ms", getName(), loadTimeUs / 1000);
+    SET_IF_ENABLED(this->reporter->loadTime, loadTimeUs);
     return StatusCode::OK;
 }
 
@@ -306,8 +370,14 @@ Status MediapipeGraphDefinition::initializeQueueIfRequired() {
         SPDLOG_DEBUG("Graph queue creation disabled for mediapipe: {} (graph_queue_size={})", getName(), initialQueueSize);
         return StatusCode::OK;
     }
+    int minQueueSize = this->mgconfig.getGraphQueueMinSize();
     try {
-        this->queue = std::make_shared<GraphQueue>(this->config, this->sidePacketMaps, initialQueueSize);
+        if (minQueueSize < initialQueueSize) {
+            this->queue = std::make_shared<GraphQueue>(this->config, this->sidePacketMaps, minQueueSize, initialQueueSize,
+                std::chrono::milliseconds(this->mgconfig.getGraphQueueIdleTimeoutMs()));
+        } else {
+            this->queue = std::make_shared<GraphQueue>(this->config, this->sidePacketMaps, initialQueueSize);
+        }
     } catch (const std::exception& e) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to create graph queue for mediapipe: {} error: {}", getName(), e.what());
         return StatusCode::INTERNAL_ERROR;
@@ -315,7 +385,14 @@ Status MediapipeGraphDefinition::initializeQueueIfRequired() {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to create graph queue for mediapipe: {} unknown error", getName());
         return StatusCode::INTERNAL_ERROR;
     }
-    SPDLOG_DEBUG("Created graph queue with size {} for mediapipe: {}", initialQueueSize, getName());
+    this->queue->setMetricReporter(this->reporter.get());
+    this->queue->setSpareGraphsCount(this->mgconfig.getGraphQueueSpareGraphs());
+    this->queue->getAdmissionController().setLimits(this->mgconfig.getMaxPendingRequests(), this->mgconfig.getMaxQueueWaitMs());
+    if (this->queue->isElastic()) {
+        SPDLOG_DEBUG("Created graph queue with size from {} to {} for mediapipe: {}", minQueueSize, initialQueueSize, getName());
+    } else {
+        SPDLOG_DEBUG("Created graph queue with size {} for mediapipe: {}", initialQueueSize, getName());
+    }
     return StatusCode::OK;
 }
 
@@ -395,6 +472,15 @@ Status MediapipeGraphDefinition::create(std::unique_ptr<MediapipeGraphExecutor>&
     }
     SPDLOG_DEBUG("Creating Mediapipe graph executor: {}", getName());
     if (this->queue) {
+        auto& admissionController = this->queue->getAdmissionController();
+        if (admissionController.isEnabled()) {
+            status = admissionController.admit(this->queue->getWaitersCount(), this->queue->getStreamsCount());
+            if (!status.ok()) {
+                INCREMENT_IF_ENABLED(this->reporter->requestsShed);
+                SPDLOG_DEBUG("Shedding request to mediapipe graph: {}", getName());
+                return status;
+            }
+        }
         GraphIdGuard graphIdGuard(this->queue);
         pipeline = std::make_unique<MediapipeGraphExecutor>(getName(), std::to_string(getVersion()),
             this->config, this->inputTypes, this->outputTypes, this->inputNames, this->outputNames,
@@ -527,7 +613,7 @@ Status MediapipeGraphDefinition::initializeNodes() {
     for (int i = 0; i < config.node().size(); i++) {
         for (const auto& initializer : registry.all()) {
             if (initializer->matches(config.node(i).calculator())) {
-                Status status = initializer->initialize(config.node(i), getName(), mgconfig.getBasePath(), *sidePacketMaps, pythonBackend);
+                Status status = initializer->initialize(config.node(i), getName(), mgconfig.getBasePath(), *sidePacketMaps, pythonBackend, this->reporter.get());
                 if (!status.ok()) {
                     return status;
                 }
@@ -105,6 +105,7 @@ protected:
 
     virtual Status validateForConfigFileExistence();
     Status resolveGraphQueueSize();
+    Status resolveGraphQueuePoolSettings();
     int resolveAutoQueueSize();
     Status validateForConfigLoadableness();
 
@@ -83,4 +83,10 @@ MediapipeGraphExecutor::MediapipeGraphExecutor(
     currentStreamTimestamp(::mediapipe::Timestamp(STARTING_TIMESTAMP_VALUE)),
     mediapipeServableMetricReporter(mediapipeServableMetricReporter) {}
 
+void MediapipeGraphExecutor::reportCalculatorMetrics(::mediapipe::CalculatorGraph& graph, CalculatorProfileReporter& profileReporter) {
+    if (!this->config.profiler_config().enable_profiler() || !this->mediapipeServableMetricReporter->hasCalculatorMetrics()) {
+        return;
+    }
+    profileReporter.report(graph, *this->mediapipeServableMetricReporter);
+}
 }  // namespace ovms
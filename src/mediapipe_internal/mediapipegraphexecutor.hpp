@@ -38,6 +38,7 @@
 #include "mediapipe/framework/port/status.h"
 #pragma GCC diagnostic pop
 #pragma warning(pop)
+#include "calculator_profile_reporter.hpp"
 #include "graph_executor_constants.hpp"
 #include "mediapipe_utils.hpp"
 #include "graph_side_packets.hpp"
@@ -54,6 +55,9 @@ inline StatusCode mediapipeAbslToOvmsStatus(absl::StatusCode code) {
     if (code == absl::StatusCode::kFailedPrecondition) {  // ovms session calculator returns this status code when loading model fails
         return StatusCode::MEDIAPIPE_PRECONDITION_FAILED;
     }
+    if (code == absl::StatusCode::kResourceExhausted) {  // calculators reject requests which cannot be queued
+        return StatusCode::SERVABLE_OVERLOADED;
+    }
     return StatusCode::MEDIAPIPE_EXECUTION_ERROR;
 }
 
@@ -141,6 +145,8 @@ private:
     MediapipeServableMetricReporter* mediapipeServableMetricReporter;
     std::optional<GraphIdGuard> guard;
 
+    void reportCalculatorMetrics(::mediapipe::CalculatorGraph& graph, CalculatorProfileReporter& profileReporter);
+
 public:
     MediapipeGraphExecutor(const std::string& name,
         const std::string& version,
@@ -198,7 +204,7 @@ public:
             guard->graphHelper->outStreamObservers.at(name)->current = std::make_shared<MyFunctor<RequestType, ResponseType>>(name, this->outputTypes.at(name), *this, *request, *response);
         }
 
-        GraphReinitGuard reinitOnFailureGuard(*this->guard->graphHelper, this->config, this->sidePacketMaps);
+        GraphReinitGuard reinitOnFailureGuard(*this->guard);
 
         size_t numberOfPacketsCreated = 0;
         ::mediapipe::CalculatorGraph& graph = this->guard->graph;
@@ -230,6 +236,7 @@ public:
         resetLlmExecutionContexts(this->guard->graphHelper->genAiExecutionContextMap);
         MP_RETURN_ON_FAIL(status, "graph wait until idle", mediapipeAbslToOvmsStatus(status.code()));
         reinitOnFailureGuard.dismiss();
+        reportCalculatorMetrics(graph, this->guard->graphHelper->profileReporter);
         // Increment timestamp for next request reusing this graph from the queue
         this->guard->graphHelper->currentTimestamp = ::mediapipe::Timestamp(this->guard->graphHelper->currentTimestamp.Value() + 1);
         SPDLOG_DEBUG("Received all output stream packets for graph: {}", this->name);
@@ -329,6 +336,8 @@ public:
             INCREMENT_IF_ENABLED(this->mediapipeServableMetricReporter->getGraphErrorMetric(executionContext));
         }
         MP_RETURN_ON_FAIL(status, "graph wait until done", mediapipeAbslToOvmsStatus(status.code()));
+        CalculatorProfileReporter profileReporter;
+        reportCalculatorMetrics(graph, profileReporter);
         if (outputPollers.size() != outputPollersWithReceivedPacket.size()) {
             SPDLOG_DEBUG("Mediapipe failed to execute. Failed to receive all output packets");
             return Status(StatusCode::MEDIAPIPE_EXECUTION_ERROR, "Unknown error during mediapipe execution");
@@ -395,7 +404,7 @@ public:
                     executionContext, this->mediapipeServableMetricReporter);
             }
 
-            GraphReinitGuard reinitOnFailureGuard(*this->guard->graphHelper, this->config, this->sidePacketMaps);
+            GraphReinitGuard reinitOnFailureGuard(*this->guard);
 
             size_t numberOfPacketsCreated = 0;
             ::mediapipe::CalculatorGraph& graph = this->guard->graph;
@@ -456,6 +465,7 @@ public:
             resetLlmExecutionContexts(this->guard->graphHelper->genAiExecutionContextMap);
             MP_RETURN_ON_FAIL(status, "graph wait until idle", mediapipeAbslToOvmsStatus(status.code()));
             reinitOnFailureGuard.dismiss();
+            reportCalculatorMetrics(graph, this->guard->graphHelper->profileReporter);
             // Increment timestamp for next request reusing this graph from the queue
             this->guard->graphHelper->currentTimestamp = ::mediapipe::Timestamp(this->guard->graphHelper->currentTimestamp.Value() + 1);
             SPDLOG_DEBUG("Graph {}: Done streaming execution (queue path)", this->name);
@@ -607,6 +617,8 @@ public:
                 }
                 resetLlmExecutionContexts(this->sidePacketMaps.genAiExecutionContextMap);
                 MP_RETURN_ON_FAIL(status, "graph wait until done", mediapipeAbslToOvmsStatus(status.code()));
+                CalculatorProfileReporter profileReporter;
+                reportCalculatorMetrics(graph, profileReporter);
                 SPDLOG_DEBUG("Graph {}: Done execution", this->name);
             }
             timer.stop(PROCESS);
@@ -26,6 +26,7 @@ class CalculatorGraphConfig_Node;
 
 namespace ovms {
 struct GraphSidePackets;
+class MediapipeServableMetricReporter;
 class PythonBackend;
 
 class NodeInitializer {
@@ -37,7 +38,8 @@ public:
         const std::string& graphName,
         const std::string& basePath,
         GraphSidePackets& sidePackets,
-        PythonBackend* pythonBackend) = 0;
+        PythonBackend* pythonBackend,
+        MediapipeServableMetricReporter* metricReporter) = 0;
 };
 
 class NodeInitializerRegistry {
@@ -52,6 +52,53 @@ const std::string METRIC_NAME_INFERENCE_TIME = "ovms_inference_time_us";
 const std::string METRIC_NAME_CURRENT_REQUESTS = "ovms_current_requests";
 const std::string METRIC_NAME_REQUEST_TIME = "ovms_request_time_us";
 const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME = "ovms_wait_for_infer_req_time_us";
+const std::string METRIC_NAME_REST_REQUEST_COPIED_BYTES = "ovms_rest_request_copied_bytes";
+
+const std::string METRIC_NAME_REQUESTS_DEADLINE_DROPPED = "ovms_requests_deadline_dropped";
+const std::string METRIC_NAME_REQUESTS_SHED = "ovms_requests_shed";
+
+const std::string METRIC_NAME_SHAPE_VARIANT_HITS = "ovms_shape_variant_hits";
+const std::string METRIC_NAME_SHAPE_VARIANT_MISSES = "ovms_shape_variant_misses";
+const std::string METRIC_NAME_SHAPE_VARIANT_COMPILE_TIME = "ovms_shape_variant_compile_time_us";
+
+const std::string METRIC_NAME_LOAD_TIME = "ovms_load_time_us";
+
+const std::string METRIC_NAME_PIPELINE_NODE_TIME = "ovms_pipeline_node_time_us";
+
+const std::string METRIC_NAME_CUSTOM_NODE_ARENA_HITS = "ovms_custom_node_arena_hits";
+const std::string METRIC_NAME_CUSTOM_NODE_ARENA_MISSES = "ovms_custom_node_arena_misses";
+const std::string METRIC_NAME_CUSTOM_NODE_ARENA_CACHED_BYTES = "ovms_custom_node_arena_cached_bytes";
+
+const std::string METRIC_NAME_GRAPH_POOL_SIZE = "ovms_graph_pool_size";
+const std::string METRIC_NAME_GRAPH_POOL_IN_USE = "ovms_graph_pool_in_use";
+const std::string METRIC_NAME_GRAPH_POOL_WAIT_TIME = "ovms_graph_pool_wait_time_us";
+const std::string METRIC_NAME_GRAPH_POOL_CREATION_TIME = "ovms_graph_pool_creation_time_us";
+const std::string METRIC_NAME_GRAPH_REBUILDS = "ovms_graph_rebuilds";
+const std::string METRIC_NAME_GRAPH_REBUILD_TIME = "ovms_graph_rebuild_time_us";
+const std::string METRIC_NAME_GRAPH_CALCULATOR_PROCESS_TIME = "ovms_graph_calculator_process_time_us";
+const std::string METRIC_NAME_GRAPH_CALCULATOR_INPUT_WAIT_TIME = "ovms_graph_calculator_input_wait_time_us";
+
+const std::string METRIC_NAME_LLM_TIME_TO_FIRST_TOKEN = "ovms_llm_time_to_first_token_us";
+const std::string METRIC_NAME_LLM_TIME_PER_OUTPUT_TOKEN = "ovms_llm_time_per_output_token_us";
+const std::string METRIC_NAME_LLM_PREFILL_SPEED = "ovms_llm_prefill_tokens_per_second";
+const std::string METRIC_NAME_LLM_PROMPT_TOKENS = "ovms_llm_prompt_tokens";
+const std::string METRIC_NAME_LLM_GENERATED_TOKENS = "ovms_llm_generated_tokens";
+const std::string METRIC_NAME_LLM_WAITING_REQUESTS = "ovms_llm_waiting_requests";
+const std::string METRIC_NAME_LLM_RUNNING_REQUESTS = "ovms_llm_running_requests";
+const std::string METRIC_NAME_LLM_KV_CACHE_USAGE_BYTES = "ovms_llm_kv_cache_usage_bytes";
+const std::string METRIC_NAME_LLM_KV_CACHE_USAGE_PERCENT = "ovms_llm_kv_cache_usage_percent";
+const std::string METRIC_NAME_LLM_QUEUED_REQUESTS = "ovms_llm_queued_requests";
+const std::string METRIC_NAME_LLM_ADMITTED_REQUESTS = "ovms_llm_admitted_requests";
+const std::string METRIC_NAME_LLM_REJECTED_REQUESTS = "ovms_llm_rejected_requests";
+const std::string METRIC_NAME_LLM_CLASS_TIME_TO_FIRST_TOKEN = "ovms_llm_class_time_to_first_token_us";
+const std::string METRIC_NAME_LLM_REPLICA_ROUTED_REQUESTS = "ovms_llm_replica_routed_requests";
+const std::string METRIC_NAME_LLM_REPLICA_AFFINITY_ROUTED_REQUESTS = "ovms_llm_replica_affinity_routed_requests";
+const std::string METRIC_NAME_LLM_REPLICA_OUTSTANDING_TOKENS = "ovms_llm_replica_outstanding_tokens";
+const std::string METRIC_NAME_LLM_REPLICA_RUNNING_REQUESTS = "ovms_llm_replica_running_requests";
+const std::string METRIC_NAME_LLM_REPLICA_KV_CACHE_USAGE_PERCENT = "ovms_llm_replica_kv_cache_usage_percent";
+const std::string METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_HITS = "ovms_llm_chat_template_cache_hits";
+const std::string METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_MISSES = "ovms_llm_chat_template_cache_misses";
+const std::string METRIC_NAME_LLM_CHAT_TEMPLATE_RENDER_TIME_SAVED = "ovms_llm_chat_template_render_time_saved_us";
 
 // MediaPipe
 const std::string METRIC_NAME_CURRENT_GRAPHS = "ovms_current_graphs";
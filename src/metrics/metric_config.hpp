@@ -38,6 +38,53 @@ extern const std::string METRIC_NAME_INFERENCE_TIME;
 extern const std::string METRIC_NAME_CURRENT_REQUESTS;
 extern const std::string METRIC_NAME_REQUEST_TIME;
 extern const std::string METRIC_NAME_WAIT_FOR_INFER_REQ_TIME;
+extern const std::string METRIC_NAME_REST_REQUEST_COPIED_BYTES;
+
+extern const std::string METRIC_NAME_REQUESTS_DEADLINE_DROPPED;
+extern const std::string METRIC_NAME_REQUESTS_SHED;
+
+extern const std::string METRIC_NAME_SHAPE_VARIANT_HITS;
+extern const std::string METRIC_NAME_SHAPE_VARIANT_MISSES;
+extern const std::string METRIC_NAME_SHAPE_VARIANT_COMPILE_TIME;
+
+extern const std::string METRIC_NAME_LOAD_TIME;
+
+extern const std::string METRIC_NAME_PIPELINE_NODE_TIME;
+
+extern const std::string METRIC_NAME_CUSTOM_NODE_ARENA_HITS;
+extern const std::string METRIC_NAME_CUSTOM_NODE_ARENA_MISSES;
+extern const std::string METRIC_NAME_CUSTOM_NODE_ARENA_CACHED_BYTES;
+
+extern const std::string METRIC_NAME_GRAPH_POOL_SIZE;
+extern const std::string METRIC_NAME_GRAPH_POOL_IN_USE;
+extern const std::string METRIC_NAME_GRAPH_POOL_WAIT_TIME;
+extern const std::string METRIC_NAME_GRAPH_POOL_CREATION_TIME;
+extern const std::string METRIC_NAME_GRAPH_REBUILDS;
+extern const std::string METRIC_NAME_GRAPH_REBUILD_TIME;
+extern const std::string METRIC_NAME_GRAPH_CALCULATOR_PROCESS_TIME;
+extern const std::string METRIC_NAME_GRAPH_CALCULATOR_INPUT_WAIT_TIME;
+
+extern const std::string METRIC_NAME_LLM_TIME_TO_FIRST_TOKEN;
+extern const std::string METRIC_NAME_LLM_TIME_PER_OUTPUT_TOKEN;
+extern const std::string METRIC_NAME_LLM_PREFILL_SPEED;
+extern const std::string METRIC_NAME_LLM_PROMPT_TOKENS;
+extern const std::string METRIC_NAME_LLM_GENERATED_TOKENS;
+extern const std::string METRIC_NAME_LLM_WAITING_REQUESTS;
+extern const std::string METRIC_NAME_LLM_RUNNING_REQUESTS;
+extern const std::string METRIC_NAME_LLM_KV_CACHE_USAGE_BYTES;
+extern const std::string METRIC_NAME_LLM_KV_CACHE_USAGE_PERCENT;
+extern const std::string METRIC_NAME_LLM_QUEUED_REQUESTS;
+extern const std::string METRIC_NAME_LLM_ADMITTED_REQUESTS;
+extern const std::string METRIC_NAME_LLM_REJECTED_REQUESTS;
+extern const std::string METRIC_NAME_LLM_CLASS_TIME_TO_FIRST_TOKEN;
+extern const std::string METRIC_NAME_LLM_REPLICA_ROUTED_REQUESTS;
+extern const std::string METRIC_NAME_LLM_REPLICA_AFFINITY_ROUTED_REQUESTS;
+extern const std::string METRIC_NAME_LLM_REPLICA_OUTSTANDING_TOKENS;
+extern const std::string METRIC_NAME_LLM_REPLICA_RUNNING_REQUESTS;
+extern const std::string METRIC_NAME_LLM_REPLICA_KV_CACHE_USAGE_PERCENT;
+extern const std::string METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_HITS;
+extern const std::string METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_MISSES;
+extern const std::string METRIC_NAME_LLM_CHAT_TEMPLATE_RENDER_TIME_SAVED;
 
 // MediaPipe
 extern const std::string METRIC_NAME_CURRENT_GRAPHS;
@@ -89,7 +136,47 @@ private:
 
     std::unordered_set<std::string> additionalMetricFamilies = {
         {METRIC_NAME_INFER_REQ_QUEUE_SIZE},
-        {METRIC_NAME_INFER_REQ_ACTIVE}};
+        {METRIC_NAME_INFER_REQ_ACTIVE},
+        {METRIC_NAME_REST_REQUEST_COPIED_BYTES},
+        {METRIC_NAME_REQUESTS_DEADLINE_DROPPED},
+        {METRIC_NAME_REQUESTS_SHED},
+        {METRIC_NAME_SHAPE_VARIANT_HITS},
+        {METRIC_NAME_SHAPE_VARIANT_MISSES},
+        {METRIC_NAME_SHAPE_VARIANT_COMPILE_TIME},
+        {METRIC_NAME_LOAD_TIME},
+        {METRIC_NAME_PIPELINE_NODE_TIME},
+        {METRIC_NAME_CUSTOM_NODE_ARENA_HITS},
+        {METRIC_NAME_CUSTOM_NODE_ARENA_MISSES},
+        {METRIC_NAME_CUSTOM_NODE_ARENA_CACHED_BYTES},
+        {METRIC_NAME_GRAPH_POOL_SIZE},
+        {METRIC_NAME_GRAPH_POOL_IN_USE},
+        {METRIC_NAME_GRAPH_POOL_WAIT_TIME},
+        {METRIC_NAME_GRAPH_POOL_CREATION_TIME},
+        {METRIC_NAME_GRAPH_REBUILDS},
+        {METRIC_NAME_GRAPH_REBUILD_TIME},
+        {METRIC_NAME_GRAPH_CALCULATOR_PROCESS_TIME},
+        {METRIC_NAME_GRAPH_CALCULATOR_INPUT_WAIT_TIME},
+        {METRIC_NAME_LLM_TIME_TO_FIRST_TOKEN},
+        {METRIC_NAME_LLM_TIME_PER_OUTPUT_TOKEN},
+        {METRIC_NAME_LLM_PREFILL_SPEED},
+        {METRIC_NAME_LLM_PROMPT_TOKENS},
+        {METRIC_NAME_LLM_GENERATED_TOKENS},
+        {METRIC_NAME_LLM_WAITING_REQUESTS},
+        {METRIC_NAME_LLM_RUNNING_REQUESTS},
+        {METRIC_NAME_LLM_KV_CACHE_USAGE_BYTES},
+        {METRIC_NAME_LLM_KV_CACHE_USAGE_PERCENT},
+        {METRIC_NAME_LLM_QUEUED_REQUESTS},
+        {METRIC_NAME_LLM_ADMITTED_REQUESTS},
+        {METRIC_NAME_LLM_REJECTED_REQUESTS},
+        {METRIC_NAME_LLM_CLASS_TIME_TO_FIRST_TOKEN},
+        {METRIC_NAME_LLM_REPLICA_ROUTED_REQUESTS},
+        {METRIC_NAME_LLM_REPLICA_AFFINITY_ROUTED_REQUESTS},
+        {METRIC_NAME_LLM_REPLICA_OUTSTANDING_TOKENS},
+        {METRIC_NAME_LLM_REPLICA_RUNNING_REQUESTS},
+        {METRIC_NAME_LLM_REPLICA_KV_CACHE_USAGE_PERCENT},
+        {METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_HITS},
+        {METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_MISSES},
+        {METRIC_NAME_LLM_CHAT_TEMPLATE_RENDER_TIME_SAVED}};
 
     std::unordered_set<std::string> defaultMetricFamilies = {
         {METRIC_NAME_CURRENT_REQUESTS},
@@ -166,6 +166,17 @@ ServableMetricReporter::ServableMetricReporter(const MetricConfig* metricConfig,
             this->buckets);
         THROW_IF_NULL(this->requestTimeRest, "cannot create metric");
     }
+
+    familyName = METRIC_NAME_REST_REQUEST_COPIED_BYTES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto copiedBytesFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Bytes of input data copied while converting KServe REST request into input tensors.");
+        THROW_IF_NULL(copiedBytesFamily, "cannot create family");
+        this->restRequestCopiedBytes = copiedBytesFamily->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}},
+            this->buckets);
+        THROW_IF_NULL(this->restRequestCopiedBytes, "cannot create metric");
+    }
 }
 
 ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion) :
@@ -239,10 +250,148 @@ ModelMetricReporter::ModelMetricReporter(const MetricConfig* metricConfig, Metri
             {{"name", modelName}, {"version", std::to_string(modelVersion)}});
         THROW_IF_NULL(this->currentRequests, "cannot create metric");
     }
+
+    familyName = METRIC_NAME_REQUESTS_DEADLINE_DROPPED;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of requests rejected because their deadline passed before inference was started.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->requestsDeadlineDropped = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->requestsDeadlineDropped, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_REQUESTS_SHED;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of requests rejected because servable pending requests or wait time limit was exceeded.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->requestsShed = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->requestsShed, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_SHAPE_VARIANT_HITS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of reloads served by a cached compiled shape variant.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->shapeVariantHits = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->shapeVariantHits, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_SHAPE_VARIANT_MISSES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of reloads which required compilation of a new shape variant.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->shapeVariantMisses = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->shapeVariantMisses, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_SHAPE_VARIANT_COMPILE_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Compilation time of a new shape variant.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->shapeVariantCompileTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}},
+            this->buckets);
+        THROW_IF_NULL(this->shapeVariantCompileTime, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_LOAD_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Duration of the last servable load.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->loadTime = family->addMetric(
+            {{"name", modelName}, {"version", std::to_string(modelVersion)}});
+        THROW_IF_NULL(this->loadTime, "cannot create metric");
+    }
+}
+
+PipelineNodeMetricReporter::PipelineNodeMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& pipelineName, const std::string& nodeName) {
+    if (!registry) {
+        return;
+    }
+
+    if (!metricConfig || !metricConfig->metricsEnabled) {
+        return;
+    }
+
+    std::string familyName = METRIC_NAME_PIPELINE_NODE_TIME;
+    if (!metricConfig->isFamilyEnabled(familyName)) {
+        return;
+    }
+
+    for (int i = 0; i < NUMBER_OF_BUCKETS; i++) {
+        this->buckets.emplace_back(floor(BUCKET_MULTIPLIER * pow(BUCKET_POWER_BASE, i)));
+    }
+
+    auto family = registry->createFamily<MetricHistogram>(familyName,
+        "Time spent by DAG node sessions in each execution phase.");
+    THROW_IF_NULL(family, "cannot create family");
+    this->waitForInputsTime = family->addMetric(
+        {{"name", pipelineName}, {"node", nodeName}, {"phase", "wait_for_inputs"}},
+        this->buckets);
+    THROW_IF_NULL(this->waitForInputsTime, "cannot create metric");
+    this->waitForInferReqTime = family->addMetric(
+        {{"name", pipelineName}, {"node", nodeName}, {"phase", "wait_for_infer_req"}},
+        this->buckets);
+    THROW_IF_NULL(this->waitForInferReqTime, "cannot create metric");
+    this->executeTime = family->addMetric(
+        {{"name", pipelineName}, {"node", nodeName}, {"phase", "execute"}},
+        this->buckets);
+    THROW_IF_NULL(this->executeTime, "cannot create metric");
+    this->fetchResultsTime = family->addMetric(
+        {{"name", pipelineName}, {"node", nodeName}, {"phase", "fetch_results"}},
+        this->buckets);
+    THROW_IF_NULL(this->fetchResultsTime, "cannot create metric");
+}
+
+CustomNodeBufferArenaMetricReporter::CustomNodeBufferArenaMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry) {
+    if (!registry) {
+        return;
+    }
+
+    if (!metricConfig || !metricConfig->metricsEnabled) {
+        return;
+    }
+
+    std::string familyName = METRIC_NAME_CUSTOM_NODE_ARENA_HITS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of custom node buffers served from buffers reused by the server.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->hits = family->addMetric();
+        THROW_IF_NULL(this->hits, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_CUSTOM_NODE_ARENA_MISSES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of custom node buffers which required new allocation.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->misses = family->addMetric();
+        THROW_IF_NULL(this->misses, "cannot create metric");
+    }
+
+    familyName = METRIC_NAME_CUSTOM_NODE_ARENA_CACHED_BYTES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Size of custom node buffers kept by the server for reuse.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->cachedBytes = family->addMetric();
+        THROW_IF_NULL(this->cachedBytes, "cannot create metric");
+    }
 }
 
 MediapipeServableMetricReporter::MediapipeServableMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& graphName) :
-    registry(registry) {
+    registry(registry),
+    graphName(graphName) {
     if (!registry) {
         return;
     }
@@ -519,6 +668,356 @@ MediapipeServableMetricReporter::MediapipeServableMetricReporter(const MetricCon
             this->buckets);
         THROW_IF_NULL(this->requestLatencyRestV3Stream, "cannot create metric");
     }
+    familyName = METRIC_NAME_REQUESTS_SHED;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of requests rejected because servable pending requests or wait time limit was exceeded.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->requestsShed = family->addMetric({{"name", graphName}});
+        THROW_IF_NULL(this->requestsShed, "cannot create metric");
+    }
+    familyName = METRIC_NAME_LOAD_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Duration of the last servable load.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->loadTime = family->addMetric({{"name", graphName}});
+        THROW_IF_NULL(this->loadTime, "cannot create metric");
+    }
+    familyName = METRIC_NAME_GRAPH_POOL_SIZE;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of graphs created in the graph pool.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->graphPoolSize = family->addMetric({{"name", graphName}});
+        THROW_IF_NULL(this->graphPoolSize, "cannot create metric");
+    }
+    familyName = METRIC_NAME_GRAPH_POOL_IN_USE;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricGauge>(familyName,
+            "Number of graphs from the graph pool used by requests.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->graphPoolInUse = family->addMetric({{"name", graphName}});
+        THROW_IF_NULL(this->graphPoolInUse, "cannot create metric");
+    }
+    familyName = METRIC_NAME_GRAPH_POOL_WAIT_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Time request waited for graph from the graph pool.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->graphPoolWaitTime = family->addMetric({{"name", graphName}}, this->buckets);
+        THROW_IF_NULL(this->graphPoolWaitTime, "cannot create metric");
+    }
+    familyName = METRIC_NAME_GRAPH_POOL_CREATION_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Time of creating new graph in the graph pool.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->graphPoolCreationTime = family->addMetric({{"name", graphName}}, this->buckets);
+        THROW_IF_NULL(this->graphPoolCreationTime, "cannot create metric");
+    }
+    familyName = METRIC_NAME_GRAPH_REBUILDS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricCounter>(familyName,
+            "Number of graphs rebuilt after execution error.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->graphRebuilds = family->addMetric({{"name", graphName}});
+        THROW_IF_NULL(this->graphRebuilds, "cannot create metric");
+    }
+    familyName = METRIC_NAME_GRAPH_REBUILD_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        auto family = registry->createFamily<MetricHistogram>(familyName,
+            "Time of rebuilding graph after execution error.");
+        THROW_IF_NULL(family, "cannot create family");
+        this->graphRebuildTime = family->addMetric({{"name", graphName}}, this->buckets);
+        THROW_IF_NULL(this->graphRebuildTime, "cannot create metric");
+    }
+    familyName = METRIC_NAME_GRAPH_CALCULATOR_PROCESS_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->calculatorProcessTimeFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Time spent in Process() of the calculator during graph execution.");
+        THROW_IF_NULL(this->calculatorProcessTimeFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_GRAPH_CALCULATOR_INPUT_WAIT_TIME;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->calculatorInputWaitTimeFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Average time packets waited in calculator input streams during graph execution.");
+        THROW_IF_NULL(this->calculatorInputWaitTimeFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_TIME_TO_FIRST_TOKEN;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmTimeToFirstTokenFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Time from scheduling LLM request to generation of the first token.");
+        THROW_IF_NULL(this->llmTimeToFirstTokenFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_TIME_PER_OUTPUT_TOKEN;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmTimePerOutputTokenFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Mean time of generating single output token by LLM request.");
+        THROW_IF_NULL(this->llmTimePerOutputTokenFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_PREFILL_SPEED;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmPrefillSpeedFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Number of prompt tokens processed per second until generation of the first token.");
+        THROW_IF_NULL(this->llmPrefillSpeedFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_PROMPT_TOKENS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmPromptTokensFamily = registry->createFamily<MetricCounter>(familyName,
+            "Number of prompt tokens of finished LLM requests.");
+        THROW_IF_NULL(this->llmPromptTokensFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_GENERATED_TOKENS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmGeneratedTokensFamily = registry->createFamily<MetricCounter>(familyName,
+            "Number of tokens generated by finished LLM requests.");
+        THROW_IF_NULL(this->llmGeneratedTokensFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_WAITING_REQUESTS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmWaitingRequestsFamily = registry->createFamily<MetricGauge>(familyName,
+            "Number of LLM requests added to continuous batching pipeline and not scheduled in the last step.");
+        THROW_IF_NULL(this->llmWaitingRequestsFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_RUNNING_REQUESTS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmRunningRequestsFamily = registry->createFamily<MetricGauge>(familyName,
+            "Number of LLM requests scheduled in the last step of continuous batching pipeline.");
+        THROW_IF_NULL(this->llmRunningRequestsFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_KV_CACHE_USAGE_BYTES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmKvCacheUsageBytesFamily = registry->createFamily<MetricGauge>(familyName,
+            "Size of KV cache used by continuous batching pipeline.");
+        THROW_IF_NULL(this->llmKvCacheUsageBytesFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_KV_CACHE_USAGE_PERCENT;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmKvCacheUsagePercentFamily = registry->createFamily<MetricGauge>(familyName,
+            "Percentage of KV cache used by continuous batching pipeline.");
+        THROW_IF_NULL(this->llmKvCacheUsagePercentFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_QUEUED_REQUESTS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmQueuedRequestsFamily = registry->createFamily<MetricGauge>(familyName,
+            "Number of LLM requests waiting in admission queue to be added to continuous batching pipeline.");
+        THROW_IF_NULL(this->llmQueuedRequestsFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_ADMITTED_REQUESTS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmAdmittedRequestsFamily = registry->createFamily<MetricCounter>(familyName,
+            "Number of LLM requests admitted to continuous batching pipeline by admission queue.");
+        THROW_IF_NULL(this->llmAdmittedRequestsFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_REJECTED_REQUESTS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmRejectedRequestsFamily = registry->createFamily<MetricCounter>(familyName,
+            "Number of LLM requests rejected because admission queue limits were exceeded.");
+        THROW_IF_NULL(this->llmRejectedRequestsFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_CLASS_TIME_TO_FIRST_TOKEN;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmClassTimeToFirstTokenFamily = registry->createFamily<MetricHistogram>(familyName,
+            "Time from receiving LLM request of a priority class, including time spent in admission queue, to generation of the first token.");
+        THROW_IF_NULL(this->llmClassTimeToFirstTokenFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_REPLICA_ROUTED_REQUESTS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmReplicaRoutedRequestsFamily = registry->createFamily<MetricCounter>(familyName,
+            "Number of LLM requests routed to data parallel replica of continuous batching pipeline.");
+        THROW_IF_NULL(this->llmReplicaRoutedRequestsFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_REPLICA_AFFINITY_ROUTED_REQUESTS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmReplicaAffinityRoutedRequestsFamily = registry->createFamily<MetricCounter>(familyName,
+            "Number of LLM requests routed to data parallel replica which served the same prompt prefix before.");
+        THROW_IF_NULL(this->llmReplicaAffinityRoutedRequestsFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_REPLICA_OUTSTANDING_TOKENS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmReplicaOutstandingTokensFamily = registry->createFamily<MetricGauge>(familyName,
+            "Number of prompt and requested output tokens of unfinished LLM requests routed to data parallel replica.");
+        THROW_IF_NULL(this->llmReplicaOutstandingTokensFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_REPLICA_RUNNING_REQUESTS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmReplicaRunningRequestsFamily = registry->createFamily<MetricGauge>(familyName,
+            "Number of LLM requests scheduled in the last step of data parallel replica of continuous batching pipeline.");
+        THROW_IF_NULL(this->llmReplicaRunningRequestsFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_REPLICA_KV_CACHE_USAGE_PERCENT;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmReplicaKvCacheUsagePercentFamily = registry->createFamily<MetricGauge>(familyName,
+            "Percentage of KV cache used by data parallel replica of continuous batching pipeline.");
+        THROW_IF_NULL(this->llmReplicaKvCacheUsagePercentFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_HITS;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmChatTemplateCacheHitsFamily = registry->createFamily<MetricCounter>(familyName,
+            "Number of LLM requests with prompt taken from cache of rendered chat templates.");
+        THROW_IF_NULL(this->llmChatTemplateCacheHitsFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_MISSES;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmChatTemplateCacheMissesFamily = registry->createFamily<MetricCounter>(familyName,
+            "Number of LLM requests with prompt not found in cache of rendered chat templates.");
+        THROW_IF_NULL(this->llmChatTemplateCacheMissesFamily, "cannot create family");
+    }
+    familyName = METRIC_NAME_LLM_CHAT_TEMPLATE_RENDER_TIME_SAVED;
+    if (metricConfig->isFamilyEnabled(familyName)) {
+        this->llmChatTemplateRenderTimeSavedFamily = registry->createFamily<MetricCounter>(familyName,
+            "Time of chat template rendering saved by serving prompts from cache of rendered chat templates.");
+        THROW_IF_NULL(this->llmChatTemplateRenderTimeSavedFamily, "cannot create family");
+    }
+}
+
+MediapipeCalculatorMetricReporter* MediapipeServableMetricReporter::getCalculatorMetricReporter(const std::string& calculatorName) {
+    if (!hasCalculatorMetrics()) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(calculatorMetricReportersMtx);
+    auto it = this->calculatorMetricReporters.find(calculatorName);
+    if (it != this->calculatorMetricReporters.end()) {
+        return it->second.get();
+    }
+    auto reporter = std::make_unique<MediapipeCalculatorMetricReporter>();
+    if (this->calculatorProcessTimeFamily) {
+        reporter->processTime = this->calculatorProcessTimeFamily->addMetric({{"name", this->graphName}, {"calculator", calculatorName}}, this->buckets);
+        THROW_IF_NULL(reporter->processTime, "cannot create metric");
+    }
+    if (this->calculatorInputWaitTimeFamily) {
+        reporter->inputWaitTime = this->calculatorInputWaitTimeFamily->addMetric({{"name", this->graphName}, {"calculator", calculatorName}}, this->buckets);
+        THROW_IF_NULL(reporter->inputWaitTime, "cannot create metric");
+    }
+    return this->calculatorMetricReporters.emplace(calculatorName, std::move(reporter)).first->second.get();
+}
+
+std::shared_ptr<LLMNodeMetricReporter> MediapipeServableMetricReporter::createLLMNodeMetricReporter(const std::string& nodeName) {
+    if (!hasLLMMetrics()) {
+        return nullptr;
+    }
+    auto reporter = std::make_shared<LLMNodeMetricReporter>();
+    const MetricLabels labels{{"name", this->graphName}, {"node", nodeName}};
+    if (this->llmTimeToFirstTokenFamily) {
+        reporter->timeToFirstToken = this->llmTimeToFirstTokenFamily->addMetric(labels, this->buckets);
+        THROW_IF_NULL(reporter->timeToFirstToken, "cannot create metric");
+    }
+    if (this->llmTimePerOutputTokenFamily) {
+        reporter->timePerOutputToken = this->llmTimePerOutputTokenFamily->addMetric(labels, this->buckets);
+        THROW_IF_NULL(reporter->timePerOutputToken, "cannot create metric");
+    }
+    if (this->llmPrefillSpeedFamily) {
+        reporter->prefillSpeed = this->llmPrefillSpeedFamily->addMetric(labels, this->buckets);
+        THROW_IF_NULL(reporter->prefillSpeed, "cannot create metric");
+    }
+    if (this->llmPromptTokensFamily) {
+        reporter->promptTokens = this->llmPromptTokensFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->promptTokens, "cannot create metric");
+    }
+    if (this->llmGeneratedTokensFamily) {
+        reporter->generatedTokens = this->llmGeneratedTokensFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->generatedTokens, "cannot create metric");
+    }
+    if (this->llmWaitingRequestsFamily) {
+        reporter->waitingRequests = this->llmWaitingRequestsFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->waitingRequests, "cannot create metric");
+    }
+    if (this->llmRunningRequestsFamily) {
+        reporter->runningRequests = this->llmRunningRequestsFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->runningRequests, "cannot create metric");
+    }
+    if (this->llmKvCacheUsageBytesFamily) {
+        reporter->kvCacheUsageBytes = this->llmKvCacheUsageBytesFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->kvCacheUsageBytes, "cannot create metric");
+    }
+    if (this->llmKvCacheUsagePercentFamily) {
+        reporter->kvCacheUsagePercent = this->llmKvCacheUsagePercentFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->kvCacheUsagePercent, "cannot create metric");
+    }
+    if (this->llmQueuedRequestsFamily) {
+        reporter->queuedRequests = this->llmQueuedRequestsFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->queuedRequests, "cannot create metric");
+    }
+    if (this->llmAdmittedRequestsFamily) {
+        reporter->admittedRequests = this->llmAdmittedRequestsFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->admittedRequests, "cannot create metric");
+    }
+    if (this->llmRejectedRequestsFamily) {
+        reporter->rejectedRequests = this->llmRejectedRequestsFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->rejectedRequests, "cannot create metric");
+    }
+    if (this->llmChatTemplateCacheHitsFamily) {
+        reporter->chatTemplateCacheHits = this->llmChatTemplateCacheHitsFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->chatTemplateCacheHits, "cannot create metric");
+    }
+    if (this->llmChatTemplateCacheMissesFamily) {
+        reporter->chatTemplateCacheMisses = this->llmChatTemplateCacheMissesFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->chatTemplateCacheMisses, "cannot create metric");
+    }
+    if (this->llmChatTemplateRenderTimeSavedFamily) {
+        reporter->chatTemplateRenderTimeSaved = this->llmChatTemplateRenderTimeSavedFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->chatTemplateRenderTimeSaved, "cannot create metric");
+    }
+    reporter->classTimeToFirstTokenFamily = this->llmClassTimeToFirstTokenFamily;
+    reporter->replicaRoutedRequestsFamily = this->llmReplicaRoutedRequestsFamily;
+    reporter->replicaAffinityRoutedRequestsFamily = this->llmReplicaAffinityRoutedRequestsFamily;
+    reporter->replicaOutstandingTokensFamily = this->llmReplicaOutstandingTokensFamily;
+    reporter->replicaRunningRequestsFamily = this->llmReplicaRunningRequestsFamily;
+    reporter->replicaKvCacheUsagePercentFamily = this->llmReplicaKvCacheUsagePercentFamily;
+    reporter->graphName = this->graphName;
+    reporter->nodeName = nodeName;
+    reporter->buckets = this->buckets;
+    return reporter;
+}
+
+MetricHistogram* LLMNodeMetricReporter::getClassTimeToFirstToken(const std::string& priorityClass) {
+    if (!this->classTimeToFirstTokenFamily) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(classMetricsMtx);
+    auto it = this->classTimeToFirstToken.find(priorityClass);
+    if (it != this->classTimeToFirstToken.end()) {
+        return it->second.get();
+    }
+    auto metric = this->classTimeToFirstTokenFamily->addMetric({{"name", this->graphName}, {"node", this->nodeName}, {"priority_class", priorityClass}}, this->buckets);
+    THROW_IF_NULL(metric, "cannot create metric");
+    return this->classTimeToFirstToken.emplace(priorityClass, std::move(metric)).first->second.get();
+}
+
+LLMReplicaMetricReporter* LLMNodeMetricReporter::getReplicaMetricReporter(size_t replica) {
+    if (!this->replicaRoutedRequestsFamily && !this->replicaAffinityRoutedRequestsFamily && !this->replicaOutstandingTokensFamily &&
+        !this->replicaRunningRequestsFamily && !this->replicaKvCacheUsagePercentFamily) {
+        return nullptr;
+    }
+    std::unique_lock<std::mutex> lock(replicaMetricsMtx);
+    auto it = this->replicaMetricReporters.find(replica);
+    if (it != this->replicaMetricReporters.end()) {
+        return it->second.get();
+    }
+    auto reporter = std::make_unique<LLMReplicaMetricReporter>();
+    const MetricLabels labels{{"name", this->graphName}, {"node", this->nodeName}, {"replica", std::to_string(replica)}};
+    if (this->replicaRoutedRequestsFamily) {
+        reporter->routedRequests = this->replicaRoutedRequestsFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->routedRequests, "cannot create metric");
+    }
+    if (this->replicaAffinityRoutedRequestsFamily) {
+        reporter->affinityRoutedRequests = this->replicaAffinityRoutedRequestsFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->affinityRoutedRequests, "cannot create metric");
+    }
+    if (this->replicaOutstandingTokensFamily) {
+        reporter->outstandingTokens = this->replicaOutstandingTokensFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->outstandingTokens, "cannot create metric");
+    }
+    if (this->replicaRunningRequestsFamily) {
+        reporter->runningRequests = this->replicaRunningRequestsFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->runningRequests, "cannot create metric");
+    }
+    if (this->replicaKvCacheUsagePercentFamily) {
+        reporter->kvCacheUsagePercent = this->replicaKvCacheUsagePercentFamily->addMetric(labels);
+        THROW_IF_NULL(reporter->kvCacheUsagePercent, "cannot create metric");
+    }
+    return this->replicaMetricReporters.emplace(replica, std::move(reporter)).first->second.get();
 }
 
 }  // namespace ovms
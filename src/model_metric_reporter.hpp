@@ -16,8 +16,10 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "execution_context.hpp"
@@ -74,6 +76,8 @@ public:
     std::unique_ptr<MetricHistogram> requestTimeGrpc;
     std::unique_ptr<MetricHistogram> requestTimeRest;
 
+    std::unique_ptr<MetricHistogram> restRequestCopiedBytes;
+
     inline std::unique_ptr<MetricCounter>& getModelMetadataMetric(const ExecutionContext& context, bool success = true) override {
         if (context.interface == ExecutionContext::Interface::GRPC) {
             return success ? this->requestSuccessGrpcModelMetadata : this->requestFailGrpcModelMetadata;
@@ -101,11 +105,133 @@ public:
     std::unique_ptr<MetricGauge> inferReqActive;
     std::unique_ptr<MetricGauge> currentRequests;
 
+    std::unique_ptr<MetricCounter> requestsDeadlineDropped;
+    std::unique_ptr<MetricCounter> requestsShed;
+
+    std::unique_ptr<MetricCounter> shapeVariantHits;
+    std::unique_ptr<MetricCounter> shapeVariantMisses;
+    std::unique_ptr<MetricHistogram> shapeVariantCompileTime;
+
+    std::unique_ptr<MetricGauge> loadTime;
+
     ModelMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& modelName, model_version_t modelVersion);
 };
 
+class PipelineNodeMetricReporter {
+    std::vector<double> buckets;
+
+public:
+    std::unique_ptr<MetricHistogram> waitForInputsTime;
+    std::unique_ptr<MetricHistogram> waitForInferReqTime;
+    std::unique_ptr<MetricHistogram> executeTime;
+    std::unique_ptr<MetricHistogram> fetchResultsTime;
+
+    PipelineNodeMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry, const std::string& pipelineName, const std::string& nodeName);
+};
+
+class CustomNodeBufferArenaMetricReporter {
+public:
+    std::unique_ptr<MetricCounter> hits;
+    std::unique_ptr<MetricCounter> misses;
+    std::unique_ptr<MetricGauge> cachedBytes;
+
+    CustomNodeBufferArenaMetricReporter(const MetricConfig* metricConfig, MetricRegistry* registry);
+};
+
+class MediapipeCalculatorMetricReporter {
+public:
+    std::unique_ptr<MetricHistogram> processTime;
+    std::unique_ptr<MetricHistogram> inputWaitTime;
+};
+
+// state of single data parallel replica of continuous batching pipeline
+struct LLMReplicaMetricReporter {
+    std::unique_ptr<MetricCounter> routedRequests;
+    std::unique_ptr<MetricCounter> affinityRoutedRequests;
+    std::unique_ptr<MetricGauge> outstandingTokens;
+    std::unique_ptr<MetricGauge> runningRequests;
+    std::unique_ptr<MetricGauge> kvCacheUsagePercent;
+};
+
+class LLMNodeMetricReporter {
+public:
+    // per request
+    std::unique_ptr<MetricHistogram> timeToFirstToken;
+    std::unique_ptr<MetricHistogram> timePerOutputToken;
+    std::unique_ptr<MetricHistogram> prefillSpeed;
+    std::unique_ptr<MetricCounter> promptTokens;
+    std::unique_ptr<MetricCounter> generatedTokens;
+
+    // continuous batching engine state
+    std::unique_ptr<MetricGauge> waitingRequests;
+    std::unique_ptr<MetricGauge> runningRequests;
+    std::unique_ptr<MetricGauge> kvCacheUsageBytes;
+    std::unique_ptr<MetricGauge> kvCacheUsagePercent;
+
+    // admission queue in front of the pipeline
+    std::unique_ptr<MetricGauge> queuedRequests;
+    std::unique_ptr<MetricCounter> admittedRequests;
+    std::unique_ptr<MetricCounter> rejectedRequests;
+
+    // cache of prompts rendered by chat template
+    std::unique_ptr<MetricCounter> chatTemplateCacheHits;
+    std::unique_ptr<MetricCounter> chatTemplateCacheMisses;
+    std::unique_ptr<MetricCounter> chatTemplateRenderTimeSaved;
+
+    // priority classes are known after request is parsed, hence metrics are added on first report
+    MetricHistogram* getClassTimeToFirstToken(const std::string& priorityClass);
+    // returns nullptr when none of replica metrics is enabled
+    LLMReplicaMetricReporter* getReplicaMetricReporter(size_t replica);
+
+private:
+    friend class MediapipeServableMetricReporter;
+    std::shared_ptr<MetricFamily<MetricHistogram>> classTimeToFirstTokenFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> replicaRoutedRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> replicaAffinityRoutedRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> replicaOutstandingTokensFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> replicaRunningRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> replicaKvCacheUsagePercentFamily;
+    std::string graphName;
+    std::string nodeName;
+    std::vector<double> buckets;
+    std::mutex classMetricsMtx;
+    std::unordered_map<std::string, std::unique_ptr<MetricHistogram>> classTimeToFirstToken;
+    std::mutex replicaMetricsMtx;
+    std::unordered_map<size_t, std::unique_ptr<LLMReplicaMetricReporter>> replicaMetricReporters;
+};
+
 class MediapipeServableMetricReporter : public StatusMetricReporter {
     MetricRegistry* registry;
+    const std::string graphName;
+
+    // calculator names are known after graph is initialized, hence metrics are added on first report
+    std::shared_ptr<MetricFamily<MetricHistogram>> calculatorProcessTimeFamily;
+    std::shared_ptr<MetricFamily<MetricHistogram>> calculatorInputWaitTimeFamily;
+    std::mutex calculatorMetricReportersMtx;
+    std::unordered_map<std::string, std::unique_ptr<MediapipeCalculatorMetricReporter>> calculatorMetricReporters;
+
+    // LLM node names are known after nodes are initialized
+    std::shared_ptr<MetricFamily<MetricHistogram>> llmTimeToFirstTokenFamily;
+    std::shared_ptr<MetricFamily<MetricHistogram>> llmTimePerOutputTokenFamily;
+    std::shared_ptr<MetricFamily<MetricHistogram>> llmPrefillSpeedFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> llmPromptTokensFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> llmGeneratedTokensFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> llmWaitingRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> llmRunningRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> llmKvCacheUsageBytesFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> llmKvCacheUsagePercentFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> llmQueuedRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> llmAdmittedRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> llmRejectedRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricHistogram>> llmClassTimeToFirstTokenFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> llmReplicaRoutedRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> llmReplicaAffinityRoutedRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> llmReplicaOutstandingTokensFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> llmReplicaRunningRequestsFamily;
+    std::shared_ptr<MetricFamily<MetricGauge>> llmReplicaKvCacheUsagePercentFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> llmChatTemplateCacheHitsFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> llmChatTemplateCacheMissesFamily;
+    std::shared_ptr<MetricFamily<MetricCounter>> llmChatTemplateRenderTimeSavedFamily;
 
 protected:
     std::vector<double> buckets;
@@ -168,6 +294,37 @@ public:
     std::unique_ptr<MetricHistogram> requestLatencyGrpcModelInferStream;
     std::unique_ptr<MetricHistogram> requestLatencyRestV3Stream;
 
+    std::unique_ptr<MetricCounter> requestsShed;
+
+    std::unique_ptr<MetricGauge> loadTime;
+
+    std::unique_ptr<MetricGauge> graphPoolSize;
+    std::unique_ptr<MetricGauge> graphPoolInUse;
+    std::unique_ptr<MetricHistogram> graphPoolWaitTime;
+    std::unique_ptr<MetricHistogram> graphPoolCreationTime;
+    std::unique_ptr<MetricCounter> graphRebuilds;
+    std::unique_ptr<MetricHistogram> graphRebuildTime;
+
+    bool hasCalculatorMetrics() const {
+        return this->calculatorProcessTimeFamily || this->calculatorInputWaitTimeFamily;
+    }
+
+    MediapipeCalculatorMetricReporter* getCalculatorMetricReporter(const std::string& calculatorName);
+
+    bool hasLLMMetrics() const {
+        return this->llmTimeToFirstTokenFamily || this->llmTimePerOutputTokenFamily || this->llmPrefillSpeedFamily ||
+               this->llmPromptTokensFamily || this->llmGeneratedTokensFamily ||
+               this->llmWaitingRequestsFamily || this->llmRunningRequestsFamily ||
+               this->llmKvCacheUsageBytesFamily || this->llmKvCacheUsagePercentFamily ||
+               this->llmQueuedRequestsFamily || this->llmAdmittedRequestsFamily || this->llmRejectedRequestsFamily ||
+               this->llmClassTimeToFirstTokenFamily || this->llmReplicaRoutedRequestsFamily || this->llmReplicaAffinityRoutedRequestsFamily ||
+               this->llmReplicaOutstandingTokensFamily || this->llmReplicaRunningRequestsFamily || this->llmReplicaKvCacheUsagePercentFamily ||
+               this->llmChatTemplateCacheHitsFamily || this->llmChatTemplateCacheMissesFamily || this->llmChatTemplateRenderTimeSavedFamily;
+    }
+
+    // Reporter is shared with LLM node servable and its executor thread which may outlive graph definition
+    std::shared_ptr<LLMNodeMetricReporter> createLLMNodeMetricReporter(const std::string& nodeName);
+
     inline MetricHistogram* getRequestLatencyMetric(const ExecutionContext& context) {
         if (context.method == ExecutionContext::Method::ModelInferStream)
             return this->requestLatencyGrpcModelInferStream.get();
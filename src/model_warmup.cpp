@@ -0,0 +1,143 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "model_warmup.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
+#include "logging.hpp"
+#include "ovinferrequestsqueue.hpp"
+#include "status.hpp"
+
+namespace ovms {
+
+std::vector<std::map<std::string, ov::Shape>> createWarmupShapes(const tensor_map_t& inputsInfo) {
+    std::map<std::string, ov::Shape> lower;
+    std::map<std::string, ov::Shape> upper;
+    for (const auto& [name, info] : inputsInfo) {
+        ov::Shape lowerShape;
+        ov::Shape upperShape;
+        for (const auto& dim : info->getShape()) {
+            if (dim.isStatic()) {
+                lowerShape.push_back(static_cast<size_t>(dim.getStaticValue()));
+                upperShape.push_back(static_cast<size_t>(dim.getStaticValue()));
+            } else if (dim.isAny()) {
+                lowerShape.push_back(1);
+                upperShape.push_back(1);
+            } else {
+                lowerShape.push_back(static_cast<size_t>(std::max<dimension_value_t>(dim.getMinValue(), 1)));
+                upperShape.push_back(static_cast<size_t>(std::max<dimension_value_t>(dim.getMaxValue(), 1)));
+            }
+        }
+        lower.emplace(name, std::move(lowerShape));
+        upper.emplace(name, std::move(upperShape));
+    }
+    std::vector<std::map<std::string, ov::Shape>> shapes{lower};
+    if (upper != lower) {
+        shapes.emplace_back(std::move(upper));
+    }
+    return shapes;
+}
+
+ov::Tensor createWarmupTensor(const TensorInfo& info, const ov::Shape& shape, const std::string& data) {
+    ov::Tensor tensor(info.getOvPrecision(), shape);
+    if (info.getOvPrecision() == ov::element::string) {
+        // string tensors are default constructed with empty strings
+        if (!data.empty()) {
+            std::fill_n(tensor.data<std::string>(), tensor.get_size(), data);
+        }
+        return tensor;
+    }
+    char* buffer = reinterpret_cast<char*>(tensor.data());
+    const size_t byteSize = tensor.get_byte_size();
+    if (data.empty()) {
+        std::memset(buffer, 0, byteSize);
+        return tensor;
+    }
+    for (size_t offset = 0; offset < byteSize; offset += data.size()) {
+        std::memcpy(buffer + offset, data.data(), std::min(data.size(), byteSize - offset));
+    }
+    return tensor;
+}
+
+static Status readWarmupData(const tensor_map_t& inputsInfo, const std::string& dataPath, std::map<std::string, std::string>& inputsData) {
+    if (dataPath.empty()) {
+        return StatusCode::OK;
+    }
+    for (const auto& [name, info] : inputsInfo) {
+        const auto filePath = std::filesystem::path(dataPath) / (info->getMappedName() + ".bin");
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(filePath, ec)) {
+            SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Warm-up data file: {} does not exist, input: {} will be filled with zeros", filePath.string(), name);
+            continue;
+        }
+        std::ifstream file(filePath, std::ios::binary);
+        if (!file.is_open()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to open warm-up data file: {}", filePath.string());
+            return StatusCode::FILE_INVALID;
+        }
+        inputsData[name] = std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+    return StatusCode::OK;
+}
+
+Status runWarmup(OVInferRequestsQueue& queue, const tensor_map_t& inputsInfo, uint32_t iterations, const std::string& dataPath) {
+    std::map<std::string, std::string> inputsData;
+    auto status = readWarmupData(inputsInfo, dataPath, inputsData);
+    if (!status.ok()) {
+        return status;
+    }
+    const size_t streamsCount = queue.getStreamsCount();
+    try {
+        for (const auto& shapes : createWarmupShapes(inputsInfo)) {
+            std::vector<std::pair<std::string, ov::Tensor>> tensors;
+            for (const auto& [name, shape] : shapes) {
+                const auto& info = inputsInfo.at(name);
+                auto it = inputsData.find(name);
+                tensors.emplace_back(info->getName(), createWarmupTensor(*info, shape, it != inputsData.end() ? it->second : std::string()));
+            }
+            for (uint32_t iteration = 0; iteration < iterations; ++iteration) {
+                // all infer requests run concurrently, as they would under load
+                for (size_t streamId = 0; streamId < streamsCount; ++streamId) {
+                    auto& inferRequest = queue.getInferRequest(static_cast<int>(streamId));
+                    for (const auto& [name, tensor] : tensors) {
+                        OV_LOGGER("ov::InferRequest: {}, request.set_tensor({}, tensor: {})", reinterpret_cast<void*>(&inferRequest), name, reinterpret_cast<const void*>(&tensor));
+                        inferRequest.set_tensor(name, tensor);
+                    }
+                    OV_LOGGER("ov::InferRequest: {}, inferRequest.start_async()", reinterpret_cast<void*>(&inferRequest));
+                    inferRequest.start_async();
+                }
+                for (size_t streamId = 0; streamId < streamsCount; ++streamId) {
+                    auto& inferRequest = queue.getInferRequest(static_cast<int>(streamId));
+                    OV_LOGGER("ov::InferRequest: {}, inferRequest.wait()", reinterpret_cast<void*>(&inferRequest));
+                    inferRequest.wait();
+                }
+            }
+        }
+    } catch (const ov::Exception& e) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Exception during warm-up inference: {}", e.what());
+        return StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+    } catch (const std::exception& e) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Exception during warm-up inference: {}", e.what());
+        return StatusCode::OV_INTERNAL_INFERENCE_ERROR;
+    }
+    return StatusCode::OK;
+}
+}  // namespace ovms
@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <openvino/openvino.hpp>
+
+#include "tensorinfo.hpp"
+
+namespace ovms {
+class OVInferRequestsQueue;
+class Status;
+
+/**
+ * @brief Creates sets of input shapes used for warm-up.
+ *
+ * Static inputs use their shape. For dynamic dimensions one set uses lower bounds and
+ * another one upper bounds of the ranges. Unbounded dimensions use 1.
+ */
+std::vector<std::map<std::string, ov::Shape>> createWarmupShapes(const tensor_map_t& inputsInfo);
+
+/**
+ * @brief Creates warm-up input tensor. Data is repeated to fill the tensor, tensor is zero filled if data is empty.
+ */
+ov::Tensor createWarmupTensor(const TensorInfo& info, const ov::Shape& shape, const std::string& data);
+
+/**
+ * @brief Runs warm-up inferences on every infer request in the queue for each shape set from createWarmupShapes.
+ *
+ * Must be called before model version becomes available, infer requests are used without acquiring them from the queue.
+ * Data for each input is read from <dataPath>/<input name>.bin if the file exists.
+ */
+Status runWarmup(OVInferRequestsQueue& queue, const tensor_map_t& inputsInfo, uint32_t iterations, const std::string& dataPath);
+}  // namespace ovms
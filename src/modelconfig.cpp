@@ -111,6 +111,26 @@ bool ModelConfig::isReloadRequired(const ModelConfig& rhs) const {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to nireq mismatch", this->name);
         return true;
     }
+    if (this->maxBatchSize != rhs.maxBatchSize || this->maxQueueDelayUs != rhs.maxQueueDelayUs) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to dynamic batching configuration mismatch", this->name);
+        return true;
+    }
+    if (this->dispatchPolicy != rhs.dispatchPolicy) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to dispatch policy mismatch", this->name);
+        return true;
+    }
+    if (this->maxPendingRequests != rhs.maxPendingRequests || this->maxQueueWaitMs != rhs.maxQueueWaitMs) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to admission control limits mismatch", this->name);
+        return true;
+    }
+    if (this->warmupIterations != rhs.warmupIterations || this->warmupDataPath != rhs.warmupDataPath) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to warm-up configuration mismatch", this->name);
+        return true;
+    }
+    if (this->shapeVariantsCacheSize != rhs.shapeVariantsCacheSize) {
+        SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to shape variants cache size mismatch", this->name);
+        return true;
+    }
     if (this->pluginConfig != rhs.pluginConfig) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "ModelConfig {} reload required due to plugin config mismatch", this->name);
         return true;
@@ -550,6 +570,24 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
     }
     if (v.HasMember("nireq"))
         this->setNireq(v["nireq"].GetUint64());
+    if (v.HasMember("max_batch_size"))
+        this->setMaxBatchSize(v["max_batch_size"].GetUint());
+    if (v.HasMember("max_queue_delay_us"))
+        this->setMaxQueueDelayUs(v["max_queue_delay_us"].GetUint());
+    if (v.HasMember("dispatch_policy"))
+        this->setDispatchPolicy(v["dispatch_policy"].GetString());
+    if (v.HasMember("max_pending_requests"))
+        this->setMaxPendingRequests(v["max_pending_requests"].GetUint());
+    if (v.HasMember("max_queue_wait_ms"))
+        this->setMaxQueueWaitMs(v["max_queue_wait_ms"].GetUint());
+    if (v.HasMember("shape_variants_cache_size"))
+        this->setShapeVariantsCacheSize(v["shape_variants_cache_size"].GetUint());
+    if (v.HasMember("warmup")) {
+        const auto& warmup = v["warmup"];
+        this->setWarmupIterations(warmup.HasMember("iterations") ? warmup["iterations"].GetUint() : 1);
+        if (warmup.HasMember("data_path"))
+            this->setWarmupDataPath(warmup["data_path"].GetString());
+    }
 
     if (v.HasMember("shape")) {
         // Legacy format as string
@@ -698,6 +736,26 @@ Status ModelConfig::parseNode(const rapidjson::Value& v) {
         SPDLOG_DEBUG("model_version_policy: {}", std::string(*getModelVersionPolicy()));
     }
     SPDLOG_DEBUG("nireq: {}", getNireq());
+    if (isDynamicBatchingEnabled()) {
+        SPDLOG_DEBUG("max_batch_size: {}", getMaxBatchSize());
+        SPDLOG_DEBUG("max_queue_delay_us: {}", getMaxQueueDelayUs());
+    }
+    SPDLOG_DEBUG("dispatch_policy: {}", getDispatchPolicy());
+    if (getMaxPendingRequests() > 0) {
+        SPDLOG_DEBUG("max_pending_requests: {}", getMaxPendingRequests());
+    }
+    if (getMaxQueueWaitMs() > 0) {
+        SPDLOG_DEBUG("max_queue_wait_ms: {}", getMaxQueueWaitMs());
+    }
+    if (getShapeVariantsCacheSize() > 0) {
+        SPDLOG_DEBUG("shape_variants_cache_size: {}", getShapeVariantsCacheSize());
+    }
+    if (isWarmupEnabled()) {
+        SPDLOG_DEBUG("warmup iterations: {}", getWarmupIterations());
+        if (!getWarmupDataPath().empty()) {
+            SPDLOG_DEBUG("warmup data_path: {}", getWarmupDataPath());
+        }
+    }
     SPDLOG_DEBUG("target_device: {}", getTargetDevice());
     SPDLOG_DEBUG("plugin_config:");
     for (auto& [pluginParameter, pluginValue] : getPluginConfig()) {
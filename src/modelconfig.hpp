@@ -95,6 +95,46 @@ private:
          */
     uint32_t nireq;
 
+    /**
+         * @brief Maximum batch size formed by server side dynamic batching
+         */
+    uint32_t maxBatchSize = 0;
+
+    /**
+         * @brief Maximum time request waits for other requests to be batched with, 0 disables dynamic batching
+         */
+    uint32_t maxQueueDelayUs = 0;
+
+    /**
+         * @brief Number of compiled shape variants kept for reuse when shape or batch size is set to auto, 0 disables the cache
+         */
+    uint32_t shapeVariantsCacheSize = 0;
+
+    /**
+         * @brief Order in which requests waiting for idle infer request are served: fifo or edf (earliest deadline first)
+         */
+    std::string dispatchPolicy = "fifo";
+
+    /**
+         * @brief Maximum number of requests waiting for idle infer request, 0 means no limit
+         */
+    uint32_t maxPendingRequests = 0;
+
+    /**
+         * @brief Maximum estimated time request would wait for idle infer request in milliseconds, 0 means no limit
+         */
+    uint32_t maxQueueWaitMs = 0;
+
+    /**
+         * @brief Number of warm-up inferences run on each infer request before model version becomes available, 0 disables warm-up
+         */
+    uint32_t warmupIterations = 0;
+
+    /**
+         * @brief Directory with <input name>.bin files with raw warm-up input data, inputs without a file are filled with zeros
+         */
+    std::string warmupDataPath;
+
     /**
          * @brief Model cache directory
          */
@@ -509,6 +549,175 @@ public:
         this->nireq = nireq;
     }
 
+    /**
+         * @brief Get the max batch size used by dynamic batching
+         *
+         * @return uint32_t
+         */
+    uint32_t getMaxBatchSize() const {
+        return this->maxBatchSize;
+    }
+
+    /**
+         * @brief Set the max batch size used by dynamic batching
+         *
+         * @param maxBatchSize
+         */
+    void setMaxBatchSize(const uint32_t maxBatchSize) {
+        this->maxBatchSize = maxBatchSize;
+    }
+
+    /**
+         * @brief Get the max queue delay used by dynamic batching
+         *
+         * @return uint32_t
+         */
+    uint32_t getMaxQueueDelayUs() const {
+        return this->maxQueueDelayUs;
+    }
+
+    /**
+         * @brief Set the max queue delay used by dynamic batching
+         *
+         * @param maxQueueDelayUs
+         */
+    void setMaxQueueDelayUs(const uint32_t maxQueueDelayUs) {
+        this->maxQueueDelayUs = maxQueueDelayUs;
+    }
+
+    /**
+         * @brief Get the number of compiled shape variants kept for reuse
+         *
+         * @return uint32_t
+         */
+    uint32_t getShapeVariantsCacheSize() const {
+        return this->shapeVariantsCacheSize;
+    }
+
+    /**
+         * @brief Set the number of compiled shape variants kept for reuse
+         *
+         * @param shapeVariantsCacheSize
+         */
+    void setShapeVariantsCacheSize(const uint32_t shapeVariantsCacheSize) {
+        this->shapeVariantsCacheSize = shapeVariantsCacheSize;
+    }
+
+    /**
+         * @brief Get the infer request dispatch policy
+         *
+         * @return const std::string&
+         */
+    const std::string& getDispatchPolicy() const {
+        return this->dispatchPolicy;
+    }
+
+    /**
+         * @brief Set the infer request dispatch policy
+         *
+         * @param dispatchPolicy
+         */
+    void setDispatchPolicy(const std::string& dispatchPolicy) {
+        this->dispatchPolicy = dispatchPolicy;
+    }
+
+    /**
+         * @brief Checks if waiting requests are served in earliest deadline first order and rejected after their deadline
+         */
+    bool isDeadlineDispatchEnabled() const {
+        return this->dispatchPolicy == "edf";
+    }
+
+    /**
+         * @brief Get the maximum number of requests waiting for idle infer request
+         *
+         * @return uint32_t
+         */
+    uint32_t getMaxPendingRequests() const {
+        return this->maxPendingRequests;
+    }
+
+    /**
+         * @brief Set the maximum number of requests waiting for idle infer request
+         *
+         * @param maxPendingRequests
+         */
+    void setMaxPendingRequests(const uint32_t maxPendingRequests) {
+        this->maxPendingRequests = maxPendingRequests;
+    }
+
+    /**
+         * @brief Get the maximum estimated wait time for idle infer request in milliseconds
+         *
+         * @return uint32_t
+         */
+    uint32_t getMaxQueueWaitMs() const {
+        return this->maxQueueWaitMs;
+    }
+
+    /**
+         * @brief Set the maximum estimated wait time for idle infer request in milliseconds
+         *
+         * @param maxQueueWaitMs
+         */
+    void setMaxQueueWaitMs(const uint32_t maxQueueWaitMs) {
+        this->maxQueueWaitMs = maxQueueWaitMs;
+    }
+
+    /**
+         * @brief Get the number of warm-up inferences run on each infer request
+         *
+         * @return uint32_t
+         */
+    uint32_t getWarmupIterations() const {
+        return this->warmupIterations;
+    }
+
+    /**
+         * @brief Set the number of warm-up inferences run on each infer request
+         *
+         * @param warmupIterations
+         */
+    void setWarmupIterations(const uint32_t warmupIterations) {
+        this->warmupIterations = warmupIterations;
+    }
+
+    /**
+         * @brief Get the warm-up input data directory
+         *
+         * @return const std::string&
+         */
+    const std::string& getWarmupDataPath() const {
+        return this->warmupDataPath;
+    }
+
+    /**
+         * @brief Set the warm-up input data directory
+         *
+         * @param warmupDataPath
+         */
+    void setWarmupDataPath(const std::string& warmupDataPath) {
+        this->warmupDataPath = warmupDataPath;
+    }
+
+    /**
+         * @brief Checks if warm-up inferences are run before model version becomes available
+         *
+         * @return bool
+         */
+    bool isWarmupEnabled() const {
+        return this->warmupIterations > 0;
+    }
+
+    /**
+         * @brief Checks if server side dynamic batching of concurrent requests is requested
+         *
+         * @return bool
+         */
+    bool isDynamicBatchingEnabled() const {
+        return this->maxQueueDelayUs > 0;
+    }
+
     /**
          * @brief Get the plugin config
          * 
@@ -17,6 +17,7 @@
 
 #include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstdlib>
 #include <filesystem>
 #include <iostream>
@@ -47,12 +48,14 @@
 #include "config.hpp"
 #include "customloaderinterface.hpp"
 #include "customloaders.hpp"
+#include "dynamic_batching_scheduler.hpp"
 #include "executingstreamidguard.hpp"
 #include "filesystem/filesystem.hpp"
 #include "layout.hpp"
 #include "layout_configuration.hpp"
 #include "logging.hpp"
 #include "model_metric_reporter.hpp"
+#include "model_warmup.hpp"
 #include "modelconfig.hpp"
 #include "modelinstanceunloadguard.hpp"
 #include "ov_utils.hpp"
@@ -60,6 +63,7 @@
 #include "profiler.hpp"
 #include "regularovtensorfactory.hpp"
 #include "shape.hpp"
+#include "shape_variants_cache.hpp"
 #include "stringutils.hpp"
 #include "tensorinfo.hpp"
 #include "timer.hpp"
@@ -206,9 +210,11 @@ ModelInstance::~ModelInstance() {
 ModelInstance::ModelInstance(const std::string& name, model_version_t version, ov::Core& ieCore, MetricRegistry* registry, const MetricConfig* metricConfig) :
     Servable(name, version),
     ieCore(ieCore),
+    activeShapeVariant(std::make_shared<ModelShapeVariant>()),
     subscriptionManager(std::string("model: ") + name + std::string(" version: ") + std::to_string(version)),
     status(name, version),
-    reporter(std::make_unique<ModelMetricReporter>(metricConfig, registry, name, version)) {
+    reporter(std::make_unique<ModelMetricReporter>(metricConfig, registry, name, version)),
+    shapeVariants(std::make_unique<ShapeVariantsCache>()) {
     isCustomLoaderConfigChanged = false;
 }
 
@@ -699,14 +705,14 @@ Status ModelInstance::loadInputTensors(const ModelConfig& config, const DynamicM
     auto status = loadInputTensorsImpl(config, parameter);
     if (!status.ok())
         return status;
-    if (this->inputsInfo.empty()) {
+    if (activeShapeVariant->inputsInfo.empty()) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Tried to load model:{}, version: {} with no inputs", getName(), getVersion());
         return StatusCode::OV_NO_INPUTS;
     }
     return status;
 }
 Status ModelInstance::loadInputTensorsImpl(const ModelConfig& config, const DynamicModelParameter& parameter) {
-    this->inputsInfo.clear();
+    activeShapeVariant->inputsInfo.clear();
 
     std::map<std::string, ov::PartialShape> modelShapes;
     bool reshapeRequired = false;
@@ -778,7 +784,7 @@ Status ModelInstance::loadInputTensorsImpl(const ModelConfig& config, const Dyna
                 layout);
 
             SPDLOG_LOGGER_INFO(modelmanager_logger, "Input {}", info->asString());
-            this->inputsInfo[info->getMappedName()] = std::move(info);
+            activeShapeVariant->inputsInfo[info->getMappedName()] = std::move(info);
         } catch (const ov::Exception& e) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to get input name for model:{}; version:{}; from OpenVINO with error:{}",
                 getName(),
@@ -805,7 +811,7 @@ Status ModelInstance::loadOutputTensors(const ModelConfig& config) {
     auto status = loadOutputTensorsImpl(config);
     if (!status.ok())
         return status;
-    if (this->outputsInfo.empty()) {
+    if (activeShapeVariant->outputsInfo.empty()) {
         SPDLOG_LOGGER_ERROR(modelmanager_logger, "Tried to load model:{}, version: {} with no outputs", getName(), getVersion());
         return StatusCode::OV_NO_OUTPUTS;
     }
@@ -813,7 +819,7 @@ Status ModelInstance::loadOutputTensors(const ModelConfig& config) {
 }
 
 Status ModelInstance::loadOutputTensorsImpl(const ModelConfig& config) {
-    this->outputsInfo.clear();
+    activeShapeVariant->outputsInfo.clear();
 
     OV_LOGGER("ov::Model model: {}, model->outputs()", reinterpret_cast<void*>(model.get()));
     for (const ov::Output<ov::Node>& output : this->model->outputs()) {
@@ -842,7 +848,7 @@ Status ModelInstance::loadOutputTensorsImpl(const ModelConfig& config) {
 
             SPDLOG_LOGGER_INFO(modelmanager_logger, "Output {}", info->asString());
 
-            this->outputsInfo[info->getMappedName()] = std::move(info);
+            activeShapeVariant->outputsInfo[info->getMappedName()] = std::move(info);
         } catch (const ov::Exception& e) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Failed to get output name for model:{}; version:{}; from OpenVINO with error:{}",
                 getName(),
@@ -880,7 +886,7 @@ uint32_t ModelInstance::getNumOfParallelInferRequestsUnbounded(const ModelConfig
         return ovmsConfig.nireq();
     }
     try {
-        numberOfParallelInferRequests = compiledModel->get_property(ov::optimal_number_of_infer_requests);
+        numberOfParallelInferRequests = activeShapeVariant->compiledModel->get_property(ov::optimal_number_of_infer_requests);
     } catch (const ov::Exception& ex) {
         SPDLOG_WARN("Failed to query OPTIMAL_NUMBER_OF_INFER_REQUESTS with error {}. Using 1 nireq.", ex.what());
         numberOfParallelInferRequests = 1u;
@@ -972,14 +978,15 @@ Status ModelInstance::loadOVModelUsingCustomLoader() {
 }  // namespace ovms
 namespace ovms {
 void ModelInstance::loadCompiledModelPtr(const plugin_config_t& pluginConfig) {
+    auto& compiledModel = activeShapeVariant->compiledModel;
     OV_LOGGER("ov::Core: {}, ov::Model: {}, targetDevice: {}, ieCore.compile_model(model, targetDevice, pluginConfig", reinterpret_cast<void*>(&ieCore), reinterpret_cast<void*>(this->model.get()), this->targetDevice);
     if (startsWith(this->targetDevice, "GPU")) {
 #ifdef __linux__
         if (globalVaDisplay) {
             OV_LOGGER("ov::intel_gpu::ocl::VAContext(core: {}, globalVaDisplay: {})", (void*)&this->ieCore, globalVaDisplay);
-            this->vaContext = std::make_unique<ov::intel_gpu::ocl::VAContext>(this->ieCore, globalVaDisplay);
-            OV_LOGGER("ov::Core: {} compile_model(model: {}, vaContext:{}, pluginConfig:{})", (void*)&this->ieCore, (void*)this->model.get(), (void*)this->vaContext.get(), (void*)&pluginConfig);
-            compiledModel = std::make_shared<ov::CompiledModel>(ieCore.compile_model(this->model, *this->vaContext, pluginConfig));
+            activeShapeVariant->vaContext = std::make_shared<ov::intel_gpu::ocl::VAContext>(this->ieCore, globalVaDisplay);
+            OV_LOGGER("ov::Core: {} compile_model(model: {}, vaContext:{}, pluginConfig:{})", (void*)&this->ieCore, (void*)this->model.get(), (void*)activeShapeVariant->vaContext.get(), (void*)&pluginConfig);
+            compiledModel = std::make_shared<ov::CompiledModel>(ieCore.compile_model(this->model, *activeShapeVariant->vaContext, pluginConfig));
         } else {
             OV_LOGGER("ov::Core: {} compile_model(model: {}, target_device:{}, pluginConfig:{})", (void*)&this->ieCore, (void*)this->model.get(), this->targetDevice, (void*)&pluginConfig);
             compiledModel = std::make_shared<ov::CompiledModel>(ieCore.compile_model(this->model, this->targetDevice, pluginConfig));
@@ -991,20 +998,20 @@ void ModelInstance::loadCompiledModelPtr(const plugin_config_t& pluginConfig) {
 #endif
 
 #ifdef __linux__
-        OV_LOGGER("ov::CompiledModel->get_context().as<ov::intel_gpu::ocl::ClContext>, compiledModel: {}", (void*)this->compiledModel.get());
+        OV_LOGGER("ov::CompiledModel->get_context().as<ov::intel_gpu::ocl::ClContext>, compiledModel: {}", (void*)compiledModel.get());
         const auto oclContext = compiledModel->get_context().as<ov::intel_gpu::ocl::ClContext>();
         OV_LOGGER("ov::intel_gpu::ocl::ClContext(oclContext: {})", (void*)&oclContext);
-        this->oclContextCpp = std::make_unique<ov::intel_gpu::ocl::ClContext>(oclContext);
-        OV_LOGGER("ov::intel_gpu::ocl::ClContext::get(), oclContextCpp: {}", (void*)this->oclContextCpp.get());
-        this->oclContextC = this->oclContextCpp->get();
+        activeShapeVariant->oclContext = std::make_shared<ov::intel_gpu::ocl::ClContext>(oclContext);
+        OV_LOGGER("ov::intel_gpu::ocl::ClContext::get(), oclContextCpp: {}", (void*)activeShapeVariant->oclContext.get());
+        this->oclContextC = activeShapeVariant->oclContext->get();
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Model: {}, version:{}, oclContextC:{}", getName(), getVersion(), (void*)&this->oclContextC);
 #endif
     } else {
         compiledModel = std::make_shared<ov::CompiledModel>(ieCore.compile_model(this->model, this->targetDevice, pluginConfig));
 // TODO reset contexts
 #ifdef __linux__
-        this->oclContextCpp.reset();
-        this->vaContext.reset();
+        activeShapeVariant->oclContext.reset();
+        activeShapeVariant->vaContext.reset();
         this->oclContextC = nullptr;
 #endif
     }
@@ -1073,7 +1080,7 @@ Status ModelInstance::loadOVCompiledModel(const ModelConfig& config) {
     }
     logOVPluginConfig([this](const std::string& key) {
             OV_LOGGER("ov::CompiledModel:{} get_property({})", reinterpret_cast<void*>(this->model.get()), key);
-            return this->compiledModel->get_property(key); },
+            return this->activeShapeVariant->compiledModel->get_property(key); },
         std::string("compiled model: ") + getName(),
         std::string(" version: ") + std::to_string(getVersion()) + std::string("; target device: ") + targetDevice + ";");
     return StatusCode::OK;
@@ -1193,7 +1200,7 @@ Status ModelInstance::prepareInferenceRequestsQueue(const ModelConfig& config) {
     if (numberOfParallelInferRequests == 0) {
         return Status(StatusCode::INVALID_NIREQ, "Exceeded allowed nireq value");
     }
-    inferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*compiledModel, numberOfParallelInferRequests);
+    activeShapeVariant->inferRequestsQueue = std::make_unique<OVInferRequestsQueue>(*activeShapeVariant->compiledModel, numberOfParallelInferRequests);
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, numberOfParallelInferRequests);
     auto batchSize = getBatchSize();
     SPDLOG_INFO("Loaded model {}; version: {}; batch size: {}; No of InferRequests: {}",
@@ -1204,6 +1211,84 @@ Status ModelInstance::prepareInferenceRequestsQueue(const ModelConfig& config) {
     return StatusCode::OK;
 }
 
+void ModelInstance::warmup(const ModelConfig& config) {
+    this->status.setWarmupTimeUs(0);
+    if (!config.isWarmupEnabled()) {
+        return;
+    }
+    std::string dataPath = config.getWarmupDataPath();
+    if (!dataPath.empty() && std::filesystem::path(dataPath).is_relative()) {
+        dataPath = FileSystem::joinPath({this->path, dataPath});
+    }
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Warming up model: {}; version: {}; iterations: {}; infer requests: {}",
+        getName(), getVersion(), config.getWarmupIterations(), activeShapeVariant->inferRequestsQueue->getStreamsCount());
+    auto warmupStart = std::chrono::steady_clock::now();
+    auto status = runWarmup(*activeShapeVariant->inferRequestsQueue, getInputsInfo(), config.getWarmupIterations(), dataPath);
+    auto warmupTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - warmupStart).count();
+    if (!status.ok()) {
+        // warm-up is an optimization only, model is still served
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Warm-up of model: {}; version: {} failed: {}", getName(), getVersion(), status.string());
+        return;
+    }
+    this->status.setWarmupTimeUs(warmupTimeUs);
+    SPDLOG_LOGGER_INFO(modelmanager_logger, "Warm-up of model: {}; version: {} took {} ms", getName(), getVersion(), warmupTimeUs / 1000);
+}
+
+Status ModelInstance::prepareDynamicBatchingScheduler(const ModelConfig& config) {
+    dynamicBatchingScheduler.reset();
+    if (!config.isDynamicBatchingEnabled()) {
+        return StatusCode::OK;
+    }
+    if (config.isDynamicParameterEnabled()) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Dynamic batching is not supported together with auto batch size or shape; model: {}; version: {}. Dynamic batching will be disabled",
+            getName(), getVersion());
+        return StatusCode::OK;
+    }
+    for (const auto& [name, input] : getInputsInfo()) {
+        if (input->getPrecision() == Precision::STRING) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Dynamic batching is not supported for models with string inputs; model: {}; version: {}. Dynamic batching will be disabled",
+                getName(), getVersion());
+            return StatusCode::OK;
+        }
+    }
+    auto batchSize = getBatchSize();
+    if (!batchSize.has_value()) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Dynamic batching requires batch dimension in model layout; model: {}; version: {}. Dynamic batching will be disabled",
+            getName(), getVersion());
+        return StatusCode::OK;
+    }
+    // outputs are split back to requests along the same dimension inputs are concatenated
+    const size_t batchIndex = getBatchSizeIndex();
+    for (const auto& [name, output] : getOutputsInfo()) {
+        const auto& outputBatchIndex = output->getLayout().getBatchIndex();
+        const auto& shape = output->getShape();
+        if (!outputBatchIndex.has_value() || outputBatchIndex.value() != batchIndex || shape.size() <= batchIndex || shape[batchIndex] != batchSize.value()) {
+            SPDLOG_LOGGER_WARN(modelmanager_logger, "Dynamic batching requires outputs batched along input batch dimension; model: {}; version: {}; output: {}; layout: {}; shape: {}. Dynamic batching will be disabled",
+                getName(), getVersion(), name, output->getLayout(), shape.toString());
+            return StatusCode::OK;
+        }
+    }
+    size_t maxBatchSize = config.getMaxBatchSize();
+    if (maxBatchSize == 0) {
+        if (batchSize.value().isAny()) {
+            SPDLOG_LOGGER_ERROR(modelmanager_logger, "Model: {}; version: {} has unbounded batch dimension. max_batch_size is required to enable dynamic batching",
+                getName(), getVersion());
+            return StatusCode::INVALID_BATCH_SIZE;
+        }
+        maxBatchSize = batchSize.value().isStatic() ? batchSize.value().getStaticValue() : batchSize.value().getMaxValue();
+    } else if (!batchSize.value().match(maxBatchSize)) {
+        SPDLOG_LOGGER_ERROR(modelmanager_logger, "Model: {}; version: {} batch dimension: {} does not accept max_batch_size: {}",
+            getName(), getVersion(), batchSize.value().toString(), maxBatchSize);
+        return StatusCode::INVALID_BATCH_SIZE;
+    }
+    try {
+        dynamicBatchingScheduler = std::make_unique<DynamicBatchingScheduler>(*this, maxBatchSize, config.getMaxQueueDelayUs());
+    } catch (const std::logic_error& e) {
+        SPDLOG_LOGGER_WARN(modelmanager_logger, "Dynamic batching will be disabled for model: {}; version: {}; reason: {}", getName(), getVersion(), e.what());
+    }
+    return StatusCode::OK;
+}
+
 void ModelInstance::configureBatchSize(const ModelConfig& config, const DynamicModelParameter& parameter) {
     if (parameter.isBatchSizeRequested()) {
         OV_LOGGER("ov::Model: {}, ov::set_batch({})", reinterpret_cast<void*>(this->model.get()), parameter.getBatchSize());
@@ -1211,21 +1296,28 @@ void ModelInstance::configureBatchSize(const ModelConfig& config, const DynamicM
     } else if (config.getBatchSize().has_value()) {
         OV_LOGGER("ov::Model: {}, ov::set_batch({})", reinterpret_cast<void*>(this->model.get()), ovms::Dimension(config.getBatchSize().value().createPartialDimension()).toString());
         ov::set_batch(model, config.getBatchSize().value().createPartialDimension());
+    } else if (config.isDynamicBatchingEnabled() && config.getMaxBatchSize() > 1 && config.getShapes().empty()) {
+        // batch dimension has to accept any number of merged requests up to max_batch_size
+        const Dimension batchRange(1, config.getMaxBatchSize());
+        OV_LOGGER("ov::Model: {}, ov::set_batch({})", reinterpret_cast<void*>(this->model.get()), batchRange.toString());
+        ov::set_batch(model, batchRange.createPartialDimension());
     }
 }
 
 void ModelInstance::loadTensorFactories() {
     using std::make_shared;
-    this->tensorFactories.clear();
-    this->tensorFactories.emplace(OVMS_BUFFERTYPE_CPU, make_shared<RegularOVTensorFactory>());
+    // factories reference remote contexts of the compiled model, both are kept in the same shape variant
+    auto& tensorFactories = activeShapeVariant->tensorFactories;
+    tensorFactories.clear();
+    tensorFactories.emplace(OVMS_BUFFERTYPE_CPU, make_shared<RegularOVTensorFactory>());
 // TODO windows
 #ifdef __linux__
-    if (this->oclContextCpp) {
-        this->tensorFactories.emplace(OVMS_BUFFERTYPE_OPENCL, make_shared<OpenCLTensorFactory>(*this->oclContextCpp));
+    if (activeShapeVariant->oclContext) {
+        tensorFactories.emplace(OVMS_BUFFERTYPE_OPENCL, make_shared<OpenCLTensorFactory>(*activeShapeVariant->oclContext));
         // TODO what to do if display was not initialized? not allow in validation? but here we don't have the information about vacontext unless it is global
 
-        this->tensorFactories.emplace(OVMS_BUFFERTYPE_VASURFACE_Y, make_shared<VAAPITensorFactory>(*this->vaContext, OVMS_BUFFERTYPE_VASURFACE_Y));
-        this->tensorFactories.emplace(OVMS_BUFFERTYPE_VASURFACE_UV, make_shared<VAAPITensorFactory>(*this->vaContext, OVMS_BUFFERTYPE_VASURFACE_UV));
+        tensorFactories.emplace(OVMS_BUFFERTYPE_VASURFACE_Y, make_shared<VAAPITensorFactory>(*activeShapeVariant->vaContext, OVMS_BUFFERTYPE_VASURFACE_Y));
+        tensorFactories.emplace(OVMS_BUFFERTYPE_VASURFACE_UV, make_shared<VAAPITensorFactory>(*activeShapeVariant->vaContext, OVMS_BUFFERTYPE_VASURFACE_UV));
     }
 #endif
     // TODO test MULTI/AUTO/HETERO
@@ -1238,6 +1330,8 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
     subscriptionManager.notifySubscribers();
     this->path = config.getPath();
     this->config = config;
+    shapeVariants->setCapacity(this->config.getShapeVariantsCacheSize());
+    admissionController.setLimits(this->config.getMaxPendingRequests(), this->config.getMaxQueueWaitMs());
     this->targetDevice = this->config.getTargetDevice();
     if (this->targetDevice.empty()) {
         this->targetDevice = recommendTargetDevice();
@@ -1285,6 +1379,11 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
             this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
             return status;
         }
+        status = prepareDynamicBatchingScheduler(this->config);
+        if (!status.ok()) {
+            this->status.setLoading(ModelVersionStatusErrorCode::UNKNOWN);
+            return status;
+        }
         this->checkForOutputTensorResetAbility();
         this->loadTensorFactories();
     } catch (const ov::Exception& e) {
@@ -1297,17 +1396,52 @@ Status ModelInstance::loadModelImpl(const ModelConfig& config, const DynamicMode
         return StatusCode::MODEL_NOT_LOADED;
     }
     try {
-        OV_LOGGER("ov::CompiledModel: {} compiledModel->get_property(ov::loaded_from_cache)", reinterpret_cast<void*>(compiledModel.get()));
-        bool isModelLoadedFromCache = compiledModel->get_property(ov::loaded_from_cache);
+        OV_LOGGER("ov::CompiledModel: {} compiledModel->get_property(ov::loaded_from_cache)", reinterpret_cast<void*>(activeShapeVariant->compiledModel.get()));
+        bool isModelLoadedFromCache = activeShapeVariant->compiledModel->get_property(ov::loaded_from_cache);
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Is model loaded from cache: {}", isModelLoadedFromCache);
     } catch (...) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Unable to get information if model was loaded from cache; model: {}; version: {}; device: {}", getName(), getVersion(), this->targetDevice);
     }
+    if (!parameter.isRequested()) {
+        // reload triggered by request with new shape is warmed up by that request
+        warmup(this->config);
+    }
+    activeShapeVariantKey = getLoadedShapeVariantKey();
     this->status.setAvailable();
     modelLoadedNotify.notify_all();
     return status;
 }
 
+std::string ModelInstance::getLoadedShapeVariantKey() const {
+    if (shapeVariants->getCapacity() == 0) {
+        return "";
+    }
+    if (this->config.getBatchingMode() == Mode::AUTO) {
+        auto batchSize = getBatchSize();
+        if (!batchSize.has_value() || !batchSize.value().isStatic()) {
+            return "";
+        }
+        return ShapeVariantsCache::createKey(batchSize.value().getStaticValue(), {});
+    }
+    if (!this->config.anyShapeSetToAuto()) {
+        return "";
+    }
+    // key has to match the one created from request shapes when switching back to this variant
+    std::map<std::string, shape_t> shapes;
+    for (const auto& [name, input] : activeShapeVariant->inputsInfo) {
+        const auto& shape = input->getShape();
+        if (!shape.isStatic()) {
+            return "";
+        }
+        shape_t staticShape;
+        for (const auto& dim : shape) {
+            staticShape.push_back(dim.getStaticValue());
+        }
+        shapes[name] = std::move(staticShape);
+    }
+    return ShapeVariantsCache::createKey(std::nullopt, shapes);
+}
+
 Status ModelInstance::setCacheOptions(const ModelConfig& config) {
     if (!config.getCacheDir().empty()) {
         if (!config.isAllowCacheSetToTrue() && (config.isCustomLoaderRequiredToLoadModel() || config.anyShapeSetToAuto() || (config.getBatchingMode() == Mode::AUTO))) {
@@ -1331,14 +1465,23 @@ Status ModelInstance::loadModel(const ModelConfig& config) {
     std::lock_guard<std::recursive_mutex> loadingLock(loadingMutex);
     SPDLOG_INFO("Loading model: {}, version: {}, from path: {}, with target device: {} ...",
         config.getName(), config.getVersion(), config.getPath(), config.getTargetDevice());
-    if (config.getBatchingMode() == AUTO) {
+    if (config.isDynamicParameterEnabled()) {
         SPDLOG_INFO("Batch size mode for model {} is set to auto", config.getName());
     } else if (config.anyShapeSetToAuto()) {
         SPDLOG_INFO("Some inputs shapes for model {} are set to auto", config.getName());
     }
     this->status = ModelVersionStatus(config.getName(), config.getVersion());
     this->status.setLoading();
-    return loadModelImpl(config);
+    shapeVariants->clear();
+    activeShapeVariantKey.clear();
+    auto loadStart = std::chrono::steady_clock::now();
+    auto status = loadModelImpl(config);
+    if (status.ok()) {
+        auto loadTimeUs = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - loadStart).count();
+        SPDLOG_INFO("Loaded model: {}, version: {} in {} ms", config.getName(), config.getVersion(), loadTimeUs / 1000);
+        SET_IF_ENABLED(this->getMetricReporter().loadTime, loadTimeUs);
+    }
+    return status;
 }
 
 Status ModelInstance::reloadModel(const ModelConfig& config, const DynamicModelParameter& parameter) {
@@ -1354,6 +1497,11 @@ Status ModelInstance::reloadModel(const ModelConfig& config, const DynamicModelP
         isCustomLoaderConfigChanged = false;
         retireModel(isCustomLoaderConfigChanged);
     }
+    if (!parameter.isRequested()) {
+        // cached variants were compiled with previous configuration
+        shapeVariants->clear();
+        activeShapeVariantKey.clear();
+    }
     return loadModelImpl(config, parameter);
 }
 
@@ -1394,15 +1542,40 @@ Status ModelInstance::reloadModel(std::optional<Dimension> batchSize, std::map<s
     SPDLOG_INFO("Will reload model: {} version: {}", getName(), getVersion());
 
     DynamicModelParameter parameter;
+    std::string variantKey;
     if (batchSize.has_value() && batchSize.value().isStatic()) {
         parameter = DynamicModelParameter(batchSize.value().getStaticValue());
+        variantKey = ShapeVariantsCache::createKey(batchSize.value().getStaticValue(), {});
     } else if (requestShapes.size() > 0) {
         parameter = DynamicModelParameter(requestShapes);
+        variantKey = ShapeVariantsCache::createKey(std::nullopt, requestShapes);
     } else {
         SPDLOG_DEBUG("Error: requested model: {} version: {} reload with no batchsize and shapes set.", getName(), getVersion());
         return StatusCode::INTERNAL_ERROR;
     }
 
+    const bool useShapeVariants = shapeVariants->getCapacity() > 0;
+    if (useShapeVariants) {
+        // in-flight requests keep previous variant through their unload guards
+        if (loadCachedShapeVariant(variantKey)) {
+            unloadGuard = std::make_unique<ModelInstanceUnloadGuard>(*this);
+            return StatusCode::OK;
+        }
+        // model is reshaped in place so recompilation waits for in-flight requests
+        this->status.setLoading();
+        while (!canUnloadInstance()) {
+            SPDLOG_INFO("Waiting to reload model: {} version: {}. Blocked by: {} inferences in progress.",
+                getName(), getVersion(), predictRequestsHandlesCount.load());
+            std::this_thread::sleep_for(std::chrono::milliseconds(UNLOAD_AVAILABILITY_CHECKING_INTERVAL_MILLISECONDS));
+        }
+        cacheActiveShapeVariant();
+    }
+    enum : unsigned int {
+        COMPILE,
+        TIMER_END
+    };
+    Timer<TIMER_END> timer;
+    timer.start(COMPILE);
     auto status = reloadModel(config, parameter);
     if (!status.ok()) {
         status = this->reshapeWithFullReload(status, parameter);
@@ -1410,10 +1583,45 @@ Status ModelInstance::reloadModel(std::optional<Dimension> batchSize, std::map<s
             return this->recoverFromReloadingError(status);
         }
     }
+    timer.stop(COMPILE);
+    if (useShapeVariants) {
+        activeShapeVariantKey = variantKey;
+        OBSERVE_IF_ENABLED(this->getMetricReporter().shapeVariantCompileTime, timer.elapsed<std::chrono::microseconds>(COMPILE));
+    }
     unloadGuard = std::make_unique<ModelInstanceUnloadGuard>(*this);
     return status;
 }
 
+bool ModelInstance::loadCachedShapeVariant(const std::string& key) {
+    auto variant = shapeVariants->take(key);
+    if (!variant) {
+        INCREMENT_IF_ENABLED(this->getMetricReporter().shapeVariantMisses);
+        return false;
+    }
+    INCREMENT_IF_ENABLED(this->getMetricReporter().shapeVariantHits);
+    subscriptionManager.notifySubscribers();
+    // ov::Model keeps last compiled shapes, it is only used to compile next variant
+    if (!activeShapeVariantKey.empty() && activeShapeVariant->inferRequestsQueue) {
+        shapeVariants->put(activeShapeVariantKey, activeShapeVariant);
+    }
+#ifdef __linux__
+    this->oclContextC = variant->oclContext ? variant->oclContext->get() : nullptr;
+#endif
+    std::atomic_store(&activeShapeVariant, variant);
+    this->activeShapeVariantKey = key;
+    SPDLOG_INFO("Loaded cached shape variant: {} of model: {}; version: {}", key, getName(), getVersion());
+    return true;
+}
+
+void ModelInstance::cacheActiveShapeVariant() {
+    if (activeShapeVariantKey.empty() || !activeShapeVariant->compiledModel || !activeShapeVariant->inferRequestsQueue) {
+        return;
+    }
+    shapeVariants->put(activeShapeVariantKey, activeShapeVariant);
+    std::atomic_store(&activeShapeVariant, std::make_shared<ModelShapeVariant>());
+    activeShapeVariantKey.clear();
+}
+
 Status ModelInstance::reloadModelIfRequired(
     Status validationStatus,
     const std::optional<Dimension>& requestedBatchSize,
@@ -1522,12 +1730,11 @@ void ModelInstance::unloadModelComponents() {
     }
     SET_IF_ENABLED(this->getMetricReporter().inferReqQueueSize, 0);
     SET_IF_ENABLED(this->getMetricReporter().streams, 0);
-    inferRequestsQueue.reset();
-    tensorFactories.clear();
-    compiledModel.reset();
+    dynamicBatchingScheduler.reset();
+    shapeVariants->clear();
+    activeShapeVariantKey.clear();
+    std::atomic_store(&activeShapeVariant, std::make_shared<ModelShapeVariant>());
     model.reset();
-    outputsInfo.clear();
-    inputsInfo.clear();
     modelFiles.clear();
 
     if (this->config.isCustomLoaderRequiredToLoadModel()) {
@@ -1599,10 +1806,10 @@ void ModelInstance::checkForOutputTensorResetAbility() {
             allOutputsSupported = false;
         }
     }
-    this->supportOutputTensorsReset = allOutputsSupported;
+    activeShapeVariant->supportOutputTensorsReset = allOutputsSupported;
 }
 bool ModelInstance::doesSupportOutputReset() const {
-    return this->supportOutputTensorsReset;
+    return getActiveShapeVariant()->supportOutputTensorsReset;
 }
 
 std::optional<Dimension> ModelInstance::getBatchSize() const {
@@ -1614,12 +1821,105 @@ std::optional<Dimension> ModelInstance::getBatchSize() const {
 }
 
 OVInferRequestsQueue& ModelInstance::getInferRequestsQueue() {
-    return *inferRequestsQueue;
+    return *getActiveShapeVariant()->inferRequestsQueue;
+}
+
+const tensor_map_t& ModelInstance::getInputsInfo() const {
+    return getActiveShapeVariant()->inputsInfo;
+}
+
+const tensor_map_t& ModelInstance::getOutputsInfo() const {
+    return getActiveShapeVariant()->outputsInfo;
+}
+
+const std::unordered_map<int, std::shared_ptr<IOVTensorFactory>> ModelInstance::getTensorFactories() {
+    return getActiveShapeVariant()->tensorFactories;
+}
+
+std::shared_ptr<ModelShapeVariant> ModelInstance::getActiveShapeVariant() const {
+    return std::atomic_load(&activeShapeVariant);
+}
+
+Status ModelInstance::checkDeadline(const std::optional<std::chrono::steady_clock::time_point>& deadline) {
+    if (!this->config.isDeadlineDispatchEnabled() || !deadline.has_value()) {
+        return StatusCode::OK;
+    }
+    if (std::chrono::steady_clock::now() < deadline.value()) {
+        return StatusCode::OK;
+    }
+    INCREMENT_IF_ENABLED(this->getMetricReporter().requestsDeadlineDropped);
+    SPDLOG_DEBUG("Dropping request to model: {}; version: {} since its deadline has passed", getName(), getVersion());
+    return StatusCode::INFERENCE_DEADLINE_EXCEEDED;
+}
+
+Status ModelInstance::admitRequest(uint32_t pendingRequests, size_t parallelRequests) {
+    if (!admissionController.isEnabled()) {
+        return StatusCode::OK;
+    }
+    auto status = admissionController.admit(pendingRequests, parallelRequests);
+    if (!status.ok()) {
+        INCREMENT_IF_ENABLED(this->getMetricReporter().requestsShed);
+        SPDLOG_DEBUG("Shedding request to model: {}; version: {}", getName(), getVersion());
+    }
+    return status;
+}
+
+Status ModelInstance::acquireInferRequestStream(OVInferRequestsQueue& inferRequestsQueue, const std::optional<std::chrono::steady_clock::time_point>& deadline, int& streamId) {
+    auto status = admitRequest(inferRequestsQueue.getWaitersCount(), inferRequestsQueue.getStreamsCount());
+    if (!status.ok()) {
+        return status;
+    }
+    return acquireAdmittedInferRequestStream(inferRequestsQueue, deadline, streamId);
+}
+
+Status ModelInstance::acquireAdmittedInferRequestStream(OVInferRequestsQueue& inferRequestsQueue, const std::optional<std::chrono::steady_clock::time_point>& deadline, int& streamId) {
+    if (!this->config.isDeadlineDispatchEnabled()) {
+        streamId = inferRequestsQueue.acquireIdleStream();
+        return StatusCode::OK;
+    }
+    auto status = checkDeadline(deadline);
+    if (!status.ok()) {
+        return status;
+    }
+    auto acquired = inferRequestsQueue.acquireIdleStreamBefore(deadline.value_or(std::chrono::steady_clock::time_point::max()));
+    if (!acquired.has_value()) {
+        INCREMENT_IF_ENABLED(this->getMetricReporter().requestsDeadlineDropped);
+        SPDLOG_DEBUG("Dropping request to model: {}; version: {} since no infer request became idle before its deadline", getName(), getVersion());
+        return StatusCode::INFERENCE_DEADLINE_EXCEEDED;
+    }
+    streamId = acquired.value();
+    return StatusCode::OK;
+}
+
+Status ModelInstance::acquireInferRequestStreamOrNotify(OVInferRequestsQueue& inferRequestsQueue, const std::optional<std::chrono::steady_clock::time_point>& deadline, std::optional<int>& streamId, std::function<void(const Status&, int)> onStreamReady) {
+    auto status = admitRequest(inferRequestsQueue.getWaitersCount(), inferRequestsQueue.getStreamsCount());
+    if (!status.ok()) {
+        return status;
+    }
+    auto waitDeadline = std::chrono::steady_clock::time_point::max();
+    if (this->config.isDeadlineDispatchEnabled()) {
+        status = checkDeadline(deadline);
+        if (!status.ok()) {
+            return status;
+        }
+        waitDeadline = deadline.value_or(std::chrono::steady_clock::time_point::max());
+    }
+    streamId = inferRequestsQueue.acquireIdleStreamOrNotify(waitDeadline, [this, onStreamReady = std::move(onStreamReady)](std::optional<int> acquired) {
+        if (!acquired.has_value()) {
+            INCREMENT_IF_ENABLED(this->getMetricReporter().requestsDeadlineDropped);
+            SPDLOG_DEBUG("Dropping request to model: {}; version: {} since no infer request became idle before its deadline", getName(), getVersion());
+            onStreamReady(StatusCode::INFERENCE_DEADLINE_EXCEEDED, -1);
+            return;
+        }
+        onStreamReady(StatusCode::OK, acquired.value());
+    });
+    return StatusCode::OK;
 }
 
 const size_t ModelInstance::getBatchSizeIndex() const {
-    const auto& inputItr = this->inputsInfo.cbegin();
-    if (inputItr == this->inputsInfo.cend()) {
+    const auto& inputsInfo = getInputsInfo();
+    const auto& inputItr = inputsInfo.cbegin();
+    if (inputItr == inputsInfo.cend()) {
         throw std::logic_error("model has no inputs");
     }
     const auto& input = inputItr->second;
@@ -1632,7 +1932,8 @@ const size_t ModelInstance::getBatchSizeIndex() const {
 
 uint32_t ModelInstance::getOptimalNumberOfInferRequests() const {
     try {
-        OV_LOGGER("compiledModel: {}, ompiledModel->get_property(ov::optimal_number_of_infer_requests)", reinterpret_cast<const void*>(this->compiledModel.get()));
+        auto compiledModel = getActiveShapeVariant()->compiledModel;
+        OV_LOGGER("compiledModel: {}, ompiledModel->get_property(ov::optimal_number_of_infer_requests)", reinterpret_cast<const void*>(compiledModel.get()));
         uint32_t numOptimalInferRequests = compiledModel->get_property(ov::optimal_number_of_infer_requests);
         SPDLOG_LOGGER_INFO(modelmanager_logger, "Number of OpenVINO streams: {}", numOptimalInferRequests);
         return numOptimalInferRequests;
@@ -1644,7 +1945,8 @@ uint32_t ModelInstance::getOptimalNumberOfInferRequests() const {
 
 uint32_t ModelInstance::getNumOfStreams() const {
     try {
-        OV_LOGGER("compiledModel: {}, ompiledModel->get_property(ov::num_streams)", reinterpret_cast<const void*>(this->compiledModel.get()));
+        auto compiledModel = getActiveShapeVariant()->compiledModel;
+        OV_LOGGER("compiledModel: {}, ompiledModel->get_property(ov::num_streams)", reinterpret_cast<const void*>(compiledModel.get()));
         uint32_t numStreams = compiledModel->get_property(ov::num_streams);
         SPDLOG_LOGGER_INFO(modelmanager_logger, "Number of OpenVINO streams: {}", numStreams);
         return numStreams;
@@ -31,6 +31,7 @@
 
 #include <openvino/core/any.hpp>
 
+#include "admission_controller.hpp"
 #include "model_metric_reporter.hpp"
 #include "modelchangesubscription.hpp"
 #include "modelconfig.hpp"
@@ -61,12 +62,15 @@ class RemoteTensor;
 
 namespace ovms {
 
+class DynamicBatchingScheduler;
 class MetricRegistry;
 class ModelInstanceUnloadGuard;
 class InferenceRequest;
 class InferenceResponse;
 class IOVTensorFactory;
 class OVInferRequestsQueue;
+class ShapeVariantsCache;
+struct ModelShapeVariant;
 struct NotifyReceiver;
 class Status;
 template <typename T1, typename T2>
@@ -87,6 +91,7 @@ public:
         shapes(shapes) {}
 
     bool isBatchSizeRequested() const { return batchSize.has_value(); }
+    bool isRequested() const { return batchSize.has_value() || !shapes.empty(); }
     bool isShapeRequested(const std::string& name) const { return shapes.count(name) && shapes.at(name).size() > 0; }
 
     int getBatchSize() const { return batchSize.value_or(1); }
@@ -120,9 +125,11 @@ protected:
     std::shared_ptr<ov::Model> model;
 
     /**
-         * @brief OpenVINO Runtime CompiledModel object
+         * @brief Compiled model, infer requests, tensors info and tensor factories for currently loaded shapes
+         *
+         * Replaced atomically, requests keep the variant they started with alive through unload guard.
          */
-    std::shared_ptr<ov::CompiledModel> compiledModel;
+    std::shared_ptr<ModelShapeVariant> activeShapeVariant;
 
 public:
     // TODO windows
@@ -135,11 +142,6 @@ public:
 #endif
 
 protected:
-#ifdef __linux__
-    std::unique_ptr<ov::intel_gpu::ocl::ClContext> oclContextCpp;
-    std::unique_ptr<ov::intel_gpu::ocl::VAContext> vaContext;
-#endif
-    std::unordered_map<int, std::shared_ptr<IOVTensorFactory>> tensorFactories;
     /**
          * @brief Model name
          */
@@ -255,6 +257,16 @@ protected:
          */
     Status prepareInferenceRequestsQueue(const ModelConfig& config);
 
+    /**
+         * @brief Prepares dynamic batching scheduler if requested in model config
+         */
+    Status prepareDynamicBatchingScheduler(const ModelConfig& config);
+
+    /**
+         * @brief Runs warm-up inferences on all infer requests if requested in model config and stores warm-up time in model status
+         */
+    void warmup(const ModelConfig& config);
+
     /**
          * @brief Fetch model file paths
          *
@@ -284,22 +296,26 @@ private:
          */
     std::vector<std::string> modelFiles;
 
+private:
     /**
-         * @brief Holds the information about inputs and it's parameters
+         * @brief Server side batching stage, created only when dynamic batching is enabled in model config
          */
-    tensor_map_t inputsInfo;
+    std::unique_ptr<DynamicBatchingScheduler> dynamicBatchingScheduler;
 
     /**
-         * @brief Holds the information about outputs and it's parameters
+         * @brief Previously compiled variants of the model for auto batch size or shape
          */
-protected:
-    tensor_map_t outputsInfo;
+    std::unique_ptr<ShapeVariantsCache> shapeVariants;
 
-private:
     /**
-         * @brief OpenVINO inference execution stream pool
+         * @brief Key of currently loaded shape variant, empty when shape variants cache is disabled
          */
-    std::unique_ptr<OVInferRequestsQueue> inferRequestsQueue;
+    std::string activeShapeVariantKey;
+
+    /**
+         * @brief Rejects requests over max_pending_requests and max_queue_wait_ms limits
+         */
+    AdmissionController admissionController;
 
     /**
          * @brief Holds current usage count in predict requests
@@ -308,6 +324,23 @@ private:
          */
     std::atomic<uint64_t> predictRequestsHandlesCount = 0;
 
+    /**
+         * @brief Swaps currently loaded variant with cached one if present, without waiting for in-flight requests
+         *
+         * @return true if cached variant was loaded
+         */
+    bool loadCachedShapeVariant(const std::string& key);
+
+    /**
+         * @brief Moves currently loaded variant into the shape variants cache
+         */
+    void cacheActiveShapeVariant();
+
+    /**
+         * @brief Key of shape variant loaded with model config, empty if model has no auto batch size or shape
+         */
+    std::string getLoadedShapeVariantKey() const;
+
     /**
          * @brief Internal method for loading tensors
          *
@@ -345,7 +378,6 @@ private:
      */
     void checkForOutputTensorResetAbility();
     Status adjustForEmptyOutputNames();
-    bool supportOutputTensorsReset = true;
 
 public:
     bool doesSupportOutputReset() const;
@@ -426,6 +458,24 @@ public:
         return targetDevice;
     }
 
+    /**
+         * @brief Gets OpenVINO Runtime Core used to compile the model
+         *
+         * @return core
+         */
+    ov::Core& getIeCore() const {
+        return ieCore;
+    }
+
+    /**
+         * @brief Gets OpenVINO Runtime Model with layout, shape and preprocessing configuration applied
+         *
+         * @return model
+         */
+    std::shared_ptr<const ov::Model> getOVModel() const {
+        return model;
+    }
+
     /**
          * @brief Gets path for the model
          *
@@ -490,9 +540,7 @@ public:
          *
          * @return const tensor_map_t& 
          */
-    virtual const tensor_map_t& getInputsInfo() const {
-        return inputsInfo;
-    }
+    virtual const tensor_map_t& getInputsInfo() const;
 
     /**
            * @brief Get RTMap Info object
@@ -513,9 +561,7 @@ public:
          *
          * @return const tensor_map_t& 
          */
-    virtual const tensor_map_t& getOutputsInfo() const {
-        return outputsInfo;
-    }
+    virtual const tensor_map_t& getOutputsInfo() const;
 
     /**
          * @brief Check if can unload infer requests
@@ -533,6 +579,67 @@ public:
          */
     OVInferRequestsQueue& getInferRequestsQueue();
 
+    /**
+         * @brief Acquires idle infer request stream. With edf dispatch policy waiting callers are served
+         * in deadline order and waiting is bounded by the deadline
+         *
+         * @param inferRequestsQueue queue of shape variant the request was validated against
+         *
+         * @return INFERENCE_DEADLINE_EXCEEDED if deadline passed before any stream became idle,
+         * SERVABLE_OVERLOADED if admission control limits are exceeded
+         */
+    Status acquireInferRequestStream(OVInferRequestsQueue& inferRequestsQueue, const std::optional<std::chrono::steady_clock::time_point>& deadline, int& streamId);
+
+    /**
+         * @brief Acquires idle infer request stream for request which already passed admission control,
+         * used by dynamic batching scheduler which admits requests when they are enqueued for batching
+         *
+         * @return INFERENCE_DEADLINE_EXCEEDED if deadline passed before any stream became idle
+         */
+    Status acquireAdmittedInferRequestStream(OVInferRequestsQueue& inferRequestsQueue, const std::optional<std::chrono::steady_clock::time_point>& deadline, int& streamId);
+
+    /**
+         * @brief Acquires idle infer request stream without blocking the caller when no stream is idle
+         *
+         * @param inferRequestsQueue queue of shape variant the request was validated against
+         * @param streamId set when stream was idle, otherwise onStreamReady is called from thread returning
+         * the stream, with INFERENCE_DEADLINE_EXCEEDED status if deadline passed first
+         *
+         * @return SERVABLE_OVERLOADED if admission control limits are exceeded,
+         * INFERENCE_DEADLINE_EXCEEDED if deadline already passed
+         */
+    Status acquireInferRequestStreamOrNotify(OVInferRequestsQueue& inferRequestsQueue, const std::optional<std::chrono::steady_clock::time_point>& deadline, std::optional<int>& streamId, std::function<void(const Status&, int)> onStreamReady);
+
+    /**
+         * @brief Checks max_pending_requests and max_queue_wait_ms limits
+         *
+         * @param pendingRequests number of requests already waiting
+         * @param parallelRequests number of requests which can be served at the same time
+         * @return SERVABLE_OVERLOADED if admission control limits are exceeded
+         */
+    Status admitRequest(uint32_t pendingRequests, size_t parallelRequests);
+
+    /**
+         * @brief Rejects request which deadline already passed, effective only with edf dispatch policy
+         */
+    Status checkDeadline(const std::optional<std::chrono::steady_clock::time_point>& deadline);
+
+    /**
+         * @brief Get admission controller, inference time has to be recorded to estimate wait for idle stream
+         */
+    AdmissionController& getAdmissionController() {
+        return admissionController;
+    }
+
+    /**
+         * @brief Get dynamic batching scheduler
+         *
+         * @return nullptr if dynamic batching is disabled
+         */
+    DynamicBatchingScheduler* getDynamicBatchingScheduler() const {
+        return dynamicBatchingScheduler.get();
+    }
+
     /**
          * @brief Combines plugin config from user with default config calculated at runtime
          *
@@ -621,7 +728,12 @@ public:
 
     uint32_t getOptimalNumberOfInferRequests() const;
     uint32_t getNumOfStreams() const;
-    const std::unordered_map<int, std::shared_ptr<IOVTensorFactory>> getTensorFactories() { return this->tensorFactories; }
+    const std::unordered_map<int, std::shared_ptr<IOVTensorFactory>> getTensorFactories();
+
+    /**
+         * @brief Get currently loaded shape variant, shared with requests executing on it
+         */
+    std::shared_ptr<ModelShapeVariant> getActiveShapeVariant() const;
 
     template <class ArrayType>
     void fetchModelFiles(bool& found, ArrayType ext);
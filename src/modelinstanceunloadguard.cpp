@@ -16,14 +16,21 @@
 #include "modelinstanceunloadguard.hpp"
 
 #include "modelinstance.hpp"
+#include "shape_variants_cache.hpp"
 
 namespace ovms {
 ModelInstanceUnloadGuard::ModelInstanceUnloadGuard(ModelInstance& modelInstance) :
     modelInstance(modelInstance) {
     modelInstance.increasePredictRequestsHandlesCount();
+    shapeVariant = modelInstance.getActiveShapeVariant();
 }
 
 ModelInstanceUnloadGuard::~ModelInstanceUnloadGuard() {
+    shapeVariant.reset();
     modelInstance.decreasePredictRequestsHandlesCount();
 }
+
+const ModelShapeVariant& ModelInstanceUnloadGuard::getShapeVariant() const {
+    return *shapeVariant;
+}
 }  // namespace ovms
@@ -15,8 +15,11 @@
 //*****************************************************************************
 #pragma once
 
+#include <memory>
+
 namespace ovms {
 class ModelInstance;
+struct ModelShapeVariant;
 
 class ModelInstanceUnloadGuard {
 public:
@@ -24,7 +27,11 @@ public:
     ModelInstanceUnloadGuard(ModelInstance& modelInstance);
     ~ModelInstanceUnloadGuard();
 
+    // shape variant loaded when guard was taken, stays valid even if model instance swaps it meanwhile
+    const ModelShapeVariant& getShapeVariant() const;
+
 private:
     ModelInstance& modelInstance;
+    std::shared_ptr<ModelShapeVariant> shapeVariant;
 };
 }  // namespace ovms
@@ -50,6 +50,7 @@
 #include "customloaderconfig.hpp"
 #include "customloaderinterface.hpp"
 #include "customloaders.hpp"
+#include "dags/custom_node_buffer_arena.hpp"
 #include "dags/custom_node_library_manager.hpp"
 #include "dags/pipeline_config_parser.hpp"
 #include "dags/pipeline_factory.hpp"
@@ -65,6 +66,7 @@
 #include "metrics/metric_config.hpp"
 #include "metrics/metric_registry.hpp"
 #include "model.hpp"
+#include "model_metric_reporter.hpp"
 #include "modelinstance.hpp"  // for logging
 #include "modelinstanceunloadguard.hpp"
 #include "ov_utils.hpp"
@@ -72,6 +74,7 @@
 #include "servable_definition.hpp"
 #include "stringutils.hpp"
 #include "systeminfo.hpp"
+#include "utils/parallel_for.hpp"
 
 namespace ovms {
 
@@ -180,11 +183,13 @@ void ModelManager::logPluginConfiguration() {
 ModelManager::~ModelManager() {
     join();
     models.clear();
+    CustomNodeBufferArena::instance().resetMetricReporter(this->customNodeBufferArenaMetricReporter.get());
 }
 
 Status ModelManager::start(const Config& config) {
     this->watcherIntervalMillisec = config.filesystemPollWaitMilliseconds();
     resourcesCleanupIntervalMillisec = config.resourcesCleanerPollWaitSeconds() * 1000;
+    this->modelLoadWorkers = config.modelLoadWorkers();
     Status status;
     this->startedWithConfigFile = (config.configPath() != "");
     if (isStartedWithConfigFile()) {
@@ -449,12 +454,7 @@ Status ModelManager::validateUserSettingsInSingleModelCliGraphStart(const Models
     return StatusCode::OK;
 }
 
-Status ModelManager::processMediapipeConfig(const MediapipeGraphConfig& config, std::set<std::string>& mediapipesInConfigFile, MediapipeFactory& factory) {
-    if (mediapipesInConfigFile.find(config.getGraphName()) != mediapipesInConfigFile.end()) {
-        SPDLOG_LOGGER_WARN(modelmanager_logger, "Duplicated mediapipe names: {} defined in config file. Only first graph will be loaded.", config.getGraphName());
-        return StatusCode::OK;
-    }
-    mediapipesInConfigFile.insert(config.getGraphName());
+Status ModelManager::processMediapipeConfig(const MediapipeGraphConfig& config, MediapipeFactory& factory) {
     MediapipeGraphDefinition* mediapipeGraphDefinition = factory.findDefinitionByName(config.getGraphName());
     if (mediapipeGraphDefinition == nullptr) {
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Mediapipe graph:{} was not loaded so far. Triggering load", config.getGraphName());
@@ -520,6 +520,10 @@ Status ModelManager::ConfigLoader::loadCustomNodeLibrariesConfig(ModelManager& m
         SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Configuration file doesn't have custom node libraries property.");
         return StatusCode::OK;
     }
+    if (!modelManager.customNodeBufferArenaMetricReporter) {
+        modelManager.customNodeBufferArenaMetricReporter = std::make_unique<CustomNodeBufferArenaMetricReporter>(modelManager.metricConfig.get(), modelManager.metricRegistry);
+        CustomNodeBufferArena::instance().setMetricReporter(modelManager.customNodeBufferArenaMetricReporter.get());
+    }
     std::set<std::string> librariesInConfig;
     for (const auto& libraryConfig : doc->value.GetArray()) {
         librariesInConfig.emplace(libraryConfig.FindMember("name")->value.GetString());
@@ -546,11 +550,24 @@ Status ModelManager::loadMediapipeGraphsConfig(std::vector<MediapipeGraphConfig>
         }
         mediapipeFactory->retireOtherThan(std::move(mediapipesInConfigFileNames));
         std::set<std::string> mediapipesAlreadyLoaded;
+        std::vector<const MediapipeGraphConfig*> mediapipesToLoad;
         for (const auto& mediapipeGraphConfig : mediapipesInConfigFile) {
             if (spdlog::default_logger_raw()->level() <= spdlog::level::debug) {
                 mediapipeGraphConfig.logGraphConfigContent();
             }
-            auto status = processMediapipeConfig(mediapipeGraphConfig, mediapipesAlreadyLoaded, *mediapipeFactory);
+            if (mediapipesAlreadyLoaded.find(mediapipeGraphConfig.getGraphName()) != mediapipesAlreadyLoaded.end()) {
+                SPDLOG_LOGGER_WARN(modelmanager_logger, "Duplicated mediapipe names: {} defined in config file. Only first graph will be loaded.", mediapipeGraphConfig.getGraphName());
+                continue;
+            }
+            mediapipesAlreadyLoaded.insert(mediapipeGraphConfig.getGraphName());
+            mediapipesToLoad.push_back(&mediapipeGraphConfig);
+        }
+        // all models, including the ones from graph subconfigs, are already loaded at this point
+        std::vector<Status> loadStatuses(mediapipesToLoad.size());
+        parallelFor(mediapipesToLoad.size(), this->modelLoadWorkers, [this, &mediapipesToLoad, &loadStatuses](size_t i) {
+            loadStatuses[i] = processMediapipeConfig(*mediapipesToLoad[i], *mediapipeFactory);
+        });
+        for (const auto& status : loadStatuses) {
             if (status != StatusCode::OK) {
                 IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
             }
@@ -696,6 +713,8 @@ Status ModelManager::ConfigLoader::loadModels(ModelManager& modelManager, const
     std::vector<MediapipeGraphConfig>& mediapipesInConfigFile) {
 #endif
     Status firstErrorStatus = StatusCode::OK;
+    Status pluginConfigStatus = StatusCode::OK;
+    std::vector<ModelConfig> modelConfigsToLoad;
 
     for (const auto& configs : modelsConfigList->value.GetArray()) {
 #if (MEDIAPIPE_DISABLE == 0)
@@ -735,7 +754,9 @@ Status ModelManager::ConfigLoader::loadModels(ModelManager& modelManager, const
             *modelManager.ieCore.get());
         if (!status.ok()) {
             SPDLOG_LOGGER_ERROR(modelmanager_logger, "Plugin config contains unsupported keys");
-            return status;
+            // models preceding the invalid one are still loaded
+            pluginConfigStatus = status;
+            break;
         }
         modelConfig.setCacheDir(modelManager.modelCacheDirectory);
 
@@ -750,11 +771,21 @@ Status ModelManager::ConfigLoader::loadModels(ModelManager& modelManager, const
             SPDLOG_LOGGER_WARN(modelmanager_logger, "Duplicated model names: {} defined in config file. Only first definition will be loaded.", modelName);
             continue;
         }
+        modelsInConfigFile.emplace(modelName);
+        modelConfigsToLoad.emplace_back(std::move(modelConfig));
+    }
 
-        status = modelManager.reloadModelWithVersions(modelConfig);
-        IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
+    // models do not depend on each other so they can be loaded concurrently
+    std::vector<Status> loadStatuses(modelConfigsToLoad.size());
+    parallelFor(modelConfigsToLoad.size(), modelManager.modelLoadWorkers, [&modelManager, &modelConfigsToLoad, &loadStatuses](size_t i) {
+        loadStatuses[i] = modelManager.reloadModelWithVersions(modelConfigsToLoad[i]);
+    });
 
-        modelsInConfigFile.emplace(modelName);
+    for (size_t i = 0; i < modelConfigsToLoad.size(); ++i) {
+        auto& modelConfig = modelConfigsToLoad[i];
+        const std::string modelName = modelConfig.getName();
+        const auto& status = loadStatuses[i];
+        IF_ERROR_NOT_OCCURRED_EARLIER_THEN_SET_FIRST_ERROR(status);
         if (!status.ok()) {
             SPDLOG_LOGGER_DEBUG(modelmanager_logger, "Cannot reload model: {} with versions due to error: {}", modelName, status.string());
         }
@@ -771,6 +802,9 @@ Status ModelManager::ConfigLoader::loadModels(ModelManager& modelManager, const
             newModelConfigs.emplace(modelName, std::move(modelConfig));
         }
     }
+    if (!pluginConfigStatus.ok()) {
+        return pluginConfigStatus;
+    }
     return firstErrorStatus;
 }
 
@@ -47,6 +47,7 @@ class Config;
 struct CNLIMWrapper;
 struct ModelsSettingsImpl;
 class CustomLoaderConfig;
+class CustomNodeBufferArenaMetricReporter;
 class CustomNodeLibraryManager;
 class MetricConfig;
 class MetricRegistry;
@@ -90,6 +91,7 @@ protected:
     std::unique_ptr<MediapipeFactory> mediapipeFactory;
 #endif
     std::unique_ptr<CustomNodeLibraryManager> customNodeLibraryManager;
+    std::unique_ptr<CustomNodeBufferArenaMetricReporter> customNodeBufferArenaMetricReporter;
     std::vector<std::shared_ptr<CNLIMWrapper>> resources = {};
     uint32_t waitForModelLoadedTimeoutMs;
 
@@ -109,7 +111,7 @@ private:
     Status addModelVersions(std::shared_ptr<ovms::Model>& model, std::shared_ptr<FileSystem>& fs, ModelConfig& config, std::shared_ptr<model_versions_t>& versionsToStart, std::shared_ptr<model_versions_t>& versionsFailed);
 
 #if (MEDIAPIPE_DISABLE == 0)
-    Status processMediapipeConfig(const MediapipeGraphConfig& config, std::set<std::string>& mediapipesInConfigFile, MediapipeFactory& factory);
+    Status processMediapipeConfig(const MediapipeGraphConfig& config, MediapipeFactory& factory);
     Status loadMediapipeGraphsConfig(std::vector<MediapipeGraphConfig>& mediapipesInConfigFile);
     Status loadMediapipeSubConfigModels(std::vector<ModelConfig>& gatedModelConfigs, std::set<std::string>& modelsInConfigFile,
         std::set<std::string>& modelsWithInvalidConfig, std::unordered_map<std::string, ModelConfig>& newModelConfigs, std::vector<MediapipeGraphConfig>& mediapipesInConfigFile);
@@ -206,6 +208,11 @@ protected:
      */
     uint32_t resourcesCleanupIntervalMillisec = 1000;
 
+    /**
+     * Maximum number of models and mediapipe graphs loaded concurrently
+     */
+    uint32_t modelLoadWorkers = 1;
+
 private:
     /**
      * @brief last md5sum of configfile
@@ -69,6 +69,14 @@ const std::string& ModelVersionStatus::getErrorMsg() const {
     return ModelVersionStatusErrorCodeToString(this->errorCode);
 }
 
+uint64_t ModelVersionStatus::getWarmupTimeUs() const {
+    return this->warmupTimeUs;
+}
+
+void ModelVersionStatus::setWarmupTimeUs(uint64_t warmupTimeUs) {
+    this->warmupTimeUs = warmupTimeUs;
+}
+
 bool ModelVersionStatus::willEndUnloaded() const {
     return ovms::ModelVersionState::UNLOADING <= this->state;
 }
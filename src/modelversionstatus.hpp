@@ -15,6 +15,7 @@
 //*****************************************************************************
 #pragma once
 
+#include <cstdint>
 #include <iostream>
 #include <string>
 #include <unordered_map>
@@ -67,6 +68,7 @@ class ModelVersionStatus {
     model_version_t version;
     ModelVersionState state;
     ModelVersionStatusErrorCode errorCode;
+    uint64_t warmupTimeUs = 0;
 
 public:
     ModelVersionStatus() = delete;
@@ -81,6 +83,12 @@ public:
 
     const std::string& getErrorMsg() const;
 
+    /**
+     * @brief Time spent on warm-up inferences during last load, 0 if warm-up was not performed
+     */
+    uint64_t getWarmupTimeUs() const;
+    void setWarmupTimeUs(uint64_t warmupTimeUs);
+
     /**
      * @brief Check if current state is state that is either transforming to END or already in that state.
      *
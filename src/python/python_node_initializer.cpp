@@ -37,7 +37,8 @@ public:
         const std::string& graphName,
         const std::string& basePath,
         GraphSidePackets& sidePackets,
-        PythonBackend* pythonBackend) override {
+        PythonBackend* pythonBackend,
+        MediapipeServableMetricReporter* /*metricReporter*/) override {
         auto& pythonNodeResourcesMap = sidePackets.pythonNodeResourcesMap;
         if (!nodeConfig.node_options().size()) {
             SPDLOG_ERROR("Python node missing options in graph: {}. ", graphName);
@@ -16,8 +16,13 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <future>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
@@ -30,44 +35,223 @@
 
 namespace ovms {
 
+/**
+ * @brief Bounded lock-free multi producer multi consumer ring of stream ids
+ *
+ * Each cell carries a sequence number telling whether it is ready to be written or read
+ * in current lap, so producers and consumers only contend on their own position counter.
+ */
+class IdleStreamsRing {
+public:
+    IdleStreamsRing(size_t minimalCapacity) {
+        size_t capacity = 1;
+        while (capacity < minimalCapacity) {
+            capacity <<= 1;
+        }
+        mask = capacity - 1;
+        cells = std::make_unique<Cell[]>(capacity);
+        for (size_t i = 0; i < capacity; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Puts value into the ring
+     *
+     * Ring is sized for all stream ids so it is never full. Cell may still be
+     * occupied for a moment by consumer which already claimed it but did not finish reading.
+     */
+    void push(int value) {
+        Cell* cell;
+        size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &cells[position & mask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (difference == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                std::this_thread::yield();  // wait for consumer to release the cell
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(position + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Takes value from the ring
+     *
+     * @return false if ring is empty
+     */
+    bool pop(int& value) {
+        Cell* cell;
+        size_t position = dequeuePosition.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &cells[position & mask];
+            const size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+            if (difference == 0) {
+                if (dequeuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;  // empty
+            } else {
+                position = dequeuePosition.load(std::memory_order_relaxed);
+            }
+        }
+        value = cell->value;
+        cell->sequence.store(position + mask + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr size_t CACHE_LINE_SIZE = 64;
+    struct alignas(CACHE_LINE_SIZE) Cell {
+        std::atomic<size_t> sequence{0};
+        int value{-1};
+    };
+    std::unique_ptr<Cell[]> cells;
+    size_t mask;
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> enqueuePosition{0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> dequeuePosition{0};
+};
+
 template <typename T>
 class Queue {
 public:
+    /**
+    * @brief Allocating idle stream for execution, blocks until any stream is idle
+    *
+    * Does not allocate - use it instead of getIdleStream when caller does not need a future.
+    */
+    int acquireIdleStream() {
+        // OVMS_PROFILE_FUNCTION();
+        int value;
+        for (size_t i = 0; i < SPIN_TRIES; ++i) {
+            if (idleStreams.pop(value)) {
+                return value;
+            }
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        waitersCount.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        idleStreamReturned.wait(lk, [this, &value]() { return idleStreams.pop(value); });
+        waitersCount.fetch_sub(1, std::memory_order_relaxed);
+        return value;
+    }
+
+    /**
+    * @brief Allocating idle stream for execution, waiting callers are served in earliest deadline first order
+    *
+    * Callers without deadline should pass time_point::max() to be served after all callers with deadline.
+    *
+    * @return std::nullopt if deadline passed before any stream became idle
+    */
+    std::optional<int> acquireIdleStreamBefore(std::chrono::steady_clock::time_point deadline) {
+        // OVMS_PROFILE_FUNCTION();
+        int value;
+        if (waitersCount.load(std::memory_order_seq_cst) == 0 && idleStreams.pop(value)) {
+            return value;
+        }
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        waitersCount.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (deadlineWaiters.empty() && idleStreams.pop(value)) {
+            waitersCount.fetch_sub(1, std::memory_order_relaxed);
+            return value;
+        }
+        DeadlineWaiter waiter;
+        auto position = deadlineWaiters.emplace(deadline, &waiter);
+        while (waiter.streamId < 0) {
+            if (deadline == std::chrono::steady_clock::time_point::max()) {
+                waiter.streamReady.wait(lk);
+            } else if (waiter.streamReady.wait_until(lk, deadline) == std::cv_status::timeout && waiter.streamId < 0) {
+                deadlineWaiters.erase(position);
+                waitersCount.fetch_sub(1, std::memory_order_relaxed);
+                return std::nullopt;
+            }
+        }
+        // waiter was removed from deadlineWaiters by returnStream
+        return waiter.streamId;
+    }
+
     /**
     * @brief Allocating idle stream for execution
+    *
+    * @param onStreamReady called after returned future becomes ready if no stream was idle at the time of the call
     */
-    std::future<int> getIdleStream() {
+    std::future<int> getIdleStream(std::function<void()> onStreamReady = {}) {
         // OVMS_PROFILE_FUNCTION();
         int value;
         std::promise<int> idleStreamPromise;
         std::future<int> idleStreamFuture = idleStreamPromise.get_future();
-        std::unique_lock<std::mutex> lk(front_mut);
-        if (streams[front_idx] < 0) {  // we need to wait for any idle stream to be returned
-            std::unique_lock<std::mutex> queueLock(queue_mutex);
-            promises.push(std::move(idleStreamPromise));
-        } else {  // we can give idle stream right away
-            value = streams[front_idx];
-            streams[front_idx] = -1;  // negative value indicate consumed vector index
-            front_idx = (front_idx + 1) % streams.size();
+        if (idleStreams.pop(value)) {  // we can give idle stream right away
+            idleStreamPromise.set_value(value);
+            return idleStreamFuture;
+        }
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        waitersCount.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (idleStreams.pop(value)) {  // stream was returned in the meantime
+            waitersCount.fetch_sub(1, std::memory_order_relaxed);
             lk.unlock();
             idleStreamPromise.set_value(value);
+            return idleStreamFuture;
         }
+        // we need to wait for any idle stream to be returned
+        promises.push({std::move(idleStreamPromise), std::move(onStreamReady)});
         return idleStreamFuture;
     }
 
-    std::optional<int> tryToGetIdleStream() {
+    /**
+    * @brief Allocating idle stream for execution without blocking the caller
+    *
+    * Callers with deadline are served in earliest deadline first order together with callers of acquireIdleStreamBefore.
+    * Callers without deadline (time_point::max()) are served in order of arrival together with callers of getIdleStream.
+    * Waiting caller with deadline is dropped when stream is returned after its deadline passed.
+    *
+    * @param onStreamReady called from thread returning stream if no stream was idle at the time of the call,
+    * with std::nullopt if caller was dropped
+    *
+    * @return stream id if stream was idle, onStreamReady is not called then
+    */
+    std::optional<int> acquireIdleStreamOrNotify(std::chrono::steady_clock::time_point deadline, std::function<void(std::optional<int>)> onStreamReady) {
         // OVMS_PROFILE_FUNCTION();
         int value;
-        std::unique_lock<std::mutex> lk(front_mut);
-        if (streams[front_idx] < 0) {  // we need to wait for any idle stream to be returned
+        if (waitersCount.load(std::memory_order_seq_cst) == 0 && idleStreams.pop(value)) {
+            return value;
+        }
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        waitersCount.fetch_add(1, std::memory_order_seq_cst);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (deadlineWaiters.empty() && idleStreams.pop(value)) {
+            waitersCount.fetch_sub(1, std::memory_order_relaxed);
+            return value;
+        }
+        if (deadline == std::chrono::steady_clock::time_point::max()) {
+            promises.push({std::promise<int>(), {}, std::move(onStreamReady)});
             return std::nullopt;
-        } else {  // we can give idle stream right away
-            value = streams[front_idx];
-            streams[front_idx] = -1;  // negative value indicate consumed vector index
-            front_idx = (front_idx + 1) % streams.size();
-            lk.unlock();  // unlock before unique_lock destructor just in case to unlock asap
+        }
+        auto waiter = std::make_unique<DeadlineWaiter>();
+        waiter->onStreamReady = std::move(onStreamReady);
+        deadlineWaiters.emplace(deadline, waiter.release());
+        return std::nullopt;
+    }
+
+    std::optional<int> tryToGetIdleStream() {
+        // OVMS_PROFILE_FUNCTION();
+        int value;
+        if (idleStreams.pop(value)) {
             return value;
         }
+        return std::nullopt;
     }
 
     /**
@@ -75,32 +259,96 @@ public:
     */
     void returnStream(int streamID) {
         // OVMS_PROFILE_FUNCTION();
+        idleStreams.push(streamID);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (waitersCount.load(std::memory_order_seq_cst) == 0) {
+            return;
+        }
         std::unique_lock<std::mutex> lk(queue_mutex);
+        if (!deadlineWaiters.empty()) {
+            int value;
+            if (!idleStreams.pop(value)) {  // already taken by other caller
+                return;
+            }
+            // waiters without blocked caller do not time out on their own
+            std::vector<std::unique_ptr<DeadlineWaiter>> expired;
+            const auto now = std::chrono::steady_clock::now();
+            while (!deadlineWaiters.empty() && deadlineWaiters.begin()->second->onStreamReady && deadlineWaiters.begin()->first < now) {
+                expired.emplace_back(deadlineWaiters.begin()->second);
+                deadlineWaiters.erase(deadlineWaiters.begin());
+                waitersCount.fetch_sub(1, std::memory_order_relaxed);
+            }
+            std::unique_ptr<DeadlineWaiter> notifiedWaiter;
+            const bool served = !deadlineWaiters.empty();
+            if (served) {
+                auto earliest = deadlineWaiters.begin();
+                DeadlineWaiter* waiter = earliest->second;
+                deadlineWaiters.erase(earliest);
+                waitersCount.fetch_sub(1, std::memory_order_relaxed);
+                if (waiter->onStreamReady) {
+                    notifiedWaiter.reset(waiter);
+                } else {
+                    waiter->streamId = value;
+                    // notified under lock since waiter lives on the stack of waiting caller
+                    waiter->streamReady.notify_one();
+                }
+            }
+            lk.unlock();
+            for (auto& dropped : expired) {
+                dropped->onStreamReady(std::nullopt);
+            }
+            if (notifiedWaiter) {
+                notifiedWaiter->onStreamReady(value);
+            } else if (!served) {
+                // all waiters with deadline were dropped, stream is offered to remaining callers
+                returnStream(value);
+            }
+            return;
+        }
         if (promises.size()) {
-            std::promise<int> promise = std::move(promises.front());
+            int value;
+            if (!idleStreams.pop(value)) {  // already taken by other caller
+                return;
+            }
+            StreamPromise promise = std::move(promises.front());
             promises.pop();
+            waitersCount.fetch_sub(1, std::memory_order_relaxed);
             lk.unlock();
-            promise.set_value(streamID);
+            if (promise.onStreamAcquired) {
+                promise.onStreamAcquired(value);
+                return;
+            }
+            promise.streamId.set_value(value);
+            if (promise.onStreamReady) {
+                promise.onStreamReady();
+            }
             return;
         }
-        std::uint32_t old_back = back_idx.load();
-        while (!back_idx.compare_exchange_weak(
-            old_back,
-            (old_back + 1) % streams.size(),
-            std::memory_order_relaxed)) {
-        }
-        streams[old_back] = streamID;
+        lk.unlock();
+        idleStreamReturned.notify_one();
     }
 
     /**
     * @brief Constructor with initialization
     */
     Queue(int streamsLength) :
-        streams(streamsLength),
-        front_idx{0},
-        back_idx{0} {
-        for (int i = 0; i < streamsLength; ++i) {
-            streams[i] = i;
+        Queue(streamsLength, streamsLength) {}
+
+    /**
+    * @brief Constructor with initialization of first idleStreamsCount streams, remaining stream ids are returned later by derived class
+    */
+    Queue(int streamsLength, int idleStreamsCount) :
+        idleStreams(streamsLength) {
+        for (int i = 0; i < idleStreamsCount; ++i) {
+            idleStreams.push(i);
+        }
+    }
+
+    ~Queue() {
+        for (auto& [deadline, waiter] : deadlineWaiters) {
+            if (waiter->onStreamReady) {
+                delete waiter;
+            }
         }
     }
 
@@ -111,31 +359,63 @@ public:
         return inferRequests[streamID];
     }
 
+    /**
+    * @brief Number of streams served by the queue
+    */
+    size_t getStreamsCount() const {
+        return inferRequests.size();
+    }
+
+    /**
+    * @brief Number of callers blocked waiting for idle stream, approximate since it is read without lock
+    */
+    uint32_t getWaitersCount() const {
+        return waitersCount.load(std::memory_order_relaxed);
+    }
+
 protected:
     /**
-    * @brief Vector representing circular buffer for infer queue
+    * @brief Number of tries to get stream without blocking before waiting for returned stream
     */
-    std::vector<int> streams;
+    static constexpr size_t SPIN_TRIES = 8;
 
     /**
-    * @brief Index of the front of the idle streams list
+    * @brief Lock-free circular buffer of idle streams
     */
-    std::uint32_t front_idx;
+    IdleStreamsRing idleStreams;
 
     /**
-    * @brief Index of the back of the idle streams list
+    * @brief Number of callers waiting for idle stream, returning stream skips locking when there are none
     */
-    std::atomic<std::uint32_t> back_idx;
+    std::atomic<uint32_t> waitersCount{0};
 
     /**
-    * @brief Vector representing OV streams and used for notification about completed inference operations
+    * @brief Synchronization of callers waiting for idle stream
     */
-    std::mutex front_mut;
     std::mutex queue_mutex;
+    std::condition_variable idleStreamReturned;
     /**
      * 
      */
     std::vector<T> inferRequests;
-    std::queue<std::promise<int>> promises;
+
+    struct StreamPromise {
+        std::promise<int> streamId;
+        std::function<void()> onStreamReady;
+        // set instead of streamId promise for callers of acquireIdleStreamOrNotify
+        std::function<void(std::optional<int>)> onStreamAcquired;
+    };
+    std::queue<StreamPromise> promises;
+
+    struct DeadlineWaiter {
+        int streamId{-1};
+        std::condition_variable streamReady;
+        // set for callers of acquireIdleStreamOrNotify, such waiters are owned by the queue
+        std::function<void(std::optional<int>)> onStreamReady;
+    };
+    /**
+    * @brief Callers of acquireIdleStreamBefore ordered by deadline, served before other waiting callers
+    */
+    std::multimap<std::chrono::steady_clock::time_point, DeadlineWaiter*> deadlineWaiters;
 };
 }  // namespace ovms
@@ -0,0 +1,191 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Microbenchmark of idle stream acquisition under contention.
+// Compares Queue<T> with previous mutex & promise based implementation.
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <sysexits.h>
+
+#include "queue.hpp"
+
+namespace {
+// Previous Queue<T> implementation kept as a baseline
+class PromiseQueue {
+public:
+    PromiseQueue(int streamsLength) :
+        streams(streamsLength),
+        front_idx{0},
+        back_idx{0} {
+        for (int i = 0; i < streamsLength; ++i) {
+            streams[i] = i;
+        }
+    }
+
+    std::future<int> getIdleStream() {
+        int value;
+        std::promise<int> idleStreamPromise;
+        std::future<int> idleStreamFuture = idleStreamPromise.get_future();
+        std::unique_lock<std::mutex> lk(front_mut);
+        if (streams[front_idx] < 0) {
+            std::unique_lock<std::mutex> queueLock(queue_mutex);
+            promises.push(std::move(idleStreamPromise));
+        } else {
+            value = streams[front_idx];
+            streams[front_idx] = -1;
+            front_idx = (front_idx + 1) % streams.size();
+            lk.unlock();
+            idleStreamPromise.set_value(value);
+        }
+        return idleStreamFuture;
+    }
+
+    void returnStream(int streamID) {
+        std::unique_lock<std::mutex> lk(queue_mutex);
+        if (promises.size()) {
+            std::promise<int> promise = std::move(promises.front());
+            promises.pop();
+            lk.unlock();
+            promise.set_value(streamID);
+            return;
+        }
+        std::uint32_t old_back = back_idx.load();
+        while (!back_idx.compare_exchange_weak(
+            old_back,
+            (old_back + 1) % streams.size(),
+            std::memory_order_relaxed)) {
+        }
+        streams[old_back] = streamID;
+    }
+
+private:
+    std::vector<int> streams;
+    std::uint32_t front_idx;
+    std::atomic<std::uint32_t> back_idx;
+    std::mutex front_mut;
+    std::mutex queue_mutex;
+    std::queue<std::promise<int>> promises;
+};
+
+template <typename Acquire, typename Release>
+double measure(uint32_t threadsCount, uint32_t niter, uint32_t workNs, Acquire acquire, Release release) {
+    std::atomic<bool> start{false};
+    std::vector<std::thread> threads;
+    threads.reserve(threadsCount);
+    for (uint32_t t = 0; t < threadsCount; ++t) {
+        threads.emplace_back([&]() {
+            while (!start.load(std::memory_order_acquire)) {
+                std::this_thread::yield();
+            }
+            for (uint32_t i = 0; i < niter; ++i) {
+                int id = acquire();
+                if (workNs > 0) {
+                    // simulated inference while holding the stream
+                    auto until = std::chrono::steady_clock::now() + std::chrono::nanoseconds(workNs);
+                    while (std::chrono::steady_clock::now() < until) {
+                    }
+                }
+                release(id);
+            }
+        });
+    }
+    auto begin = std::chrono::steady_clock::now();
+    start.store(true, std::memory_order_release);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(end - begin).count();
+    return static_cast<double>(threadsCount) * niter / seconds;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "Idle streams queue microbenchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("nstreams",
+            "number of streams in the queue",
+            cxxopts::value<uint32_t>()->default_value("4"),
+            "NSTREAMS")
+        ("niter",
+            "number of acquire/release pairs per thread",
+            cxxopts::value<uint32_t>()->default_value("20000"),
+            "NITER")
+        ("work_ns",
+            "time in nanoseconds the stream is held after acquire",
+            cxxopts::value<uint32_t>()->default_value("0"),
+            "WORK_NS")
+        ("max_threads",
+            "maximal number of contending threads, measured for each power of 2 starting from 1",
+            cxxopts::value<uint32_t>()->default_value("256"),
+            "MAX_THREADS");
+    // clang-format on
+    uint32_t nstreams, niter, workNs, maxThreads;
+    try {
+        auto result = options.parse(argc, argv);
+        if (result.count("help")) {
+            std::cout << options.help() << std::endl;
+            return EX_OK;
+        }
+        nstreams = result["nstreams"].as<uint32_t>();
+        niter = result["niter"].as<uint32_t>();
+        workNs = result["work_ns"].as<uint32_t>();
+        maxThreads = result["max_threads"].as<uint32_t>();
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (nstreams == 0) {
+        std::cerr << "nstreams has to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+
+    std::cout << "streams: " << nstreams << "; iterations per thread: " << niter << "; work: " << workNs << " ns" << std::endl;
+    std::cout << std::setw(8) << "threads"
+              << std::setw(20) << "promise [ops/s]"
+              << std::setw(20) << "lock-free [ops/s]"
+              << std::setw(12) << "speedup" << std::endl;
+    for (uint32_t threadsCount = 1; threadsCount <= maxThreads; threadsCount *= 2) {
+        PromiseQueue baseline(nstreams);
+        double baselineOps = measure(
+            threadsCount, niter, workNs,
+            [&baseline]() { return baseline.getIdleStream().get(); },
+            [&baseline](int id) { baseline.returnStream(id); });
+        ovms::Queue<int> queue(nstreams);
+        double queueOps = measure(
+            threadsCount, niter, workNs,
+            [&queue]() { return queue.acquireIdleStream(); },
+            [&queue](int id) { queue.returnStream(id); });
+        std::cout << std::setw(8) << threadsCount
+                  << std::setw(20) << std::fixed << std::setprecision(0) << baselineOps
+                  << std::setw(20) << queueOps
+                  << std::setw(12) << std::setprecision(2) << queueOps / baselineOps << std::endl;
+    }
+    return EX_OK;
+}
@@ -39,7 +39,8 @@ public:
         const std::string& graphName,
         const std::string& basePath,
         GraphSidePackets& sidePackets,
-        PythonBackend* /*pythonBackend*/) override {
+        PythonBackend* /*pythonBackend*/,
+        MediapipeServableMetricReporter* /*metricReporter*/) override {
         auto& rerankServableMap = sidePackets.rerankServableMap;
         if (!nodeConfig.node_options().size()) {
             SPDLOG_ERROR("Rerank node missing options in graph: {}. ", graphName);
@@ -15,6 +15,9 @@
 //*****************************************************************************
 #include "rest_parser.hpp"
 
+#include <cstring>
+#include <limits>
+#include <sstream>
 #include <string>
 
 #include "logging.hpp"
@@ -165,6 +168,127 @@ Status KFSRestParser::parseData(rapidjson::Value& node, ::KFSRequest::InferInput
     return StatusCode::OK;
 }
 
+static size_t contentsByteSize(const ::inference::InferTensorContents& contents) {
+    size_t size = contents.bool_contents_size() * sizeof(bool) +
+                  contents.int_contents_size() * sizeof(int32_t) +
+                  contents.int64_contents_size() * sizeof(int64_t) +
+                  contents.uint_contents_size() * sizeof(uint32_t) +
+                  contents.uint64_contents_size() * sizeof(uint64_t) +
+                  contents.fp32_contents_size() * sizeof(float) +
+                  contents.fp64_contents_size() * sizeof(double);
+    for (const auto& bytes : contents.bytes_contents()) {
+        size += bytes.size();
+    }
+    return size;
+}
+
+static size_t countValues(const rapidjson::Value& node) {
+    size_t count = 0;
+    for (auto& value : node.GetArray()) {
+        count += value.IsArray() ? countValues(value) : 1;
+    }
+    return count;
+}
+
+template <typename T, typename Getter>
+static bool writeValues(const rapidjson::Value& node, T*& ptr, Getter getValue) {
+    for (auto& value : node.GetArray()) {
+        if (value.IsArray()) {
+            if (!writeValues<T>(value, ptr, getValue)) {
+                return false;
+            }
+            continue;
+        }
+        if (!getValue(value, *ptr)) {
+            return false;
+        }
+        ++ptr;
+    }
+    return true;
+}
+
+template <typename T, typename Getter>
+static Status decodeValues(const rapidjson::Value& node, size_t valuesCount, std::string& buffer, Getter getValue) {
+    buffer.resize(valuesCount * sizeof(T));
+    T* ptr = reinterpret_cast<T*>(buffer.data());
+    if (!writeValues<T>(node, ptr, getValue)) {
+        return StatusCode::REST_COULD_NOT_PARSE_INPUT;
+    }
+    return StatusCode::OK;
+}
+
+// values outside of range of narrower integer types are truncated the same way as when copied from typed contents fields
+#define DECODE_INT(C_TYPE, TYPE_GETTER, TYPE_CHECK)                                                   \
+    decodeValues<C_TYPE>(node, valuesCount, buffer, [](const rapidjson::Value& value, C_TYPE& out) { \
+        if (!value.TYPE_CHECK()) {                                                                   \
+            return false;                                                                            \
+        }                                                                                            \
+        out = static_cast<C_TYPE>(value.TYPE_GETTER());                                              \
+        return true;                                                                                 \
+    })
+
+Status KFSRestParser::parseRawData(rapidjson::Value& node, const ::KFSRequest::InferInputTensor& input, std::string& buffer) {
+    size_t expectedValuesCount = 1;
+    for (auto dim : input.shape()) {
+        if (dim != 0 && expectedValuesCount > std::numeric_limits<size_t>::max() / static_cast<size_t>(dim)) {
+            return Status(StatusCode::INVALID_CONTENT_SIZE, "Shape dimensions overflow size_t; input name: " + input.name());
+        }
+        expectedValuesCount *= static_cast<size_t>(dim);
+    }
+    size_t valuesCount = countValues(node);
+    if (valuesCount != expectedValuesCount) {
+        std::stringstream ss;
+        ss << "Expected: " << expectedValuesCount << " values; Actual: " << valuesCount << " values; input name: " << input.name();
+        SPDLOG_DEBUG("Invalid value count of tensor - {}", ss.str());
+        return Status(StatusCode::INVALID_VALUE_COUNT, ss.str());
+    }
+    Status status;
+    const auto& datatype = input.datatype();
+    // numbers are already converted by rapidjson while building the document, using its default normal precision
+    // strtod which takes the fast path for up to 15 significant digits, so values are only narrowed here
+    if (datatype == "FP32") {
+        status = decodeValues<float>(node, valuesCount, buffer, [](const rapidjson::Value& value, float& out) {
+            if (!value.IsNumber()) {
+                return false;
+            }
+            out = value.GetFloat();
+            return true;
+        });
+    } else if (datatype == "FP64") {
+        status = decodeValues<double>(node, valuesCount, buffer, [](const rapidjson::Value& value, double& out) {
+            if (!value.IsNumber()) {
+                return false;
+            }
+            out = value.GetDouble();
+            return true;
+        });
+    } else if (datatype == "INT64") {
+        status = DECODE_INT(int64_t, GetInt64, IsInt64);
+    } else if (datatype == "INT32") {
+        status = DECODE_INT(int32_t, GetInt, IsInt);
+    } else if (datatype == "INT16") {
+        status = DECODE_INT(int16_t, GetInt, IsInt);
+    } else if (datatype == "INT8") {
+        status = DECODE_INT(int8_t, GetInt, IsInt);
+    } else if (datatype == "UINT64") {
+        status = DECODE_INT(uint64_t, GetUint64, IsUint64);
+    } else if (datatype == "UINT32") {
+        status = DECODE_INT(uint32_t, GetUint, IsUint);
+    } else if (datatype == "UINT16") {
+        status = DECODE_INT(uint16_t, GetUint, IsUint);
+    } else if (datatype == "UINT8") {
+        status = DECODE_INT(uint8_t, GetUint, IsUint);
+    } else if (datatype == "BOOL") {
+        status = DECODE_INT(bool, GetBool, IsBool);
+    } else {
+        return StatusCode::REST_UNSUPPORTED_PRECISION;
+    }
+    if (status.ok()) {
+        rawInputContentsDecodedBytes += buffer.size();
+    }
+    return status;
+}
+
 static Status binaryDataSizeCanBeCalculated(::KFSRequest::InferInputTensor& input, bool onlyOneInput) {
     if (input.datatype() == "BYTES" && (!onlyOneInput || input.shape_size() != 1 || input.shape()[0] != 1)) {
         SPDLOG_DEBUG("Tensor: {} with datatype BYTES has no binary_data_size parameter and the size of the data cannot be calculated from shape.", input.name());
@@ -173,7 +297,7 @@ static Status binaryDataSizeCanBeCalculated(::KFSRequest::InferInputTensor& inpu
     return StatusCode::OK;
 }
 
-Status KFSRestParser::parseInput(rapidjson::Value& node, bool onlyOneInput) {
+Status KFSRestParser::parseInput(rapidjson::Value& node, bool onlyOneInput, std::string* rawInputContents) {
     if (!node.IsObject()) {
         return StatusCode::REST_COULD_NOT_PARSE_INPUT;
     }
@@ -223,7 +347,14 @@ Status KFSRestParser::parseInput(rapidjson::Value& node, bool onlyOneInput) {
             SPDLOG_DEBUG("{} datatype is supported only when data is located in raw_input_contents", datatypeItr->value.GetString());
             return StatusCode::REST_COULD_NOT_PARSE_INPUT;
         }
-        return parseData(dataItr->value, *input);
+        if (rawInputContents != nullptr) {
+            return parseRawData(dataItr->value, *input, *rawInputContents);
+        }
+        auto status = parseData(dataItr->value, *input);
+        if (status.ok()) {
+            contentsDecodedBytes += contentsByteSize(input->contents());
+        }
+        return status;
     } else {
         auto binary_data_size_parameter = input->parameters().find("binary_data_size");
         if (binary_data_size_parameter != input->parameters().end()) {
@@ -233,6 +364,26 @@ Status KFSRestParser::parseInput(rapidjson::Value& node, bool onlyOneInput) {
     }
 }
 
+// raw_input_contents have to be used for all inputs, BYTES data is kept in typed contents fields
+static bool canDecodeToRawInputContents(rapidjson::Value& inputs) {
+    bool anyInputWithData = false;
+    for (auto& input : inputs.GetArray()) {
+        if (!input.IsObject()) {
+            return false;
+        }
+        auto dataItr = input.FindMember("data");
+        if (dataItr == input.MemberEnd()) {
+            continue;
+        }
+        auto datatypeItr = input.FindMember("datatype");
+        if ((datatypeItr == input.MemberEnd()) || !(datatypeItr->value.IsString()) || std::strcmp(datatypeItr->value.GetString(), "BYTES") == 0) {
+            return false;
+        }
+        anyInputWithData = true;
+    }
+    return anyInputWithData;
+}
+
 Status KFSRestParser::parseInputs(rapidjson::Value& node) {
     if (!node.IsArray()) {
         return StatusCode::REST_COULD_NOT_PARSE_INPUT;
@@ -241,8 +392,11 @@ Status KFSRestParser::parseInputs(rapidjson::Value& node) {
         return StatusCode::REST_NO_INPUTS_FOUND;
     }
     requestProto.mutable_inputs()->Clear();
+    requestProto.mutable_raw_input_contents()->Clear();
+    bool useRawInputContents = decodeDataToRawInputContents && canDecodeToRawInputContents(node);
     for (auto& input : node.GetArray()) {
-        auto status = parseInput(input, (node.GetArray().Size() == 1));
+        std::string* rawInputContents = useRawInputContents ? requestProto.add_raw_input_contents() : nullptr;
+        auto status = parseInput(input, (node.GetArray().Size() == 1), rawInputContents);
         if (!status.ok()) {
             return status;
         }
@@ -31,6 +31,9 @@ class RestParser {};
 
 class KFSRestParser : RestParser {
     ::KFSRequest requestProto;
+    const bool decodeDataToRawInputContents;
+    size_t rawInputContentsDecodedBytes = 0;
+    size_t contentsDecodedBytes = 0;
     Status parseId(rapidjson::Value& node);
     Status parseRequestParameters(rapidjson::Value& node);
     Status parseInputParameters(rapidjson::Value& node, ::KFSRequest::InferInputTensor& input);
@@ -38,12 +41,24 @@ class KFSRestParser : RestParser {
     Status parseOutput(rapidjson::Value& node);
     Status parseOutputs(rapidjson::Value& node);
     Status parseData(rapidjson::Value& node, ::KFSRequest::InferInputTensor& input);
-    Status parseInput(rapidjson::Value& node, bool onlyOneInput);
+    Status parseRawData(rapidjson::Value& node, const ::KFSRequest::InferInputTensor& input, std::string& buffer);
+    Status parseInput(rapidjson::Value& node, bool onlyOneInput, std::string* rawInputContents);
     Status parseInputs(rapidjson::Value& node);
 
 public:
+    /**
+     * @brief Construct KFS REST request parser
+     *
+     * @param decodeDataToRawInputContents when enabled numeric data arrays are decoded directly into raw_input_contents
+     * buffers which are used by ov::Tensor without further copies. Typed contents fields are used when any of inputs
+     * contains BYTES data.
+     */
+    KFSRestParser(bool decodeDataToRawInputContents = false) :
+        decodeDataToRawInputContents(decodeDataToRawInputContents) {}
     Status parse(const char* json);
     ::KFSRequest& getProto() { return requestProto; }
+    size_t getRawInputContentsDecodedBytes() const { return rawInputContentsDecodedBytes; }
+    size_t getContentsDecodedBytes() const { return contentsDecodedBytes; }
 };
 
 }  // namespace ovms
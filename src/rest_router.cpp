@@ -0,0 +1,186 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "rest_router.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace ovms {
+
+RestRouter::RestRouter() :
+    root(std::make_unique<Node>()) {}
+RestRouter::RestRouter(RestRouter&&) = default;
+RestRouter& RestRouter::operator=(RestRouter&&) = default;
+RestRouter::~RestRouter() = default;
+
+void RestRouter::addRoute(std::string_view method, std::string_view pattern, RequestType type, int flags) {
+    if (pattern.empty() || pattern.front() != '/') {
+        throw std::invalid_argument("REST route pattern has to start with /: " + std::string(pattern));
+    }
+    auto getOrCreate = [](std::unique_ptr<Node>& child) -> std::unique_ptr<Node>& {
+        if (!child) {
+            child = std::make_unique<Node>();
+        }
+        return child;
+    };
+    Node* node = root.get();
+    size_t pos = 0;
+    while (pos < pattern.size()) {
+        size_t begin = pos + 1;
+        size_t end = std::min(pattern.find('/', begin), pattern.size());
+        std::string_view segment = pattern.substr(begin, end - begin);
+        if (segment == "{model_name}") {
+            node = getOrCreate(node->modelName).get();
+        } else if (segment == "{model_version}") {
+            node = getOrCreate(node->modelVersion).get();
+        } else if (segment == "{model_name...}" || segment == "{*}") {
+            if (end != pattern.size()) {
+                throw std::invalid_argument("REST route remainder capture has to be last segment: " + std::string(pattern));
+            }
+            node = getOrCreate(segment == "{*}" ? node->anyRemainder : node->modelNameRemainder).get();
+        } else if (segment.empty() || segment.front() == '{') {
+            throw std::invalid_argument("Invalid REST route pattern: " + std::string(pattern));
+        } else {
+            auto it = node->literals.find(segment);
+            if (it == node->literals.end()) {
+                it = node->literals.emplace(std::string(segment), std::make_unique<Node>()).first;
+            }
+            node = it->second.get();
+        }
+        pos = end;
+    }
+    node->routes.push_back(Route{std::string(method), type, flags});
+}
+
+const RestRouter::Route* RestRouter::findRouteForMethod(const Node& node, std::string_view method, int requiredFlags, bool& methodNotAllowed) {
+    for (const auto& route : node.routes) {
+        if ((route.flags & requiredFlags) != requiredFlags) {
+            continue;
+        }
+        if (route.method == method) {
+            return &route;
+        }
+        methodNotAllowed = true;
+    }
+    return nullptr;
+}
+
+// pos points to '/' preceding next segment or to the end of the path
+const RestRouter::Route* RestRouter::findRoute(const Node& node, std::string_view method, std::string_view path, size_t pos, int requiredFlags, RestRouteMatch& match, bool& methodNotAllowed) const {
+    if (pos == path.size()) {
+        return findRouteForMethod(node, method, requiredFlags, methodNotAllowed);
+    }
+    if (pos + 1 == path.size()) {
+        auto route = findRouteForMethod(node, method, requiredFlags | ALLOW_TRAILING_SLASH, methodNotAllowed);
+        if (route) {
+            return route;
+        }
+    }
+    size_t begin = pos + 1;
+    size_t end = std::min(path.find('/', begin), path.size());
+    std::string_view segment = path.substr(begin, end - begin);
+    if (!segment.empty()) {
+        auto it = node.literals.find(segment);
+        if (it != node.literals.end()) {
+            auto route = findRoute(*it->second, method, path, end, requiredFlags, match, methodNotAllowed);
+            if (route) {
+                return route;
+            }
+        }
+        if (node.modelName) {
+            auto previous = match.modelName;
+            match.modelName = segment;
+            auto route = findRoute(*node.modelName, method, path, end, requiredFlags, match, methodNotAllowed);
+            if (route) {
+                return route;
+            }
+            match.modelName = previous;
+        }
+        if (node.modelVersion && std::all_of(segment.begin(), segment.end(), [](unsigned char c) { return std::isdigit(c); })) {
+            auto previous = match.modelVersion;
+            match.modelVersion = segment;
+            auto route = findRoute(*node.modelVersion, method, path, end, requiredFlags, match, methodNotAllowed);
+            if (route) {
+                return route;
+            }
+            match.modelVersion = previous;
+        }
+        if (node.modelNameRemainder) {
+            auto route = findRouteForMethod(*node.modelNameRemainder, method, requiredFlags, methodNotAllowed);
+            if (route) {
+                match.modelName = path.substr(begin);
+                return route;
+            }
+        }
+    }
+    if (node.anyRemainder && !methodNotAllowed) {
+        bool ignored = false;
+        return findRouteForMethod(*node.anyRemainder, method, requiredFlags, ignored);
+    }
+    return nullptr;
+}
+
+RestRouteLookup RestRouter::match(std::string_view method, std::string_view path, RestRouteMatch& match) const {
+    match = RestRouteMatch{};
+    if (path.empty() || path.front() != '/') {
+        return RestRouteLookup::NOT_FOUND;
+    }
+    bool methodNotAllowed = false;
+    auto route = findRoute(*root, method, path, 0, 0, match, methodNotAllowed);
+    auto queryPos = path.find('?');
+    if (!route && !methodNotAllowed && queryPos != std::string_view::npos) {
+        match = RestRouteMatch{};
+        route = findRoute(*root, method, path.substr(0, queryPos), 0, ALLOW_QUERY, match, methodNotAllowed);
+        match.query = path.substr(queryPos + 1);
+    }
+    if (route) {
+        match.type = route->type;
+        return RestRouteLookup::FOUND;
+    }
+    return methodNotAllowed ? RestRouteLookup::METHOD_NOT_ALLOWED : RestRouteLookup::NOT_FOUND;
+}
+
+RestRouter createRestApiRouter() {
+    RestRouter router;
+    router.addRoute("POST", "/v1/config/reload", ConfigReload);
+    router.addRoute("GET", "/v1/config", ConfigStatus);
+
+    router.addRoute("GET", "/v2", KFS_GetServerMetadata);
+    router.addRoute("GET", "/v2/health/live", KFS_GetServerLive);
+    router.addRoute("GET", "/v2/health/ready", KFS_GetServerReady);
+    router.addRoute("GET", "/v2/models/{model_name}", KFS_GetModelMetadata, RestRouter::ALLOW_TRAILING_SLASH);
+    router.addRoute("GET", "/v2/models/{model_name}/versions/{model_version}", KFS_GetModelMetadata, RestRouter::ALLOW_TRAILING_SLASH);
+    router.addRoute("GET", "/v2/models/{model_name}/ready", KFS_GetModelReady);
+    router.addRoute("GET", "/v2/models/{model_name}/versions/{model_version}/ready", KFS_GetModelReady);
+    router.addRoute("POST", "/v2/models/{model_name}/infer", KFS_Infer);
+    router.addRoute("POST", "/v2/models/{model_name}/versions/{model_version}/infer", KFS_Infer);
+
+    router.addRoute("GET", "/metrics", Metrics, RestRouter::ALLOW_QUERY);
+    router.addRoute("GET", "/v1/pipelines/{model_name}/profile", PipelineProfile);
+
+    for (const char* prefix : {"/v3", "/v3/v1", "/v1"}) {
+        router.addRoute("GET", std::string(prefix) + "/models", V3_ListModels);
+        router.addRoute("GET", std::string(prefix) + "/models/{model_name...}", V3_RetrieveModel);
+    }
+    router.addRoute("POST", "/v3/{*}", V3);
+    router.addRoute("POST", "/v1/{*}", V3);
+    return router;
+}
+
+}  // namespace ovms
@@ -0,0 +1,106 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ovms {
+
+// note since removal of TFS, V3 endpoints (from OpenAI) are will be also accepted as V1
+enum RequestType { ConfigReload,
+    ConfigStatus,
+    KFS_GetModelReady,
+    KFS_Infer,
+    KFS_GetModelMetadata,
+    KFS_GetServerReady,
+    KFS_GetServerLive,
+    KFS_GetServerMetadata,
+    V3_ListModels,
+    V3_RetrieveModel,
+    V3,
+    Metrics,
+    PipelineProfile,
+    Options };
+
+struct RestRouteMatch {
+    RequestType type;
+    std::string_view modelName;
+    std::string_view modelVersion;
+    std::string_view query;
+};
+
+enum class RestRouteLookup {
+    FOUND,
+    METHOD_NOT_ALLOWED,
+    NOT_FOUND
+};
+
+/**
+ * @brief Resolves REST API path into request type and path parameters in single walk over path segments.
+ *
+ * Route pattern consists of segments:
+ * - literal, e.g. "health",
+ * - {model_name} - any non empty segment,
+ * - {model_version} - non empty segment of digits,
+ * - {model_name...} - non empty remainder of the path, may contain slashes,
+ * - {*} - any remainder of the path, used for prefix routes.
+ * Literal segments take precedence over parameters and parameters over remainder captures.
+ * Prefix routes are used only when no other route matches the path regardless of HTTP method.
+ */
+class RestRouter {
+public:
+    static const int ALLOW_TRAILING_SLASH = 1 << 0;
+    static const int ALLOW_QUERY = 1 << 1;
+
+    RestRouter();
+    RestRouter(RestRouter&&);
+    RestRouter& operator=(RestRouter&&);
+    ~RestRouter();
+
+    void addRoute(std::string_view method, std::string_view pattern, RequestType type, int flags = 0);
+    RestRouteLookup match(std::string_view method, std::string_view path, RestRouteMatch& match) const;
+
+private:
+    struct Route {
+        std::string method;
+        RequestType type;
+        int flags;
+    };
+    struct Node {
+        std::map<std::string, std::unique_ptr<Node>, std::less<>> literals;
+        std::unique_ptr<Node> modelName;
+        std::unique_ptr<Node> modelVersion;
+        std::unique_ptr<Node> modelNameRemainder;
+        std::unique_ptr<Node> anyRemainder;
+        std::vector<Route> routes;
+    };
+    std::unique_ptr<Node> root;
+
+    const Route* findRoute(const Node& node, std::string_view method, std::string_view path, size_t pos, int requiredFlags, RestRouteMatch& match, bool& methodNotAllowed) const;
+    static const Route* findRouteForMethod(const Node& node, std::string_view method, int requiredFlags, bool& methodNotAllowed);
+};
+
+/**
+ * @brief Creates router with all endpoints served by HttpRestApiHandler.
+ */
+RestRouter createRestApiRouter();
+
+}  // namespace ovms
@@ -0,0 +1,171 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+// Microbenchmark of REST API path classification.
+// Compares RestRouter with previous sequential std::regex matching.
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cxxopts.hpp>
+#include <sysexits.h>
+
+#include "rest_router.hpp"
+
+namespace {
+// Previous HttpRestApiHandler path matching kept as a baseline
+class RegexRouter {
+    const std::regex configReloadRegex{R"((.?)\/v1\/config\/reload)"};
+    const std::regex configStatusRegex{R"((.?)\/v1\/config)"};
+    const std::regex kfs_modelreadyRegex{R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/(ready)))"};
+    const std::regex kfs_modelmetadataRegex{R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/)?)"};
+    const std::regex kfs_inferRegex{R"(/v2/models/([^/]+)(?:/versions/([0-9]+))?(?:/(infer)))"};
+    const std::regex kfs_serverreadyRegex{R"(/v2/health/ready)"};
+    const std::regex kfs_serverliveRegex{R"(/v2/health/live)"};
+    const std::regex kfs_servermetadataRegex{R"(/v2)"};
+    const std::regex v3_ListModelsRegex{R"((?:/v3/(v1/)?|/v1/)models)"};
+    const std::regex v3_RetrieveModelRegex{R"((?:/v3/(v1/)?|/v1/)models/(.+))"};
+    const std::regex v3_Regex{R"((?:/v3/|/v1/).*?(/|$))"};
+    const std::regex metricsRegex{R"((.?)\/metrics(\?(.*))?)"};
+    const std::regex pipelineProfileRegex{R"(/v1/pipelines/([^/]+)/profile)"};
+
+public:
+    bool match(const std::string& method, const std::string& path, std::string& modelName) const {
+        std::smatch sm;
+        if (method == "POST") {
+            if (std::regex_match(path, sm, kfs_inferRegex, std::regex_constants::match_any)) {
+                modelName = sm[1];
+                return true;
+            }
+            return std::regex_match(path, sm, configReloadRegex) ||
+                   std::regex_match(path, sm, v3_Regex);
+        }
+        for (const auto* regex : {&configStatusRegex, &kfs_serverliveRegex, &kfs_serverreadyRegex, &kfs_servermetadataRegex}) {
+            if (std::regex_match(path, sm, *regex)) {
+                return true;
+            }
+        }
+        for (const auto* regex : {&kfs_modelmetadataRegex, &kfs_modelreadyRegex}) {
+            if (std::regex_match(path, sm, *regex)) {
+                modelName = sm[1];
+                return true;
+            }
+        }
+        if (std::regex_match(path, sm, metricsRegex)) {
+            return true;
+        }
+        if (std::regex_match(path, sm, pipelineProfileRegex)) {
+            modelName = sm[1];
+            return true;
+        }
+        if (std::regex_match(path, sm, v3_ListModelsRegex)) {
+            return true;
+        }
+        if (std::regex_match(path, sm, v3_RetrieveModelRegex)) {
+            modelName = sm[2];
+            return true;
+        }
+        return false;
+    }
+};
+
+const std::vector<std::pair<std::string, std::string>> REQUESTS = {
+    {"POST", "/v1/config/reload"},
+    {"GET", "/v1/config"},
+    {"GET", "/v2"},
+    {"GET", "/v2/health/live"},
+    {"GET", "/v2/health/ready"},
+    {"GET", "/v2/models/resnet"},
+    {"GET", "/v2/models/resnet/versions/1"},
+    {"GET", "/v2/models/resnet/ready"},
+    {"GET", "/v2/models/resnet/versions/1/ready"},
+    {"POST", "/v2/models/resnet/infer"},
+    {"POST", "/v2/models/resnet/versions/1/infer"},
+    {"GET", "/metrics"},
+    {"GET", "/v1/pipelines/my_pipeline/profile"},
+    {"GET", "/v3/models"},
+    {"GET", "/v3/models/meta-llama/Llama-3.1-8B-Instruct"},
+    {"POST", "/v3/chat/completions"},
+    {"POST", "/v1/embeddings"},
+    {"GET", "/invalid/path"},
+};
+
+template <typename Match>
+double measure(uint32_t niter, const std::string& method, const std::string& path, Match match) {
+    auto begin = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < niter; ++i) {
+        match(method, path);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - begin).count() / niter;
+}
+}  // namespace
+
+int main(int argc, char** argv) {
+    cxxopts::Options options(argv[0], "REST API path routing microbenchmark");
+    // clang-format off
+    options.add_options()
+        ("h, help",
+            "Show this help message and exit")
+        ("niter",
+            "number of lookups per route",
+            cxxopts::value<uint32_t>()->default_value("100000"),
+            "NITER");
+    // clang-format on
+    uint32_t niter;
+    try {
+        auto result = options.parse(argc, argv);
+        if (result.count("help")) {
+            std::cout << options.help() << std::endl;
+            return EX_OK;
+        }
+        niter = result["niter"].as<uint32_t>();
+    } catch (const std::exception& e) {
+        std::cerr << "error parsing options: " << e.what() << std::endl;
+        return EX_USAGE;
+    }
+    if (niter == 0) {
+        std::cerr << "niter has to be greater than 0" << std::endl;
+        return EX_USAGE;
+    }
+
+    RegexRouter baseline;
+    ovms::RestRouter router = ovms::createRestApiRouter();
+    std::cout << "lookups per route: " << niter << std::endl;
+    std::cout << std::left << std::setw(48) << "route"
+              << std::right << std::setw(16) << "regex [ns]"
+              << std::setw(16) << "trie [ns]"
+              << std::setw(12) << "speedup" << std::endl;
+    for (const auto& [method, path] : REQUESTS) {
+        double baselineNs = measure(niter, method, path, [&baseline](const std::string& method, const std::string& path) {
+            std::string modelName;
+            return baseline.match(method, path, modelName);
+        });
+        double routerNs = measure(niter, method, path, [&router](const std::string& method, const std::string& path) {
+            ovms::RestRouteMatch match;
+            return router.match(method, path, match);
+        });
+        std::cout << std::left << std::setw(48) << (method + " " + path)
+                  << std::right << std::setw(16) << std::fixed << std::setprecision(1) << baselineNs
+                  << std::setw(16) << routerNs
+                  << std::setw(12) << std::setprecision(2) << baselineNs / routerNs << std::endl;
+    }
+    return EX_OK;
+}
@@ -160,7 +160,10 @@ const std::string DAG_DEFINITIONS = R"(
 			"type": "integer",
 			"minimum": -1,
 			"maximum": 10000
-        }
+        },
+				"fuse_nodes": {
+					"type": "boolean"
+				}
 			},
 			"additionalProperties": false
 		},
@@ -218,6 +221,47 @@ const std::string MODEL_CONFIG_DEFINITION = R"(
 					"type": "integer",
 					"minimum": 0
 				},
+				"max_batch_size": {
+					"type": "integer",
+					"minimum": 0,
+					"maximum": 100000
+				},
+				"max_queue_delay_us": {
+					"type": "integer",
+					"minimum": 0,
+					"maximum": 10000000
+				},
+				"dispatch_policy": {
+					"type": "string",
+					"enum": ["fifo", "edf"]
+				},
+				"max_pending_requests": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"max_queue_wait_ms": {
+					"type": "integer",
+					"minimum": 0
+				},
+				"shape_variants_cache_size": {
+					"type": "integer",
+					"minimum": 0,
+					"maximum": 1000
+				},
+				"warmup": {
+					"type": "object",
+					"properties": {
+						"iterations": {
+							"type": "integer",
+							"minimum": 0,
+							"maximum": 1000
+						},
+						"data_path": {
+							"type": "string"
+						}
+					},
+					"additionalProperties": false
+				},
 				"target_device": {
 					"type": "string"
 				},
@@ -357,6 +401,17 @@ const std::string MODELS_CONFIG_SCHEMA = R"({
              },
              "subconfig": {
                  "type": "string"
+             },
+             "max_pending_requests": {
+                 "type": "integer",
+                 "minimum": 0
+             },
+             "max_queue_wait_ms": {
+                 "type": "integer",
+                 "minimum": 0
+             },
+             "calculator_metrics": {
+                 "type": "boolean"
              }
         },
         "additionalProperties": false
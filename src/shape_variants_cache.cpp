@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "shape_variants_cache.hpp"
+
+#include <sstream>
+
+namespace ovms {
+
+std::string ShapeVariantsCache::createKey(std::optional<size_t> batchSize, const std::map<std::string, shape_t>& shapes) {
+    std::stringstream ss;
+    if (batchSize.has_value()) {
+        ss << "batch:" << batchSize.value() << ";";
+    }
+    for (const auto& [name, shape] : shapes) {
+        ss << name << ":" << shapeToString(shape) << ";";
+    }
+    return ss.str();
+}
+
+std::shared_ptr<ModelShapeVariant> ShapeVariantsCache::take(const std::string& key) {
+    for (auto it = variants.begin(); it != variants.end(); ++it) {
+        if (it->first == key) {
+            auto variant = std::move(it->second);
+            variants.erase(it);
+            return variant;
+        }
+    }
+    return nullptr;
+}
+
+void ShapeVariantsCache::put(const std::string& key, std::shared_ptr<ModelShapeVariant> variant) {
+    if (capacity == 0) {
+        return;
+    }
+    take(key);
+    variants.emplace_front(key, std::move(variant));
+    evict();
+}
+
+void ShapeVariantsCache::setCapacity(size_t capacity) {
+    this->capacity = capacity;
+    evict();
+}
+
+bool ShapeVariantsCache::contains(const std::string& key) const {
+    for (const auto& [variantKey, _] : variants) {
+        if (variantKey == key) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void ShapeVariantsCache::evict() {
+    while (variants.size() > capacity) {
+        variants.pop_back();
+    }
+}
+}  // namespace ovms
@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "ovinferrequestsqueue.hpp"
+#include "shape.hpp"
+#include "tensorinfo.hpp"
+
+namespace ov {
+namespace intel_gpu {
+namespace ocl {
+class ClContext;
+class VAContext;
+}  // namespace ocl
+}  // namespace intel_gpu
+}  // namespace ov
+
+namespace ovms {
+class IOVTensorFactory;
+
+/**
+ * @brief Compiled model together with all the state that depends on its input shapes
+ *
+ * Shared by model instance with in-flight requests, which finish on the variant
+ * they started with when model instance swaps to other cached variant.
+ */
+struct ModelShapeVariant {
+    std::shared_ptr<ov::CompiledModel> compiledModel;
+    std::unique_ptr<OVInferRequestsQueue> inferRequestsQueue;
+    tensor_map_t inputsInfo;
+    tensor_map_t outputsInfo;
+    bool supportOutputTensorsReset = true;
+    // remote contexts of compiled model, referenced by its tensor factories
+    std::shared_ptr<ov::intel_gpu::ocl::ClContext> oclContext;
+    std::shared_ptr<ov::intel_gpu::ocl::VAContext> vaContext;
+    std::unordered_map<int, std::shared_ptr<IOVTensorFactory>> tensorFactories;
+};
+
+/**
+ * @brief LRU of compiled model variants keyed by requested batch size or input shapes.
+ *
+ * Used for models with batch size or shape set to auto, so that switching back
+ * to previously requested shape does not recompile the model.
+ * Not thread safe, access is guarded by model instance loading lock.
+ */
+class ShapeVariantsCache {
+public:
+    ShapeVariantsCache(size_t capacity = 0) :
+        capacity(capacity) {}
+
+    static std::string createKey(std::optional<size_t> batchSize, const std::map<std::string, shape_t>& shapes);
+
+    /**
+     * @brief Removes variant from the cache and returns it, nullptr if not cached
+     */
+    std::shared_ptr<ModelShapeVariant> take(const std::string& key);
+
+    /**
+     * @brief Inserts variant as the most recently used one, evicts least recently used variants over capacity
+     */
+    void put(const std::string& key, std::shared_ptr<ModelShapeVariant> variant);
+
+    void setCapacity(size_t capacity);
+    size_t getCapacity() const { return capacity; }
+    size_t size() const { return variants.size(); }
+    bool contains(const std::string& key) const;
+    void clear() { variants.clear(); }
+
+private:
+    void evict();
+
+    size_t capacity;
+    // most recently used variant is at front
+    std::list<std::pair<std::string, std::shared_ptr<ModelShapeVariant>>> variants;
+};
+}  // namespace ovms
@@ -184,6 +184,7 @@ const std::unordered_map<StatusCode, std::string> Status::statusMessageMap = {
     {StatusCode::PIPELINE_NOT_ENOUGH_SHAPE_DIMENSIONS_TO_DEMULTIPLY, "Pipeline has not enough shape dimensions to demultiply"},
     {StatusCode::PIPELINE_TOO_LARGE_DIMENSION_SIZE_TO_DEMULTIPLY, "Too large dynamic demultiplication requested."},
     {StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_GATHER_NODES_ORDER, "Demultiplexer and gather nodes are not in LIFO order"},
+    {StatusCode::PIPELINE_TOO_MANY_DEMULTIPLEXING_LEVELS, "Too many nested demultiplexing levels in pipeline"},
     {StatusCode::PIPELINE_DEMULTIPLEXER_NO_RESULTS, "Pipeline execution aborted due to no content from custom node"},
     {StatusCode::PIPELINE_INPUTS_AMBIGUOUS_METADATA, "Multiple nodes connected to the same pipeline input require different tensor metadata"},
     {StatusCode::PIPELINE_STRING_DEMUILTIPLICATION_UNSUPPORTED, "Demultiplication is not supported for string precision"},
@@ -346,5 +347,8 @@ const std::unordered_map<StatusCode, std::string> Status::statusMessageMap = {
     {StatusCode::DEVICE_WRONG_FORMAT, "Device is in wrong format"},
     {StatusCode::SHAPE_DYNAMIC_BUT_NPU_USED, "Shape is dynamic but NPU is used"},
     {StatusCode::STATIC_RESOLUTION_MISUSE, "Wrong usage of static resolution"},
+
+    {StatusCode::INFERENCE_DEADLINE_EXCEEDED, "Request deadline exceeded before inference could be started"},
+    {StatusCode::SERVABLE_OVERLOADED, "Servable is overloaded, request rejected"},
 };
 }  // namespace ovms
@@ -230,6 +230,7 @@ enum class StatusCode {
     PIPELINE_NOT_ENOUGH_SHAPE_DIMENSIONS_TO_DEMULTIPLY,
     PIPELINE_TOO_LARGE_DIMENSION_SIZE_TO_DEMULTIPLY,
     PIPELINE_WRONG_DEMULTIPLEXER_GATHER_NODES_ORDER,
+    PIPELINE_TOO_MANY_DEMULTIPLEXING_LEVELS,
     PIPELINE_DEMULTIPLEXER_NO_RESULTS,
     PIPELINE_INPUTS_AMBIGUOUS_METADATA,
     PIPELINE_STRING_DEMUILTIPLICATION_UNSUPPORTED,
@@ -359,6 +360,9 @@ enum class StatusCode {
     SHAPE_DYNAMIC_BUT_NPU_USED,
     STATIC_RESOLUTION_MISUSE,
 
+    INFERENCE_DEADLINE_EXCEEDED, /*!< Request deadline passed before inference could be started */
+    SERVABLE_OVERLOADED,         /*!< Request rejected since servable pending requests or wait time limit is exceeded */
+
     STATUS_CODE_END
 };
 
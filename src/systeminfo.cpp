@@ -23,6 +23,8 @@
 #include <sstream>
 #include <string>
 #include <thread>
+#include <utility>
+#include <vector>
 
 #ifdef __linux__
 #include <sched.h>
@@ -200,6 +202,82 @@ uint16_t getPhysicalCoresPerSocket() {
     return static_cast<uint16_t>(uniqueCores.size());
 }
 
+bool parseCpuList(const std::string& cpuList, std::vector<uint16_t>& cpus) {
+    cpus.clear();
+    std::istringstream iss(cpuList);
+    std::string range;
+    while (std::getline(iss, range, ',')) {
+        range.erase(range.find_last_not_of(" \n\r\t") + 1);
+        if (range.empty()) {
+            continue;
+        }
+        try {
+            size_t parsed = 0;
+            const auto dash = range.find('-');
+            const unsigned long first = std::stoul(range.substr(0, dash), &parsed);
+            if (parsed != range.substr(0, dash).size()) {
+                return false;
+            }
+            unsigned long last = first;
+            if (dash != std::string::npos) {
+                last = std::stoul(range.substr(dash + 1), &parsed);
+                if (parsed != range.size() - dash - 1) {
+                    return false;
+                }
+            }
+            if (first > last || last >= CPU_SETSIZE) {
+                return false;
+            }
+            for (unsigned long cpu = first; cpu <= last; ++cpu) {
+                cpus.push_back(static_cast<uint16_t>(cpu));
+            }
+        } catch (const std::exception&) {
+            return false;
+        }
+    }
+    return true;
+}
+
+std::vector<std::vector<uint16_t>> getNumaNodesCpus() {
+    std::vector<std::vector<uint16_t>> nodesCpus;
+    std::ifstream onlineFile("/sys/devices/system/node/online");
+    std::string line;
+    std::vector<uint16_t> nodes;
+    if (!onlineFile.is_open() || !std::getline(onlineFile, line) || !parseCpuList(line, nodes)) {
+        return nodesCpus;
+    }
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    const bool hasMask = sched_getaffinity(0, sizeof(mask), &mask) == 0;
+    for (const uint16_t node : nodes) {
+        std::ifstream cpuListFile("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+        std::vector<uint16_t> cpus;
+        if (!cpuListFile.is_open() || !std::getline(cpuListFile, line) || !parseCpuList(line, cpus)) {
+            return {};
+        }
+        if (hasMask) {
+            cpus.erase(std::remove_if(cpus.begin(), cpus.end(), [&mask](uint16_t cpu) { return !CPU_ISSET(cpu, &mask); }), cpus.end());
+        }
+        // memory only nodes and nodes excluded by affinity mask cannot run replicas
+        if (!cpus.empty()) {
+            nodesCpus.push_back(std::move(cpus));
+        }
+    }
+    return nodesCpus;
+}
+
+bool setCurrentThreadCpus(const std::vector<uint16_t>& cpus) {
+    cpu_set_t mask;
+    CPU_ZERO(&mask);
+    for (const uint16_t cpu : cpus) {
+        if (cpu >= CPU_SETSIZE) {
+            return false;
+        }
+        CPU_SET(cpu, &mask);
+    }
+    return sched_setaffinity(0, sizeof(mask), &mask) == 0;
+}
+
 #endif  // __linux__
 
 }  // namespace ovms
@@ -16,6 +16,9 @@
 #pragma once
 #include <stdint.h>
 
+#include <string>
+#include <vector>
+
 namespace ovms {
 /**
  * @brief Get cpu core count on system. This can be limited by the container environment. In case of failure reading system constraints it will return total number of available cores. If it won't work the function will return 1
@@ -47,5 +50,23 @@ uint16_t getPhysicalCoresPerSocket();
  */
 uint16_t getSocketsCount();
 
+/**
+ * @brief Parse CPU list in kernel format, e.g. "0-27,56-83"
+ * @return bool False if the list is malformed
+ */
+bool parseCpuList(const std::string& cpuList, std::vector<uint16_t>& cpus);
+
+/**
+ * @brief Get CPUs of each online NUMA node, limited to CPUs in the affinity mask of the process
+ * @return std::vector<std::vector<uint16_t>> CPUs of nodes having any available CPU, or empty vector if NUMA topology cannot be read
+ */
+std::vector<std::vector<uint16_t>> getNumaNodesCpus();
+
+/**
+ * @brief Restrict current thread to run only on given CPUs
+ * @return bool False if the affinity could not be set
+ */
+bool setCurrentThreadCpus(const std::vector<uint16_t>& cpus);
+
 #endif
 }  // namespace ovms
@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <gtest/gtest.h>
+
+#include "../admission_controller.hpp"
+#include "../queue.hpp"
+#include "../status.hpp"
+
+using namespace ovms;
+
+TEST(AdmissionController, DisabledByDefault) {
+    AdmissionController controller;
+    EXPECT_FALSE(controller.isEnabled());
+    controller.recordServiceTime(1'000'000);
+    EXPECT_EQ(controller.admit(1000, 1), StatusCode::OK);
+}
+
+TEST(AdmissionController, RejectsOverPendingRequestsLimit) {
+    AdmissionController controller(2, 0);
+    EXPECT_TRUE(controller.isEnabled());
+    EXPECT_EQ(controller.admit(0, 4), StatusCode::OK);
+    EXPECT_EQ(controller.admit(1, 4), StatusCode::OK);
+    EXPECT_EQ(controller.admit(2, 4), StatusCode::SERVABLE_OVERLOADED);
+    controller.setLimits(0, 0);
+    EXPECT_FALSE(controller.isEnabled());
+    EXPECT_EQ(controller.admit(2, 4), StatusCode::OK);
+}
+
+TEST(AdmissionController, RejectsOverEstimatedWaitLimit) {
+    AdmissionController controller(0, 10);
+    // no samples yet, nothing to base the estimate on
+    EXPECT_EQ(controller.admit(100, 1), StatusCode::OK);
+    controller.recordServiceTime(4'000);
+    // 2 waiting requests served by 1 stream, 4 ms each
+    EXPECT_EQ(controller.getEstimatedWaitUs(2, 1), 8'000);
+    EXPECT_EQ(controller.admit(2, 1), StatusCode::OK);
+    EXPECT_EQ(controller.admit(3, 1), StatusCode::SERVABLE_OVERLOADED);
+    // more streams drain the queue faster
+    EXPECT_EQ(controller.admit(3, 2), StatusCode::OK);
+}
+
+TEST(AdmissionController, ServiceTimeIsSmoothed) {
+    AdmissionController controller(0, 10);
+    controller.recordServiceTime(8'000);
+    controller.recordServiceTime(16'000);
+    EXPECT_EQ(controller.getEstimatedWaitUs(1, 1), 9'000);
+    for (int i = 0; i < 100; ++i) {
+        controller.recordServiceTime(1'000);
+    }
+    // integer arithmetic may stop short of the sample by less than smoothing factor
+    EXPECT_NEAR(controller.getEstimatedWaitUs(1, 1), 1'000, 8);
+}
+
+TEST(AdmissionController, QueueReportsWaitingCallers) {
+    Queue<int> queue(1);
+    EXPECT_EQ(queue.getWaitersCount(), 0);
+    const int streamId = queue.acquireIdleStream();
+    auto future = queue.getIdleStream();
+    EXPECT_EQ(queue.getWaitersCount(), 1);
+    queue.returnStream(streamId);
+    EXPECT_EQ(future.get(), streamId);
+    EXPECT_EQ(queue.getWaitersCount(), 0);
+}
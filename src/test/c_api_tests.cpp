@@ -1982,7 +1982,7 @@ public:
         return ovms::StatusCode::OK;
     }
     void setOutputsInfo(const tensor_map_t& outputsInfo) {
-        this->outputsInfo = outputsInfo;
+        this->activeShapeVariant->outputsInfo = outputsInfo;
     }
 };
 
@@ -0,0 +1,79 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <gtest/gtest.h>
+
+#include "../mediapipe_internal/calculator_profile_reporter.hpp"
+
+using ovms::CalculatorProfileReporter;
+
+TEST(CalculatorProfileReporter, FirstReportObservesAverages) {
+    CalculatorProfileReporter reporter;
+    auto averages = reporter.update("calc", {100, 2, 60, 3});
+    ASSERT_TRUE(averages.processTimeUs.has_value());
+    EXPECT_EQ(averages.processTimeUs.value(), 50);
+    ASSERT_TRUE(averages.inputWaitTimeUs.has_value());
+    EXPECT_EQ(averages.inputWaitTimeUs.value(), 20);
+}
+
+TEST(CalculatorProfileReporter, ReusedGraphObservesOnlyDelta) {
+    CalculatorProfileReporter reporter;
+    reporter.update("calc", {100, 2, 60, 3});
+    // profiler of pooled graph keeps totals of previous executions
+    auto averages = reporter.update("calc", {400, 4, 100, 5});
+    ASSERT_TRUE(averages.processTimeUs.has_value());
+    EXPECT_EQ(averages.processTimeUs.value(), 150);
+    ASSERT_TRUE(averages.inputWaitTimeUs.has_value());
+    EXPECT_EQ(averages.inputWaitTimeUs.value(), 20);
+}
+
+TEST(CalculatorProfileReporter, CalculatorNotCalledSincePreviousReport) {
+    CalculatorProfileReporter reporter;
+    reporter.update("calc", {100, 2, 60, 3});
+    auto averages = reporter.update("calc", {100, 2, 60, 3});
+    EXPECT_FALSE(averages.processTimeUs.has_value());
+    EXPECT_FALSE(averages.inputWaitTimeUs.has_value());
+}
+
+TEST(CalculatorProfileReporter, CalculatorsAreTrackedSeparately) {
+    CalculatorProfileReporter reporter;
+    reporter.update("calc", {100, 2, 60, 3});
+    auto averages = reporter.update("other", {30, 1, 10, 1});
+    ASSERT_TRUE(averages.processTimeUs.has_value());
+    EXPECT_EQ(averages.processTimeUs.value(), 30);
+    ASSERT_TRUE(averages.inputWaitTimeUs.has_value());
+    EXPECT_EQ(averages.inputWaitTimeUs.value(), 10);
+}
+
+TEST(CalculatorProfileReporter, ResetStartsFromZero) {
+    CalculatorProfileReporter reporter;
+    reporter.update("calc", {100, 2, 60, 3});
+    reporter.reset();
+    auto averages = reporter.update("calc", {40, 1, 9, 3});
+    ASSERT_TRUE(averages.processTimeUs.has_value());
+    EXPECT_EQ(averages.processTimeUs.value(), 40);
+    ASSERT_TRUE(averages.inputWaitTimeUs.has_value());
+    EXPECT_EQ(averages.inputWaitTimeUs.value(), 3);
+}
+
+TEST(CalculatorProfileReporter, SmallerTotalsAreTreatedAsNewProfiler) {
+    CalculatorProfileReporter reporter;
+    reporter.update("calc", {100, 2, 60, 3});
+    auto averages = reporter.update("calc", {40, 1, 9, 3});
+    ASSERT_TRUE(averages.processTimeUs.has_value());
+    EXPECT_EQ(averages.processTimeUs.value(), 40);
+    ASSERT_TRUE(averages.inputWaitTimeUs.has_value());
+    EXPECT_EQ(averages.inputWaitTimeUs.value(), 3);
+}
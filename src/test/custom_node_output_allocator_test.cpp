@@ -18,6 +18,7 @@
 
 #include <openvino/runtime/tensor.hpp>
 
+#include "../dags/custom_node_buffer_arena.hpp"
 #include "../dags/custom_node_output_allocator.hpp"
 #include "../precision.hpp"
 #include "../shape.hpp"
@@ -167,3 +168,71 @@ TEST(CustomNodeOutputAllocator, TensorReturnsCorrectPointer) {
     auto tensorIE2 = std::make_shared<ov::Tensor>(elemType, shape, alloc);
     EXPECT_EQ(tensorIE2->data(), tensor.data);
 }
+
+TEST(CustomNodeBufferArena, ReusesReleasedBuffersOfSameSizeClass) {
+    CustomNodeBufferArena arena;
+    void* first = arena.allocate(1000);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(first) % CustomNodeBufferArena::BUFFER_ALIGNMENT, 0);
+    EXPECT_TRUE(arena.deallocate(first));
+    EXPECT_EQ(arena.getCachedBytes(), CustomNodeBufferArena::MIN_BUFFER_BYTES);
+    void* second = arena.allocate(CustomNodeBufferArena::MIN_BUFFER_BYTES);
+    EXPECT_EQ(second, first);
+    void* third = arena.allocate(CustomNodeBufferArena::MIN_BUFFER_BYTES + 1);
+    EXPECT_NE(third, first);
+    EXPECT_EQ(arena.getHits(), 1);
+    EXPECT_EQ(arena.getMisses(), 2);
+    EXPECT_TRUE(arena.deallocate(second));
+    EXPECT_TRUE(arena.deallocate(third));
+    EXPECT_EQ(arena.getCachedBytes(), 3 * CustomNodeBufferArena::MIN_BUFFER_BYTES);
+}
+
+TEST(CustomNodeBufferArena, FreesBuffersAboveCachedBytesLimit) {
+    CustomNodeBufferArena arena(CustomNodeBufferArena::MIN_BUFFER_BYTES);
+    void* first = arena.allocate(10);
+    void* second = arena.allocate(10);
+    EXPECT_TRUE(arena.deallocate(first));
+    EXPECT_TRUE(arena.deallocate(second));
+    EXPECT_EQ(arena.getCachedBytes(), CustomNodeBufferArena::MIN_BUFFER_BYTES);
+}
+
+TEST(CustomNodeBufferArena, RejectsBuffersNotAllocatedByArena) {
+    CustomNodeBufferArena arena;
+    std::vector<float> data(10);
+    EXPECT_FALSE(arena.deallocate(data.data()));
+    EXPECT_FALSE(arena.deallocate(nullptr));
+    EXPECT_EQ(arena.allocate(0), nullptr);
+}
+
+TEST(CustomNodeOutputAllocator, TensorDeallocationReturnsArenaBufferWithoutReleaseBuffer) {
+    auto& arena = CustomNodeBufferArena::instance();
+    const auto* allocator = arena.getAllocator();
+    unsigned int elementsCount = 10;
+    void* data = allocator->allocate(sizeof(float) * elementsCount, allocator->context);
+    ASSERT_NE(data, nullptr);
+    auto cachedBytesBefore = arena.getCachedBytes();
+    CustomNodeTensor tensor{
+        "name",
+        reinterpret_cast<uint8_t*>(data),
+        sizeof(float) * elementsCount,
+        reinterpret_cast<uint64_t*>(&elementsCount),
+        1,
+        CustomNodeTensorPrecision::FP32};
+    NodeLibrary library{
+        NodeLibraryCheckingReleaseCalled::initialize,
+        NodeLibraryCheckingReleaseCalled::deinitialize,
+        NodeLibraryCheckingReleaseCalled::execute,
+        NodeLibraryCheckingReleaseCalled::getInputsInfo,
+        NodeLibraryCheckingReleaseCalled::getOutputsInfo,
+        NodeLibraryCheckingReleaseCalled::release};
+    NodeLibraryCheckingReleaseCalled::releaseBufferCalled = false;
+    {
+        CustomNodeOutputAllocatorCheckingFreeCalled alloc(tensor, library, nullptr);
+        auto elemType = ovmsPrecisionToIE2Precision(Precision::FP32);
+        shape_t shape{elementsCount};
+        auto tensorIE2 = std::make_shared<ov::Tensor>(elemType, shape, alloc);
+        EXPECT_EQ(tensorIE2->data(), data);
+    }
+    EXPECT_FALSE(NodeLibraryCheckingReleaseCalled::releaseBufferCalled);
+    EXPECT_EQ(arena.getCachedBytes(), cachedBytesBefore + CustomNodeBufferArena::MIN_BUFFER_BYTES);
+}
@@ -0,0 +1,324 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <openvino/runtime/core.hpp>
+
+#include "../capi_frontend/inferencerequest.hpp"
+#include "../capi_frontend/inferenceresponse.hpp"
+#include "../dynamic_batching_scheduler.hpp"
+#include "../inference_executor.hpp"
+#include "../modelinstance.hpp"
+#include "../modelinstanceunloadguard.hpp"
+#include "test_models_configs.hpp"
+
+using namespace ovms;
+
+namespace {
+ov::Tensor createTensor(const ov::Shape& shape, float startValue) {
+    ov::Tensor tensor(ov::element::f32, shape);
+    float* data = tensor.data<float>();
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        data[i] = startValue + i;
+    }
+    return tensor;
+}
+}  // namespace
+
+TEST(DynamicBatchingConcatenate, BatchIndexZero) {
+    std::vector<ov::Tensor> parts{createTensor({1, 3}, 0), createTensor({2, 3}, 10)};
+    ov::Tensor result;
+    ASSERT_EQ(DynamicBatchingScheduler::concatenate(parts, 0, result), StatusCode::OK);
+    ASSERT_EQ(result.get_shape(), (ov::Shape{3, 3}));
+    std::vector<float> expected{0, 1, 2, 10, 11, 12, 13, 14, 15};
+    EXPECT_EQ(std::vector<float>(result.data<float>(), result.data<float>() + result.get_size()), expected);
+}
+
+TEST(DynamicBatchingConcatenate, BatchIndexOne) {
+    std::vector<ov::Tensor> parts{createTensor({2, 1, 2}, 0), createTensor({2, 2, 2}, 10)};
+    ov::Tensor result;
+    ASSERT_EQ(DynamicBatchingScheduler::concatenate(parts, 1, result), StatusCode::OK);
+    ASSERT_EQ(result.get_shape(), (ov::Shape{2, 3, 2}));
+    std::vector<float> expected{0, 1, 10, 11, 12, 13, 2, 3, 14, 15, 16, 17};
+    EXPECT_EQ(std::vector<float>(result.data<float>(), result.data<float>() + result.get_size()), expected);
+}
+
+TEST(DynamicBatchingConcatenate, ShapeMismatch) {
+    std::vector<ov::Tensor> parts{createTensor({1, 3}, 0), createTensor({1, 4}, 0)};
+    ov::Tensor result;
+    EXPECT_EQ(DynamicBatchingScheduler::concatenate(parts, 0, result), StatusCode::INVALID_SHAPE);
+}
+
+TEST(DynamicBatchingConcatenate, PrecisionMismatch) {
+    std::vector<ov::Tensor> parts{createTensor({1, 3}, 0), ov::Tensor(ov::element::i32, {1, 3})};
+    ov::Tensor result;
+    EXPECT_EQ(DynamicBatchingScheduler::concatenate(parts, 0, result), StatusCode::INVALID_SHAPE);
+}
+
+TEST(DynamicBatchingSplit, ReversesConcatenate) {
+    for (size_t batchIndex : {0, 1}) {
+        std::vector<ov::Tensor> parts{createTensor({2, 2, 3}, 0), createTensor({2, 2, 3}, 100)};
+        if (batchIndex == 0) {
+            parts[1] = createTensor({1, 2, 3}, 100);
+        } else {
+            parts[1] = createTensor({2, 1, 3}, 100);
+        }
+        ov::Tensor batched;
+        ASSERT_EQ(DynamicBatchingScheduler::concatenate(parts, batchIndex, batched), StatusCode::OK);
+        std::vector<ov::Tensor> splitted;
+        ASSERT_EQ(DynamicBatchingScheduler::split(batched, batchIndex, {parts[0].get_shape()[batchIndex], parts[1].get_shape()[batchIndex]}, splitted), StatusCode::OK);
+        ASSERT_EQ(splitted.size(), 2);
+        for (size_t i = 0; i < parts.size(); ++i) {
+            ASSERT_EQ(splitted[i].get_shape(), parts[i].get_shape());
+            EXPECT_EQ(std::memcmp(splitted[i].data(), parts[i].data(), parts[i].get_byte_size()), 0) << "batch index: " << batchIndex << " part: " << i;
+        }
+    }
+}
+
+TEST(DynamicBatchingSplit, BatchSizeMismatch) {
+    auto batched = createTensor({3, 2}, 0);
+    std::vector<ov::Tensor> parts;
+    EXPECT_EQ(DynamicBatchingScheduler::split(batched, 0, {1, 1}, parts), StatusCode::INVALID_BATCH_SIZE);
+}
+
+class DynamicBatchingModelInstance : public ::testing::Test {
+protected:
+    std::unique_ptr<ov::Core> ieCore;
+    void SetUp() override {
+        ieCore = std::make_unique<ov::Core>();
+    }
+};
+
+TEST_F(DynamicBatchingModelInstance, DisabledByDefault) {
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(DUMMY_MODEL_CONFIG), StatusCode::OK);
+    EXPECT_EQ(modelInstance.getDynamicBatchingScheduler(), nullptr);
+}
+
+TEST_F(DynamicBatchingModelInstance, DisabledWhenOutputIsNotBatchedAlongInputBatchDimension) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("1:8");
+    config.setMaxQueueDelayUs(1000);
+    // output batch dimension reported at index 1 while inputs are batched along index 0
+    ASSERT_EQ(config.parseLayoutParameter("{\"a\":\"CN\"}"), StatusCode::OK);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    EXPECT_EQ(modelInstance.getDynamicBatchingScheduler(), nullptr);
+}
+
+TEST_F(DynamicBatchingModelInstance, ConcurrentRequestsGetOwnResults) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setMaxBatchSize(4);
+    config.setMaxQueueDelayUs(100000);
+    config.setNireq(1);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    auto* scheduler = modelInstance.getDynamicBatchingScheduler();
+    ASSERT_NE(scheduler, nullptr);
+    ASSERT_EQ(scheduler->getMaxBatchSize(), 4);
+
+    const size_t requestsCount = 8;
+    std::vector<Status> statuses(requestsCount);
+    std::vector<TensorMap> outputs(requestsCount);
+    std::vector<TensorMap> inputs(requestsCount);
+    for (size_t i = 0; i < requestsCount; ++i) {
+        inputs[i][DUMMY_MODEL_INPUT_NAME] = createTensor({1, DUMMY_MODEL_INPUT_SIZE}, i * 100);
+        ASSERT_TRUE(scheduler->isBatchable(inputs[i]));
+    }
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < requestsCount; ++i) {
+        threads.emplace_back([&, i]() {
+            statuses[i] = scheduler->infer(inputs[i], outputs[i]);
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    for (size_t i = 0; i < requestsCount; ++i) {
+        ASSERT_EQ(statuses[i], StatusCode::OK) << statuses[i].string();
+        auto it = outputs[i].find(DUMMY_MODEL_OUTPUT_NAME);
+        ASSERT_NE(it, outputs[i].end());
+        ASSERT_EQ(it->second.get_shape(), (ov::Shape{1, DUMMY_MODEL_INPUT_SIZE}));
+        const float* data = it->second.data<float>();
+        for (size_t j = 0; j < static_cast<size_t>(DUMMY_MODEL_INPUT_SIZE); ++j) {
+            EXPECT_EQ(data[j], i * 100 + j + 1);
+        }
+    }
+}
+
+TEST_F(DynamicBatchingModelInstance, PreallocatedOutputIsNotBatchable) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setMaxBatchSize(4);
+    config.setMaxQueueDelayUs(1000);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    ASSERT_NE(modelInstance.getDynamicBatchingScheduler(), nullptr);
+
+    InferenceRequest request("UNUSED_NAME", UNUSED_MODEL_VERSION);
+    const std::vector<int64_t> shape{1, DUMMY_MODEL_INPUT_SIZE};
+    std::vector<float> inputData(DUMMY_MODEL_INPUT_SIZE);
+    for (size_t i = 0; i < inputData.size(); ++i) {
+        inputData[i] = i;
+    }
+    std::vector<float> outputData(DUMMY_MODEL_OUTPUT_SIZE, 0);
+    ASSERT_EQ(request.addInput(DUMMY_MODEL_INPUT_NAME, OVMS_DATATYPE_FP32, shape.data(), shape.size()), StatusCode::OK);
+    ASSERT_EQ(request.setInputBuffer(DUMMY_MODEL_INPUT_NAME, inputData.data(), inputData.size() * sizeof(float), OVMS_BUFFERTYPE_CPU, std::nullopt), StatusCode::OK);
+    ASSERT_EQ(request.addOutput(DUMMY_MODEL_OUTPUT_NAME, OVMS_DATATYPE_FP32, shape.data(), shape.size()), StatusCode::OK);
+    ASSERT_EQ(request.setOutputBuffer(DUMMY_MODEL_OUTPUT_NAME, outputData.data(), outputData.size() * sizeof(float), OVMS_BUFFERTYPE_CPU, std::nullopt), StatusCode::OK);
+
+    // preallocated output makes request not mergeable, it has to be executed directly into user buffer
+    InferenceResponse response;
+    auto unloadGuard = std::make_unique<ModelInstanceUnloadGuard>(modelInstance);
+    auto status = infer(modelInstance, &request, &response, unloadGuard);
+    ASSERT_EQ(status, StatusCode::OK) << status.string();
+    for (size_t i = 0; i < outputData.size(); ++i) {
+        EXPECT_EQ(outputData[i], i + 1);
+    }
+}
+
+TEST_F(DynamicBatchingModelInstance, AsyncRequestsAreMergedAndGetOwnResults) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setMaxBatchSize(4);
+    config.setMaxQueueDelayUs(100000);
+    config.setNireq(1);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    auto* scheduler = modelInstance.getDynamicBatchingScheduler();
+    ASSERT_NE(scheduler, nullptr);
+
+    const size_t requestsCount = 6;
+    std::vector<TensorMap> outputs(requestsCount);
+    std::vector<TensorMap> inputs(requestsCount);
+    std::vector<std::promise<Status>> finished(requestsCount);
+    for (size_t i = 0; i < requestsCount; ++i) {
+        inputs[i][DUMMY_MODEL_INPUT_NAME] = createTensor({1, DUMMY_MODEL_INPUT_SIZE}, i * 100);
+    }
+    // requests are enqueued from single thread, as demultiplexed node sessions of pipeline are
+    for (size_t i = 0; i < requestsCount; ++i) {
+        scheduler->inferAsync(inputs[i], outputs[i], [&finished, i](Status status) { finished[i].set_value(status); });
+    }
+    for (size_t i = 0; i < requestsCount; ++i) {
+        auto status = finished[i].get_future().get();
+        ASSERT_EQ(status, StatusCode::OK) << status.string();
+        auto it = outputs[i].find(DUMMY_MODEL_OUTPUT_NAME);
+        ASSERT_NE(it, outputs[i].end());
+        ASSERT_EQ(it->second.get_shape(), (ov::Shape{1, DUMMY_MODEL_INPUT_SIZE}));
+        const float* data = it->second.data<float>();
+        for (size_t j = 0; j < static_cast<size_t>(DUMMY_MODEL_INPUT_SIZE); ++j) {
+            EXPECT_EQ(data[j], i * 100 + j + 1);
+        }
+    }
+}
+
+TEST_F(DynamicBatchingModelInstance, AsyncAndBlockingRequestsAreServedTogether) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setMaxBatchSize(2);
+    config.setMaxQueueDelayUs(10000);
+    config.setNireq(2);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    auto* scheduler = modelInstance.getDynamicBatchingScheduler();
+    ASSERT_NE(scheduler, nullptr);
+
+    TensorMap asyncInputs, asyncOutputs, inputs, outputs;
+    asyncInputs[DUMMY_MODEL_INPUT_NAME] = createTensor({1, DUMMY_MODEL_INPUT_SIZE}, 0);
+    inputs[DUMMY_MODEL_INPUT_NAME] = createTensor({1, DUMMY_MODEL_INPUT_SIZE}, 100);
+    std::promise<Status> asyncFinished;
+    scheduler->inferAsync(asyncInputs, asyncOutputs, [&asyncFinished](Status status) { asyncFinished.set_value(status); });
+    ASSERT_EQ(scheduler->infer(inputs, outputs), StatusCode::OK);
+    ASSERT_EQ(asyncFinished.get_future().get(), StatusCode::OK);
+    EXPECT_EQ(asyncOutputs.at(DUMMY_MODEL_OUTPUT_NAME).data<float>()[0], 1);
+    EXPECT_EQ(outputs.at(DUMMY_MODEL_OUTPUT_NAME).data<float>()[0], 101);
+}
+
+TEST_F(DynamicBatchingModelInstance, RequestsWaitingForBatchAreCountedByAdmissionControl) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setMaxBatchSize(4);
+    config.setMaxQueueDelayUs(200000);
+    config.setMaxPendingRequests(1);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    auto* scheduler = modelInstance.getDynamicBatchingScheduler();
+    ASSERT_NE(scheduler, nullptr);
+
+    TensorMap waitingInputs, waitingOutputs;
+    waitingInputs[DUMMY_MODEL_INPUT_NAME] = createTensor({1, DUMMY_MODEL_INPUT_SIZE}, 0);
+    std::promise<Status> finished;
+    scheduler->inferAsync(waitingInputs, waitingOutputs, [&finished](Status status) { finished.set_value(status); });
+
+    // first request is held for max_queue_delay_us so the limit of waiting requests is reached
+    TensorMap inputs, outputs;
+    inputs[DUMMY_MODEL_INPUT_NAME] = createTensor({1, DUMMY_MODEL_INPUT_SIZE}, 100);
+    EXPECT_EQ(scheduler->infer(inputs, outputs), StatusCode::SERVABLE_OVERLOADED);
+    EXPECT_EQ(finished.get_future().get(), StatusCode::OK);
+    EXPECT_EQ(scheduler->infer(inputs, outputs), StatusCode::OK);
+}
+
+TEST_F(DynamicBatchingModelInstance, RequestWithPassedDeadlineIsDroppedWithEdfDispatch) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setMaxBatchSize(4);
+    config.setMaxQueueDelayUs(1000);
+    config.setDispatchPolicy("edf");
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    auto* scheduler = modelInstance.getDynamicBatchingScheduler();
+    ASSERT_NE(scheduler, nullptr);
+
+    TensorMap inputs, outputs;
+    inputs[DUMMY_MODEL_INPUT_NAME] = createTensor({1, DUMMY_MODEL_INPUT_SIZE}, 0);
+    EXPECT_EQ(scheduler->infer(inputs, outputs, std::chrono::steady_clock::now() - std::chrono::milliseconds(1)), StatusCode::INFERENCE_DEADLINE_EXCEEDED);
+    EXPECT_EQ(scheduler->infer(inputs, outputs, std::chrono::steady_clock::now() + std::chrono::seconds(10)), StatusCode::OK);
+}
+
+TEST_F(DynamicBatchingModelInstance, AsyncRequestOverMaxBatchSizeIsExecutedUnbatched) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setBatchingParams("1:8");
+    config.setMaxBatchSize(2);
+    config.setMaxQueueDelayUs(1000);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    auto* scheduler = modelInstance.getDynamicBatchingScheduler();
+    ASSERT_NE(scheduler, nullptr);
+
+    TensorMap inputs, outputs;
+    inputs[DUMMY_MODEL_INPUT_NAME] = createTensor({3, DUMMY_MODEL_INPUT_SIZE}, 0);
+    ASSERT_TRUE(scheduler->isBatchable(inputs));
+    EXPECT_EQ(scheduler->validateBatchSize(inputs), StatusCode::INVALID_BATCH_SIZE);
+    // same as blocking requests, oversized request is executed alone
+    std::promise<Status> finished;
+    scheduler->inferAsync(inputs, outputs, [&finished](Status status) { finished.set_value(status); });
+    auto status = finished.get_future().get();
+    ASSERT_EQ(status, StatusCode::OK) << status.string();
+    auto it = outputs.find(DUMMY_MODEL_OUTPUT_NAME);
+    ASSERT_NE(it, outputs.end());
+    ASSERT_EQ(it->second.get_shape(), (ov::Shape{3, DUMMY_MODEL_INPUT_SIZE}));
+    const float* data = it->second.data<float>();
+    for (size_t i = 0; i < it->second.get_size(); ++i) {
+        EXPECT_EQ(data[i], i + 1);
+    }
+
+    TensorMap blockingOutputs;
+    ASSERT_EQ(scheduler->infer(inputs, blockingOutputs), StatusCode::OK);
+    EXPECT_EQ(blockingOutputs.at(DUMMY_MODEL_OUTPUT_NAME).get_shape(), (ov::Shape{3, DUMMY_MODEL_INPUT_SIZE}));
+}
@@ -19,6 +19,7 @@
 #include <numeric>
 #include <optional>
 #include <regex>
+#include <set>
 #include <string>
 #include <utility>
 
@@ -49,6 +50,7 @@
 #include "../dags/pipeline.hpp"
 #include "../dags/pipeline_factory.hpp"
 #include "../dags/pipelinedefinition.hpp"
+#include "../dags/session_id.hpp"
 #include "../execution_context.hpp"
 #include "src/metrics/metric_config.hpp"
 #include "src/metrics/metric_registry.hpp"
@@ -4403,6 +4405,46 @@ TEST_F(EnsembleConfigurationValidationWithDemultiplexer, DemultiplexerWithoutGat
     ASSERT_EQ(pipelineDefinition->validate(manager, manager, manager), StatusCode::PIPELINE_WRONG_DEMULTIPLEXER_GATHER_NODES_ORDER);
 }
 
+TEST_F(EnsembleConfigurationValidationWithDemultiplexer, TooManyNestedDemultiplexers) {
+    const size_t demultiplyCount = 2;
+    // each demultiplexer adds one nesting level, exit node gathers from all of them
+    auto validateNestedDemultiplexers = [&](size_t levels) {
+        std::vector<NodeInfo> info{
+            {NodeKind::ENTRY, ENTRY_NODE_NAME, "", std::nullopt, {{pipelineInputName, pipelineInputName}}}};
+        pipeline_connections_t connections;
+        std::set<std::string> gatherFrom;
+        std::string previousNodeName = ENTRY_NODE_NAME;
+        std::string previousOutputName = pipelineInputName;
+        for (size_t i = 1; i <= levels; ++i) {
+            const std::string nodeName = "custom_node_" + std::to_string(i);
+            info.emplace_back(NodeKind::CUSTOM, nodeName, "", std::nullopt, std::unordered_map<std::string, std::string>{{"out", "out_OutputNumbers"}}, demultiplyCount, std::set<std::string>{}, mockedLibrary,
+                parameters_t{
+                    {"in_InputNumbers", "1,10;FP32"},
+                    {"out_OutputNumbers", "2,1,10;FP32"}});
+            connections[nodeName] = {
+                {previousNodeName, {{previousOutputName, "in_InputNumbers"}}}};
+            gatherFrom.insert(nodeName);
+            previousNodeName = nodeName;
+            previousOutputName = "out";
+        }
+        info.emplace_back(NodeKind::CUSTOM, "custom_node_last", "", std::nullopt, std::unordered_map<std::string, std::string>{{"out", "out_OutputNumbers"}}, std::nullopt, std::set<std::string>{}, mockedLibrary,
+            parameters_t{
+                {"in_InputNumbers", "1,10;FP32"},
+                {"out_OutputNumbers", "1,5;I32"}});
+        connections["custom_node_last"] = {
+            {previousNodeName, {{previousOutputName, "in_InputNumbers"}}}};
+        info.emplace_back(NodeKind::EXIT, EXIT_NODE_NAME, "", std::nullopt, std::unordered_map<std::string, std::string>{}, std::nullopt, gatherFrom);
+        connections[EXIT_NODE_NAME] = {
+            {"custom_node_last", {{"out", pipelineOutputName}}}};
+
+        ConstructorEnabledModelManager manager;
+        std::unique_ptr<PipelineDefinition> pipelineDefinition = std::make_unique<PipelineDefinition>("my_new_pipeline", info, connections);
+        return pipelineDefinition->validate(manager, manager, manager);
+    };
+    EXPECT_EQ(validateNestedDemultiplexers(SessionKey::MAX_DEPTH), StatusCode::OK);
+    EXPECT_EQ(validateNestedDemultiplexers(SessionKey::MAX_DEPTH + 1), StatusCode::PIPELINE_TOO_MANY_DEMULTIPLEXING_LEVELS);
+}
+
 class EnsembleFlowCustomNodeAndDynamicDemultiplexerLoadConfigThenExecuteTest : public EnsembleFlowCustomNodeLoadConfigThenExecuteTest {
 protected:
     void SetUp() override {
@@ -1753,7 +1753,7 @@ public:
         std::optional<int32_t> demultiplyCount = std::nullopt, std::set<std::string> gatherFromNode = {}) :
         DLNode(nodeName, modelName, modelVersion, modelManager, nodeOutputNameAlias, demultiplyCount, gatherFromNode),
         order(order) {}
-    ovms::Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override {
+    ovms::Status execute(const session_key_t& sessionId, PipelineEventQueue& notifyEndQueue) override {
         auto status = DLNode::execute(sessionId, notifyEndQueue);
         order.push_back(1);
         return status;
@@ -1769,7 +1769,7 @@ public:
         std::optional<int32_t> demultiplyCount = std::nullopt, std::set<std::string> gatherFromNode = {}) :
         DLNode(nodeName, modelName, modelVersion, modelManager, nodeOutputNameAlias, demultiplyCount, gatherFromNode),
         order(order) {}
-    ovms::Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override {
+    ovms::Status execute(const session_key_t& sessionId, PipelineEventQueue& notifyEndQueue) override {
         auto status = DLNode::execute(sessionId, notifyEndQueue);
         order.push_back(2);
         return status;
@@ -1785,7 +1785,7 @@ public:
         std::optional<int32_t> demultiplyCount = std::nullopt, std::set<std::string> gatherFromNode = {}) :
         DLNode(nodeName, modelName, modelVersion, modelManager, nodeOutputNameAlias, demultiplyCount, gatherFromNode),
         order(order) {}
-    ovms::Status execute(session_key_t sessionId, PipelineEventQueue& notifyEndQueue) override {
+    ovms::Status execute(const session_key_t& sessionId, PipelineEventQueue& notifyEndQueue) override {
         auto status = DLNode::execute(sessionId, notifyEndQueue);
         order.push_back(3);
         return status;
@@ -2903,6 +2903,36 @@ TEST_F(EnsembleFlowTest, PipelineFactoryCreationWithInputOutputsMappings) {
     checkDummyResponse(dummySeriallyConnectedCount);
 }
 
+TEST_F(EnsembleFlowTest, PipelineProfilerRecordsCriticalPath) {
+    std::string fileToReload = directoryPath + "/ovms_config_file.json";
+    createConfigFileWithContent(adjustConfigForTargetPlatformCStr(pipelineOneDummyConfig), fileToReload);
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.loadConfig(fileToReload);
+    auto* definition = managerWithDummyModel.getPipelineFactory().findDefinitionByName("pipeline1Dummy");
+    ASSERT_NE(definition, nullptr);
+    std::unique_ptr<Pipeline> pipeline;
+    auto status = managerWithDummyModel.getPipelineFactory().create(pipeline,
+        "pipeline1Dummy",
+        &request,
+        &response,
+        managerWithDummyModel);
+    ASSERT_EQ(status, ovms::StatusCode::OK) << status.string();
+    ASSERT_EQ(pipeline->execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    const auto& profiler = definition->getProfiler();
+    EXPECT_EQ(profiler.getExecutionsCount(), 1);
+    auto paths = profiler.getRecentCriticalPaths();
+    ASSERT_EQ(paths.size(), 1);
+    std::vector<std::string> nodeNames;
+    for (const auto& node : paths[0]) {
+        nodeNames.push_back(node.nodeName);
+    }
+    const std::vector<std::string> expectedNodeNames{ovms::ENTRY_NODE_NAME, "dummyNode", ovms::EXIT_NODE_NAME};
+    EXPECT_EQ(nodeNames, expectedNodeNames);
+    EXPECT_EQ(paths[0][1].profile.sessions, 1);
+    EXPECT_GT(paths[0][1].profile.executeUs, 0);
+    EXPECT_NE(profiler.toJson("pipeline1Dummy").find("\"critical_path_counts\":{\"dummyNode\":1"), std::string::npos);
+}
+
 static const char* pipelineOneDummyConfig2ParallelDummy = R"(
 {
     "model_config_list": [
@@ -3006,6 +3036,186 @@ TEST_F(EnsembleFlowTest, PipelineFactoryCreationWithInputOutputsMappings2Paralle
         << readableError(expected_output, actual_output, dataLengthToCheck);
 }
 
+static const char* pipelineThreeDummyConfigWithNodeFusion = R"(
+{
+    "model_config_list": [
+        {
+            "config": {
+                "name": "dummy",
+                "base_path": "/ovms/src/test/dummy",
+                "target_device": "CPU",
+                "model_version_policy": {"all": {}},
+                "nireq": 1
+            }
+        }
+    ],
+    "pipeline_config_list": [
+        {
+            "name": "pipeline1Dummy",
+            "inputs": ["custom_dummy_input"],
+            "fuse_nodes": true,
+            "nodes": [
+                {
+                    "name": "dummyNode",
+                    "model_name": "dummy",
+                    "type": "DL model",
+                    "inputs": [
+                        {"b": {"node_name": "request",
+                               "data_item": "custom_dummy_input"}}
+                    ],
+                    "outputs": [
+                        {"data_item": "a",
+                         "alias": "new_dummy_output"}
+                    ]
+                },
+                {
+                    "name": "dummyNode2",
+                    "model_name": "dummy",
+                    "type": "DL model",
+                    "inputs": [
+                        {"b": {"node_name": "dummyNode",
+                               "data_item": "new_dummy_output"}}
+                    ],
+                    "outputs": [
+                        {"data_item": "a",
+                         "alias": "new_dummy_output2"}
+                    ]
+                },
+                {
+                    "name": "dummyNode3",
+                    "model_name": "dummy",
+                    "type": "DL model",
+                    "inputs": [
+                        {"b": {"node_name": "dummyNode2",
+                               "data_item": "new_dummy_output2"}}
+                    ],
+                    "outputs": [
+                        {"data_item": "a",
+                         "alias": "new_dummy_output3"}
+                    ]
+                }
+            ],
+            "outputs": [
+                {"custom_dummy_output": {"node_name": "dummyNode3",
+                                         "data_item": "new_dummy_output3"}
+                }
+            ]
+        }
+    ]
+})";
+
+TEST_F(EnsembleFlowTest, PipelineFactoryCreationWithNodeFusion) {
+    std::string fileToReload = directoryPath + "/ovms_config_file.json";
+    createConfigFileWithContent(adjustConfigForTargetPlatformCStr(pipelineThreeDummyConfigWithNodeFusion), fileToReload);
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.loadConfig(fileToReload);
+    auto* definition = managerWithDummyModel.getPipelineFactory().findDefinitionByName("pipeline1Dummy");
+    ASSERT_NE(definition, nullptr);
+    ASSERT_TRUE(definition->isNodeFusionEnabled());
+    const std::vector<std::vector<std::string>> expectedFusedNodes{{"dummyNode", "dummyNode2", "dummyNode3"}};
+    EXPECT_EQ(definition->getFusedNodes(), expectedFusedNodes);
+    std::unique_ptr<Pipeline> pipeline;
+    auto status = managerWithDummyModel.getPipelineFactory().create(pipeline,
+        "pipeline1Dummy",
+        &request,
+        &response,
+        managerWithDummyModel);
+    ASSERT_EQ(status, ovms::StatusCode::OK) << status.string();
+    ASSERT_EQ(pipeline->execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    const int dummySeriallyConnectedCount = 3;
+    checkDummyResponse(dummySeriallyConnectedCount);
+}
+
+static const char* pipelineThreeDynamicDummyConfigWithNodeFusion = R"(
+{
+    "model_config_list": [
+        {
+            "config": {
+                "name": "dummy",
+                "base_path": "/ovms/src/test/dummy",
+                "target_device": "CPU",
+                "model_version_policy": {"all": {}},
+                "nireq": 1,
+                "shape": "(-1,10)"
+            }
+        }
+    ],
+    "pipeline_config_list": [
+        {
+            "name": "pipeline1Dummy",
+            "inputs": ["custom_dummy_input"],
+            "fuse_nodes": true,
+            "nodes": [
+                {
+                    "name": "dummyNode",
+                    "model_name": "dummy",
+                    "type": "DL model",
+                    "inputs": [
+                        {"b": {"node_name": "request",
+                               "data_item": "custom_dummy_input"}}
+                    ],
+                    "outputs": [
+                        {"data_item": "a",
+                         "alias": "new_dummy_output"}
+                    ]
+                },
+                {
+                    "name": "dummyNode2",
+                    "model_name": "dummy",
+                    "type": "DL model",
+                    "inputs": [
+                        {"b": {"node_name": "dummyNode",
+                               "data_item": "new_dummy_output"}}
+                    ],
+                    "outputs": [
+                        {"data_item": "a",
+                         "alias": "new_dummy_output2"}
+                    ]
+                },
+                {
+                    "name": "dummyNode3",
+                    "model_name": "dummy",
+                    "type": "DL model",
+                    "inputs": [
+                        {"b": {"node_name": "dummyNode2",
+                               "data_item": "new_dummy_output2"}}
+                    ],
+                    "outputs": [
+                        {"data_item": "a",
+                         "alias": "new_dummy_output3"}
+                    ]
+                }
+            ],
+            "outputs": [
+                {"custom_dummy_output": {"node_name": "dummyNode3",
+                                         "data_item": "new_dummy_output3"}
+                }
+            ]
+        }
+    ]
+})";
+
+TEST_F(EnsembleFlowTest, PipelineFactoryCreationWithNodeFusionSkipsDynamicShapeModels) {
+    std::string fileToReload = directoryPath + "/ovms_config_file.json";
+    createConfigFileWithContent(adjustConfigForTargetPlatformCStr(pipelineThreeDynamicDummyConfigWithNodeFusion), fileToReload);
+    ConstructorEnabledModelManager managerWithDummyModel;
+    managerWithDummyModel.loadConfig(fileToReload);
+    auto* definition = managerWithDummyModel.getPipelineFactory().findDefinitionByName("pipeline1Dummy");
+    ASSERT_NE(definition, nullptr);
+    ASSERT_TRUE(definition->isNodeFusionEnabled());
+    EXPECT_TRUE(definition->getFusedNodes().empty());
+    std::unique_ptr<Pipeline> pipeline;
+    auto status = managerWithDummyModel.getPipelineFactory().create(pipeline,
+        "pipeline1Dummy",
+        &request,
+        &response,
+        managerWithDummyModel);
+    ASSERT_EQ(status, ovms::StatusCode::OK) << status.string();
+    ASSERT_EQ(pipeline->execute(DEFAULT_TEST_CONTEXT), StatusCode::OK);
+    const int dummySeriallyConnectedCount = 3;
+    checkDummyResponse(dummySeriallyConnectedCount);
+}
+
 static const char* pipelineOneDummyConfigWrongNodeKind = R"(
 {
     "model_config_list": [
@@ -16,7 +16,9 @@
 #include <algorithm>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <functional>
+#include <numeric>
 #include <optional>
 #include <sstream>
 
@@ -171,6 +173,78 @@ TEST_F(GatherNodeInputHandlerTest, SetInputsWithShardsHavingDifferentShapesShoul
     EXPECT_EQ(status, StatusCode::PIPELINE_INCONSISTENT_SHARD_DIMENSIONS) << status.string();
 }
 
+TEST_F(GatherNodeInputHandlerTest, ReservedShardsAreWrittenInPlace) {
+    const std::string inputName{"a"};
+    const session_id_t shardsCount = 3;
+    ov::Shape shape{1, 10};
+    ov::element::Type_t precision{ov::element::Type_t::f32};
+    std::vector<float> tensorsData(shardsCount * 10);
+    std::iota(tensorsData.begin(), tensorsData.end(), 0.1);
+    CollapseDetails collapsingDetails{{std::string("NOT_IMPORTANT_DEMULTIPLEXER_NAME")}, {shardsCount}};
+    GatherNodeInputHandler gInputHandler(1, collapsingDetails);
+    const void* consolidatedData = nullptr;
+    for (session_id_t shardId = 0; shardId < shardsCount; ++shardId) {
+        auto shard = gInputHandler.reserveShard(inputName, shardId, precision, shape);
+        ASSERT_TRUE(shard.has_value());
+        ASSERT_TRUE(shard->hasSource());
+        if (consolidatedData == nullptr) {
+            consolidatedData = shard->getSourceTensor().data();
+        }
+        EXPECT_EQ(shard->getSourceTensor().data(), consolidatedData);
+        EXPECT_EQ(shard->getActualTensor().get_shape(), shape);
+        std::memcpy(shard->getActualTensor().data(), tensorsData.data() + shardId * 10, shard->getActualTensor().get_byte_size());
+        ASSERT_EQ(gInputHandler.setInput(inputName, shard.value(), shardId), StatusCode::OK);
+        ASSERT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::OK);
+    }
+    ASSERT_TRUE(gInputHandler.isReady());
+    const auto& tensor = gInputHandler.getInputs().at(inputName);
+    EXPECT_EQ(tensor.data(), consolidatedData);
+    EXPECT_THAT(tensor.get_shape(), ElementsAre(shardsCount, 1, 10));
+    EXPECT_EQ(std::memcmp(tensor.data(), tensorsData.data(), tensorsData.size() * sizeof(float)), 0);
+}
+
+TEST_F(GatherNodeInputHandlerTest, NotReservedShardIsCopiedIntoReservedTensor) {
+    const std::string inputName{"a"};
+    const session_id_t shardsCount = 2;
+    ov::Shape shape{1, 10};
+    ov::element::Type_t precision{ov::element::Type_t::f32};
+    std::vector<float> tensorsData(shardsCount * 10);
+    std::iota(tensorsData.begin(), tensorsData.end(), 0.1);
+    CollapseDetails collapsingDetails{{std::string("NOT_IMPORTANT_DEMULTIPLEXER_NAME")}, {shardsCount}};
+    GatherNodeInputHandler gInputHandler(1, collapsingDetails);
+    auto reservedShard = gInputHandler.reserveShard(inputName, 1, precision, shape);
+    ASSERT_TRUE(reservedShard.has_value());
+    std::memcpy(reservedShard->getActualTensor().data(), tensorsData.data() + 10, reservedShard->getActualTensor().get_byte_size());
+    // shard with different shape cannot be written in place
+    EXPECT_FALSE(gInputHandler.reserveShard(inputName, 0, precision, {1, 9}).has_value());
+    EXPECT_FALSE(gInputHandler.reserveShard(inputName, shardsCount, precision, shape).has_value());
+    auto copiedShard = TensorWithSource(createTensorWithNoDataOwnership(precision, shape, tensorsData.data()));
+    ASSERT_EQ(gInputHandler.setInput(inputName, copiedShard, 0), StatusCode::OK);
+    ASSERT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::OK);
+    ASSERT_EQ(gInputHandler.setInput(inputName, reservedShard.value(), 1), StatusCode::OK);
+    ASSERT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::OK);
+    ASSERT_TRUE(gInputHandler.isReady());
+    const auto& tensor = gInputHandler.getInputs().at(inputName);
+    EXPECT_EQ(tensor.data(), reservedShard->getSourceTensor().data());
+    EXPECT_EQ(std::memcmp(tensor.data(), tensorsData.data(), tensorsData.size() * sizeof(float)), 0);
+}
+
+TEST_F(GatherNodeInputHandlerTest, ReservedShardWithDifferentShapeShouldReturnErrorWhenGathering) {
+    const std::string inputName{"a"};
+    const session_id_t shardsCount = 2;
+    ov::element::Type_t precision{ov::element::Type_t::f32};
+    std::vector<float> tensorsData(10);
+    CollapseDetails collapsingDetails{{std::string("NOT_IMPORTANT_DEMULTIPLEXER_NAME")}, {shardsCount}};
+    GatherNodeInputHandler gInputHandler(1, collapsingDetails);
+    auto reservedShard = gInputHandler.reserveShard(inputName, 0, precision, {1, 10});
+    ASSERT_TRUE(reservedShard.has_value());
+    auto otherShard = TensorWithSource(createTensorWithNoDataOwnership(precision, {1, 9}, tensorsData.data()));
+    ASSERT_EQ(gInputHandler.setInput(inputName, reservedShard.value(), 0), StatusCode::OK);
+    ASSERT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::OK);
+    ASSERT_EQ(gInputHandler.setInput(inputName, otherShard, 1), StatusCode::OK);
+    EXPECT_EQ(gInputHandler.notifyFinishedDependency(), StatusCode::PIPELINE_INCONSISTENT_SHARD_DIMENSIONS);
+}
+
 class GatherNodeTest : public TestWithTempDir {};
 
 static const char* configDummy1BsDummy2Bs = R"(
@@ -217,7 +291,7 @@ public:
         std::unordered_map<std::string, std::string> nodeOutputNameAlias, const std::optional<std::set<std::string>>& gatherFrom) :
         DLNode(nodeName, modelName, modelVersion, modelManager, nodeOutputNameAlias, 0, gatherFrom.value_or(std::set<std::string>())) {
     }
-    const auto& getInputsFromInputHandler(session_key_t sessionId) const {
+    const auto& getInputsFromInputHandler(const session_key_t& sessionId) const {
         DLNodeSessionWithGetInputsExposed& dlnodesessionWithGetInputsExposed = static_cast<DLNodeSessionWithGetInputsExposed&>(*nodeSessions.at(sessionId));
         return dlnodesessionWithGetInputsExposed.getInputs();
     }
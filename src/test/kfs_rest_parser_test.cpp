@@ -330,6 +330,92 @@ TEST_F(KFSRestParserTest, parseRequestWithZeroDim) {
     ASSERT_EQ(proto.raw_input_contents_size(), 0);
 }
 
+TEST(KFSRestParserRawInputContentsTest, parseValidRequestNestedFP32) {
+    std::string request = R"({
+    "inputs" : [
+        {
+        "name" : "input0",
+        "shape" : [ 2, 2 ],
+        "datatype" : "FP32",
+        "data" : [ [ 1, 2.5 ], [ 3, -4 ] ]
+        }
+    ]
+    })";
+    KFSRestParser parser(true);
+    auto status = parser.parse(request.c_str());
+    ASSERT_EQ(status, StatusCode::OK);
+
+    auto proto = parser.getProto();
+    ASSERT_EQ(proto.inputs_size(), 1);
+    ASSERT_EQ(proto.inputs()[0].contents().fp32_contents_size(), 0);
+    ASSERT_EQ(proto.raw_input_contents_size(), 1);
+    ASSERT_EQ(proto.raw_input_contents()[0].size(), 4 * sizeof(float));
+    const float* data = reinterpret_cast<const float*>(proto.raw_input_contents()[0].data());
+    ASSERT_THAT(std::vector<float>(data, data + 4), ElementsAre(1, 2.5, 3, -4));
+    EXPECT_EQ(parser.getRawInputContentsDecodedBytes(), 4 * sizeof(float));
+    EXPECT_EQ(parser.getContentsDecodedBytes(), 0);
+}
+
+TEST(KFSRestParserRawInputContentsTest, parseRequestWithZeroDim) {
+    std::string request = R"({
+    "inputs" : [
+        {
+        "name" : "input0",
+        "shape" : [ 10, 0 ],
+        "datatype" : "INT64",
+        "data" : [ ]
+        }
+    ]
+    })";
+    KFSRestParser parser(true);
+    ASSERT_EQ(parser.parse(request.c_str()), StatusCode::OK);
+    ASSERT_EQ(parser.getProto().raw_input_contents_size(), 1);
+    ASSERT_EQ(parser.getProto().raw_input_contents()[0].size(), 0);
+}
+
+TEST(KFSRestParserRawInputContentsTest, parseRequestWrongValueCount) {
+    std::string request = R"({
+    "inputs" : [
+        {
+        "name" : "input0",
+        "shape" : [ 3 ],
+        "datatype" : "BOOL",
+        "data" : [ true ]
+        }
+    ]
+    })";
+    KFSRestParser parser(true);
+    ASSERT_EQ(parser.parse(request.c_str()), StatusCode::INVALID_VALUE_COUNT);
+}
+
+TEST(KFSRestParserRawInputContentsTest, parseRequestWithStringInputUsesContents) {
+    std::string request = R"({
+    "inputs" : [
+        {
+        "name" : "input0",
+        "shape" : [ 2 ],
+        "datatype" : "BYTES",
+        "data" : [ "ab", "cde" ]
+        },
+        {
+        "name" : "input1",
+        "shape" : [ 2 ],
+        "datatype" : "UINT16",
+        "data" : [ 1, 2 ]
+        }
+    ]
+    })";
+    KFSRestParser parser(true);
+    ASSERT_EQ(parser.parse(request.c_str()), StatusCode::OK);
+
+    auto proto = parser.getProto();
+    ASSERT_EQ(proto.raw_input_contents_size(), 0);
+    ASSERT_THAT(proto.inputs()[0].contents().bytes_contents(), ElementsAre("ab", "cde"));
+    ASSERT_THAT(proto.inputs()[1].contents().uint_contents(), ElementsAre(1, 2));
+    EXPECT_EQ(parser.getRawInputContentsDecodedBytes(), 0);
+    EXPECT_EQ(parser.getContentsDecodedBytes(), 5 + 2 * sizeof(uint32_t));
+}
+
 TEST_F(KFSRestParserTest, parseValidRequestStringInput) {
     std::string request = R"({
     "inputs" : [
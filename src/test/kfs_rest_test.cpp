@@ -407,6 +407,16 @@ TEST_F(HttpRestApiHandlerTest, MetricsParameters) {
     ASSERT_EQ(comp.type, ovms::Metrics);
 }
 
+TEST_F(HttpRestApiHandlerTest, PipelineProfile) {
+    std::string request = "/v1/pipelines/my_pipeline/profile";
+    ovms::HttpRequestComponents comp;
+
+    ASSERT_EQ(handler->parseRequestComponents(comp, "GET", request), StatusCode::OK);
+    ASSERT_EQ(comp.type, ovms::PipelineProfile);
+    ASSERT_EQ(comp.model_name, "my_pipeline");
+    ASSERT_EQ(handler->parseRequestComponents(comp, "POST", request), StatusCode::REST_UNSUPPORTED_METHOD);
+}
+
 TEST_F(HttpRestApiHandlerTest, GetModelMetadataWithLongVersion) {
     std::string request = "/v2/models/dummy/versions/72487667423532349025128558057";
     ovms::HttpRequestComponents comp;
@@ -936,12 +946,102 @@ TEST_F(HttpRestApiHandlerTest, inferPreprocess) {
 
     ASSERT_EQ(grpc_request.inputs()[0].shape()[0], 1);
     ASSERT_EQ(grpc_request.inputs()[0].shape()[1], 10);
-    int i = 0;
-    for (auto content : grpc_request.inputs()[0].contents().fp32_contents()) {
-        ASSERT_EQ(content, i++);
+    ASSERT_EQ(grpc_request.inputs()[0].contents().fp32_contents_size(), 0);
+    ASSERT_EQ(grpc_request.raw_input_contents_size(), 1);
+    ASSERT_EQ(grpc_request.raw_input_contents()[0].size(), 10 * sizeof(float));
+    const float* data = reinterpret_cast<const float*>(grpc_request.raw_input_contents()[0].data());
+    for (int i = 0; i < 10; i++) {
+        ASSERT_EQ(data[i], i);
     }
 }
 
+TEST_F(HttpRestApiHandlerTest, inferPreprocessDataDecodedToRawInputContents) {
+    std::string request_body("{\"inputs\":[{\"name\":\"b\",\"shape\":[2,2],\"datatype\":\"INT8\",\"data\":[[-1,2],[3,127]]}, {\"name\":\"c\",\"shape\":[3],\"datatype\":\"UINT64\",\"data\":[0,1,18446744073709551615]}]}");
+
+    ::KFSRequest grpc_request;
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request), ovms::StatusCode::OK);
+
+    ASSERT_EQ(grpc_request.inputs_size(), 2);
+    ASSERT_EQ(grpc_request.raw_input_contents_size(), 2);
+    ASSERT_EQ(grpc_request.inputs()[0].contents().int_contents_size(), 0);
+    ASSERT_EQ(grpc_request.inputs()[1].contents().uint64_contents_size(), 0);
+    ASSERT_EQ(grpc_request.raw_input_contents()[0], std::string({'\xff', 2, 3, 127}));
+    ASSERT_EQ(grpc_request.raw_input_contents()[1].size(), 3 * sizeof(uint64_t));
+    const uint64_t* data = reinterpret_cast<const uint64_t*>(grpc_request.raw_input_contents()[1].data());
+    EXPECT_EQ(data[0], 0);
+    EXPECT_EQ(data[1], 1);
+    EXPECT_EQ(data[2], std::numeric_limits<uint64_t>::max());
+}
+
+TEST_F(HttpRestApiHandlerTest, inferPreprocessReportsCopiedBytes) {
+    ::KFSRequest grpc_request;
+    size_t copiedBytes = 0;
+    // data decoded into raw_input_contents is copied once
+    std::string request_body("{\"inputs\":[{\"name\":\"b\",\"shape\":[2,2],\"datatype\":\"INT8\",\"data\":[[-1,2],[3,127]]}, {\"name\":\"c\",\"shape\":[3],\"datatype\":\"UINT64\",\"data\":[0,1,2]}]}");
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request, std::nullopt, &copiedBytes), ovms::StatusCode::OK);
+    EXPECT_EQ(copiedBytes, 4 + 3 * sizeof(uint64_t));
+
+    // typed contents are copied again into tensors
+    request_body = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1],\"datatype\":\"BYTES\",\"data\":[\"abc\"]}, {\"name\":\"c\",\"shape\":[2],\"datatype\":\"INT32\",\"data\":[1,2]}]}";
+    grpc_request.Clear();
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request, std::nullopt, &copiedBytes), ovms::StatusCode::OK);
+    EXPECT_EQ(copiedBytes, 2 * (3 + 2 * sizeof(int32_t)));
+
+    std::string binaryData{0x04, 0x05, 0x06, 0x07};
+    request_body = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1,4],\"datatype\":\"INT8\",\"parameters\":{\"binary_data_size\":4}}]}";
+    int inferenceHeaderContentLength = request_body.size();
+    request_body += binaryData;
+    grpc_request.Clear();
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request, inferenceHeaderContentLength, &copiedBytes), ovms::StatusCode::OK);
+    EXPECT_EQ(copiedBytes, binaryData.size());
+}
+
+TEST_F(HttpRestApiHandlerTest, inferPreprocessDataDecodedToRawInputContentsWrongValueCount) {
+    std::string request_body("{\"inputs\":[{\"name\":\"b\",\"shape\":[1,4],\"datatype\":\"FP32\",\"data\":[0,1,2]}]}");
+
+    ::KFSRequest grpc_request;
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request), ovms::StatusCode::INVALID_VALUE_COUNT);
+}
+
+TEST_F(HttpRestApiHandlerTest, inferPreprocessDataDecodedToRawInputContentsWrongValueType) {
+    std::string request_body("{\"inputs\":[{\"name\":\"b\",\"shape\":[1,2],\"datatype\":\"INT32\",\"data\":[0,1.5]}]}");
+
+    ::KFSRequest grpc_request;
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request), ovms::StatusCode::REST_COULD_NOT_PARSE_INPUT);
+}
+
+TEST_F(HttpRestApiHandlerTest, inferPreprocessBytesDataKeptInContents) {
+    std::string request_body("{\"inputs\":[{\"name\":\"b\",\"shape\":[1],\"datatype\":\"BYTES\",\"data\":[\"abc\"]}, {\"name\":\"c\",\"shape\":[2],\"datatype\":\"INT32\",\"data\":[1,2]}]}");
+
+    ::KFSRequest grpc_request;
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request), ovms::StatusCode::OK);
+
+    ASSERT_EQ(grpc_request.raw_input_contents_size(), 0);
+    ASSERT_EQ(grpc_request.inputs()[0].contents().bytes_contents_size(), 1);
+    ASSERT_EQ(grpc_request.inputs()[0].contents().bytes_contents(0), "abc");
+    ASSERT_EQ(grpc_request.inputs()[1].contents().int_contents_size(), 2);
+}
+
+TEST_F(HttpRestApiHandlerTest, inferPreprocessDataAndBinaryInputs) {
+    std::string binaryData{0x04, 0x05, 0x06, 0x07};
+    std::string request_body = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1,4],\"datatype\":\"INT8\",\"data\":[0,1,2,3]}, {\"name\":\"c\",\"shape\":[1,4],\"datatype\":\"INT8\",\"parameters\":{\"binary_data_size\":4}}]}";
+    request_body += binaryData;
+
+    ::KFSRequest grpc_request;
+    int inferenceHeaderContentLength = (request_body.size() - binaryData.size());
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request, inferenceHeaderContentLength), ovms::StatusCode::INVALID_MESSAGE_STRUCTURE);
+}
+
+TEST_F(HttpRestApiHandlerTest, inferPreprocessDataAndBinaryDataSizeInSameInput) {
+    std::string binaryData{0x04, 0x05, 0x06, 0x07};
+    std::string request_body = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1,4],\"datatype\":\"INT8\",\"data\":[0,1,2,3],\"parameters\":{\"binary_data_size\":4}}]}";
+    request_body += binaryData;
+
+    ::KFSRequest grpc_request;
+    int inferenceHeaderContentLength = (request_body.size() - binaryData.size());
+    ASSERT_EQ(HttpRestApiHandler::prepareGrpcRequest(modelName, modelVersion, request_body, grpc_request, inferenceHeaderContentLength), ovms::StatusCode::REST_CONTENTS_FIELD_NOT_EMPTY);
+}
+
 TEST_F(HttpRestApiHandlerTest, binaryInputsINT8) {
     std::string binaryData{0x00, 0x01, 0x02, 0x03};
     std::string request_body = "{\"inputs\":[{\"name\":\"b\",\"shape\":[1,4],\"datatype\":\"INT8\",\"parameters\":{\"binary_data_size\":4}}]}";
@@ -0,0 +1,240 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "src/llm/language_model/continuous_batching/admission_queue.hpp"
+
+using namespace ovms;
+
+namespace {
+LLMAdmissionLimits makeLimits(size_t maxWaitingRequests, size_t maxWaitingPromptTokens, float maxCacheUsage) {
+    LLMAdmissionLimits limits;
+    limits.maxWaitingRequests = maxWaitingRequests;
+    limits.maxWaitingPromptTokens = maxWaitingPromptTokens;
+    limits.maxCacheUsage = maxCacheUsage;
+    return limits;
+}
+}  // namespace
+
+TEST(LLMAdmissionQueue, LimitsDisabledByDefault) {
+    EXPECT_FALSE(LLMAdmissionLimits().isEnabled());
+    EXPECT_TRUE(makeLimits(1, 0, 0).isEnabled());
+    EXPECT_TRUE(makeLimits(0, 1, 0).isEnabled());
+    EXPECT_TRUE(makeLimits(0, 0, 90).isEnabled());
+}
+
+TEST(LLMAdmissionQueue, AdmitsRightAwayWhenPipelineIsEmpty) {
+    LLMAdmissionQueue queue(makeLimits(1, 0, 0));
+    for (int i = 0; i < 3; ++i) {
+        auto ticket = queue.enqueue(10);
+        ASSERT_NE(ticket, nullptr);
+        EXPECT_TRUE(ticket->admitted);
+    }
+    EXPECT_EQ(queue.getWaitingRequests(), 0);
+}
+
+TEST(LLMAdmissionQueue, WaitsWhenPipelineHasUnscheduledRequests) {
+    LLMAdmissionQueue queue(makeLimits(2, 0, 0));
+    EXPECT_EQ(queue.updatePipelineState(5, 4, 10), 0);
+    auto first = queue.enqueue(10);
+    auto second = queue.enqueue(20);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_FALSE(first->admitted);
+    EXPECT_FALSE(second->admitted);
+    EXPECT_EQ(queue.getWaitingRequests(), 2);
+    EXPECT_EQ(queue.getWaitingPromptTokens(), 30);
+    EXPECT_EQ(queue.enqueue(1), nullptr);
+
+    EXPECT_EQ(queue.updatePipelineState(5, 5, 10), 2);
+    EXPECT_TRUE(first->admitted);
+    EXPECT_TRUE(second->admitted);
+    EXPECT_EQ(queue.getWaitingRequests(), 0);
+    EXPECT_EQ(queue.getWaitingPromptTokens(), 0);
+}
+
+TEST(LLMAdmissionQueue, RejectsWhenWaitingPromptTokensExceedLimit) {
+    LLMAdmissionQueue queue(makeLimits(0, 100, 0));
+    queue.updatePipelineState(2, 1, 10);
+    // request longer than the limit is accepted to empty queue
+    auto longRequest = queue.enqueue(150);
+    ASSERT_NE(longRequest, nullptr);
+    EXPECT_EQ(queue.enqueue(1), nullptr);
+    queue.cancel(longRequest);
+    EXPECT_EQ(queue.getWaitingPromptTokens(), 0);
+    ASSERT_NE(queue.enqueue(60), nullptr);
+    ASSERT_NE(queue.enqueue(40), nullptr);
+    EXPECT_EQ(queue.enqueue(1), nullptr);
+}
+
+TEST(LLMAdmissionQueue, GatesAdmissionOnCacheUsage) {
+    LLMAdmissionQueue queue(makeLimits(0, 0, 90));
+    queue.updatePipelineState(3, 3, 95);
+    auto ticket = queue.enqueue(10);
+    ASSERT_NE(ticket, nullptr);
+    EXPECT_FALSE(ticket->admitted);
+    EXPECT_EQ(queue.updatePipelineState(3, 3, 92), 0);
+    EXPECT_FALSE(ticket->admitted);
+    EXPECT_EQ(queue.updatePipelineState(3, 3, 80), 1);
+    EXPECT_TRUE(ticket->admitted);
+}
+
+TEST(LLMAdmissionQueue, IgnoresCacheUsageOfIdlePipeline) {
+    LLMAdmissionQueue queue(makeLimits(0, 0, 90));
+    queue.updatePipelineState(1, 1, 95);
+    auto ticket = queue.enqueue(10);
+    ASSERT_NE(ticket, nullptr);
+    EXPECT_FALSE(ticket->admitted);
+    EXPECT_EQ(queue.updatePipelineState(0, 0, 95), 1);
+    EXPECT_TRUE(ticket->admitted);
+}
+
+TEST(LLMAdmissionQueue, WaitForAdmission) {
+    LLMAdmissionQueue queue(makeLimits(1, 0, 0));
+    queue.updatePipelineState(2, 1, 0);
+    auto ticket = queue.enqueue(10);
+    ASSERT_NE(ticket, nullptr);
+    EXPECT_FALSE(queue.waitForAdmission(ticket, std::chrono::milliseconds(1)));
+    auto admitted = std::async(std::launch::async, [&queue, &ticket] {
+        return queue.waitForAdmission(ticket, std::chrono::seconds(10));
+    });
+    queue.updatePipelineState(1, 1, 0);
+    EXPECT_TRUE(admitted.get());
+}
+
+TEST(LLMAdmissionQueue, CancellationWakesUpWaitingRequest) {
+    LLMAdmissionQueue queue(makeLimits(1, 0, 0));
+    queue.updatePipelineState(2, 1, 0);
+    auto ticket = queue.enqueue(10);
+    ASSERT_NE(ticket, nullptr);
+    auto admitted = std::async(std::launch::async, [&queue, &ticket] {
+        return queue.waitForAdmission(ticket);
+    });
+    queue.cancel(ticket);
+    EXPECT_FALSE(admitted.get());
+    EXPECT_TRUE(ticket->cancelled);
+    EXPECT_EQ(queue.getWaitingRequests(), 0);
+}
+
+TEST(LLMAdmissionQueue, PacesAdmissionByPromptTokensPerStep) {
+    LLMAdmissionQueue queue(makeLimits(0, 100, 0));
+    queue.updatePipelineState(2, 1, 0);
+    auto first = queue.enqueue(70);
+    auto second = queue.enqueue(30);
+    ASSERT_NE(first, nullptr);
+    ASSERT_NE(second, nullptr);
+    EXPECT_EQ(queue.updatePipelineState(2, 2, 0), 2);
+    // budget of the step is used up, so the request waits even though no other request is waiting
+    auto third = queue.enqueue(10);
+    ASSERT_NE(third, nullptr);
+    EXPECT_FALSE(third->admitted);
+    EXPECT_EQ(queue.updatePipelineState(4, 4, 0), 1);
+    EXPECT_TRUE(third->admitted);
+    auto longRequest = queue.enqueue(150);
+    ASSERT_NE(longRequest, nullptr);
+    EXPECT_FALSE(longRequest->admitted);
+    // prompt longer than the budget is admitted alone in the step
+    EXPECT_EQ(queue.updatePipelineState(5, 5, 0), 1);
+    EXPECT_TRUE(longRequest->admitted);
+    auto last = queue.enqueue(10);
+    ASSERT_NE(last, nullptr);
+    EXPECT_FALSE(last->admitted);
+    EXPECT_EQ(queue.updatePipelineState(6, 6, 0), 1);
+    EXPECT_TRUE(last->admitted);
+}
+
+TEST(LLMAdmissionQueue, LimitsNumberOfRequestsInPipeline) {
+    LLMAdmissionLimits limits;
+    limits.maxPipelineRequests = 3;
+    LLMAdmissionQueue queue(limits);
+    queue.updatePipelineState(1, 1, 0);
+    EXPECT_TRUE(queue.enqueue(10)->admitted);
+    EXPECT_TRUE(queue.enqueue(10)->admitted);
+    auto ticket = queue.enqueue(10);
+    EXPECT_FALSE(ticket->admitted);
+    EXPECT_EQ(queue.updatePipelineState(3, 3, 0), 0);
+    EXPECT_EQ(queue.updatePipelineState(2, 2, 0), 1);
+    EXPECT_TRUE(ticket->admitted);
+}
+
+TEST(LLMAdmissionQueue, UnknownPriorityClass) {
+    LLMAdmissionLimits limits;
+    limits.priorityClasses = {{"interactive", 4}, {"batch", 1}};
+    LLMAdmissionQueue queue(limits);
+    EXPECT_EQ(queue.getDefaultPriorityClass(), "interactive");
+    EXPECT_TRUE(queue.hasPriorityClass("batch"));
+    EXPECT_FALSE(queue.hasPriorityClass(LLMAdmissionQueue::DEFAULT_PRIORITY_CLASS));
+    EXPECT_EQ(queue.enqueue(10, "unknown"), nullptr);
+}
+
+TEST(LLMAdmissionQueue, AdmitsClassesProportionallyToWeights) {
+    LLMAdmissionLimits limits;
+    limits.maxPipelineRequests = 1;
+    limits.priorityClasses = {{"interactive", 3}, {"batch", 1}};
+    LLMAdmissionQueue queue(limits);
+    queue.updatePipelineState(1, 0, 0);
+    std::vector<std::shared_ptr<LLMAdmissionQueue::Ticket>> batch, interactive;
+    for (int i = 0; i < 8; ++i) {
+        batch.push_back(queue.enqueue(10, "batch"));
+        interactive.push_back(queue.enqueue(10, "interactive"));
+    }
+    // single request is admitted after each step since pipeline has room for one more request
+    size_t admitted = 0;
+    for (int i = 0; i < 8; ++i) {
+        admitted += queue.updatePipelineState(0, 0, 0);
+    }
+    EXPECT_EQ(admitted, 8);
+    auto isAdmitted = [](const auto& ticket) { return ticket->admitted; };
+    EXPECT_EQ(std::count_if(interactive.begin(), interactive.end(), isAdmitted), 6);
+    EXPECT_EQ(std::count_if(batch.begin(), batch.end(), isAdmitted), 2);
+}
+
+TEST(LLMAdmissionQueue, AdmitsTenantsInRoundRobinOrder) {
+    LLMAdmissionLimits limits;
+    limits.maxPipelineRequests = 1;
+    LLMAdmissionQueue queue(limits);
+    queue.updatePipelineState(1, 0, 0);
+    std::vector<std::shared_ptr<LLMAdmissionQueue::Ticket>> tenantA, tenantB;
+    for (int i = 0; i < 3; ++i) {
+        tenantA.push_back(queue.enqueue(10, LLMAdmissionQueue::DEFAULT_PRIORITY_CLASS, "a"));
+    }
+    tenantB.push_back(queue.enqueue(10, LLMAdmissionQueue::DEFAULT_PRIORITY_CLASS, "b"));
+    EXPECT_EQ(queue.updatePipelineState(0, 0, 0), 1);
+    EXPECT_TRUE(tenantA[0]->admitted);
+    EXPECT_EQ(queue.updatePipelineState(0, 0, 0), 1);
+    EXPECT_TRUE(tenantB[0]->admitted);
+    EXPECT_FALSE(tenantA[1]->admitted);
+}
+
+TEST(LLMAdmissionQueue, SplitsLimitsAmongPriorityClasses) {
+    LLMAdmissionLimits limits;
+    limits.maxWaitingRequests = 4;
+    limits.priorityClasses = {{"interactive", 3}, {"batch", 1}};
+    LLMAdmissionQueue queue(limits);
+    queue.updatePipelineState(2, 1, 0);
+    ASSERT_NE(queue.enqueue(10, "batch"), nullptr);
+    EXPECT_EQ(queue.enqueue(10, "batch"), nullptr);
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_NE(queue.enqueue(10, "interactive"), nullptr);
+    }
+    EXPECT_EQ(queue.enqueue(10, "interactive"), nullptr);
+}
@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <memory>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "src/llm/io_processing/chat_template/render_cache.hpp"
+#include "src/metrics/metric_config.hpp"
+#include "src/metrics/metric_registry.hpp"
+#include "src/model_metric_reporter.hpp"
+
+using namespace ovms;
+using namespace std::chrono_literals;
+
+TEST(ChatTemplateRenderCache, ReturnsRenderedPromptOfTheSameRequestBody) {
+    ChatTemplateRenderCache cache(1024);
+    std::string output;
+    const std::string body = R"({"messages":[{"role":"user","content":"hi"}]})";
+    EXPECT_FALSE(cache.get(body, output));
+    cache.put(body, "<user>hi</user>", 300us);
+    ASSERT_TRUE(cache.get(body, output));
+    EXPECT_EQ(output, "<user>hi</user>");
+    ASSERT_TRUE(cache.get(body, output));
+    EXPECT_FALSE(cache.get(R"({"messages":[{"role":"user","content":"hi!"}]})", output));
+    EXPECT_EQ(cache.getHits(), 2);
+    EXPECT_EQ(cache.getMisses(), 2);
+    EXPECT_EQ(cache.getRenderTimeSaved(), 600us);
+}
+
+TEST(ChatTemplateRenderCache, EvictsLeastRecentlyUsedEntries) {
+    // each entry takes 10 bytes
+    ChatTemplateRenderCache cache(30);
+    cache.put("aaaaa", "AAAAA", 1us);
+    cache.put("bbbbb", "BBBBB", 1us);
+    cache.put("ccccc", "CCCCC", 1us);
+    EXPECT_EQ(cache.getEntriesCount(), 3);
+    EXPECT_EQ(cache.getSizeBytes(), 30);
+    std::string output;
+    ASSERT_TRUE(cache.get("aaaaa", output));
+    cache.put("ddddd", "DDDDD", 1us);
+    EXPECT_EQ(cache.getEntriesCount(), 3);
+    EXPECT_FALSE(cache.get("bbbbb", output));
+    EXPECT_TRUE(cache.get("aaaaa", output));
+    EXPECT_TRUE(cache.get("ccccc", output));
+    EXPECT_TRUE(cache.get("ddddd", output));
+    // larger entry evicts as many entries as needed
+    cache.put("eeeeeeeeee", "EEEEEEEEEE", 1us);
+    EXPECT_EQ(cache.getEntriesCount(), 2);
+    EXPECT_EQ(cache.getSizeBytes(), 30);
+    EXPECT_FALSE(cache.get("aaaaa", output));
+    EXPECT_FALSE(cache.get("ccccc", output));
+    EXPECT_TRUE(cache.get("ddddd", output));
+}
+
+TEST(ChatTemplateRenderCache, DoesNotStoreEntryLargerThanCapacity) {
+    ChatTemplateRenderCache cache(10);
+    cache.put("aaaaa", "AAAAA", 1us);
+    cache.put("bbbbbb", "BBBBBB", 1us);
+    EXPECT_EQ(cache.getEntriesCount(), 1);
+    std::string output;
+    EXPECT_TRUE(cache.get("aaaaa", output));
+    EXPECT_FALSE(cache.get("bbbbbb", output));
+}
+
+TEST(ChatTemplateRenderCache, KeepsFirstRenderingOfTheSameRequestBody) {
+    ChatTemplateRenderCache cache(100);
+    cache.put("aaaaa", "AAAAA", 5us);
+    cache.put("aaaaa", "AAAAA", 7us);
+    EXPECT_EQ(cache.getEntriesCount(), 1);
+    EXPECT_EQ(cache.getSizeBytes(), 10);
+    std::string output;
+    ASSERT_TRUE(cache.get("aaaaa", output));
+    EXPECT_EQ(cache.getRenderTimeSaved(), 5us);
+}
+
+TEST(ChatTemplateRenderCache, ReportsMetrics) {
+    MetricRegistry registry;
+    MetricConfig metricConfig;
+    ASSERT_TRUE(metricConfig.loadFromCLIString(true, METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_HITS + ", " + METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_MISSES + ", " + METRIC_NAME_LLM_CHAT_TEMPLATE_RENDER_TIME_SAVED).ok());
+    MediapipeServableMetricReporter reporter(&metricConfig, &registry, "example_graph_name");
+    ChatTemplateRenderCache cache(100);
+    cache.setMetricReporter(reporter.createLLMNodeMetricReporter("llm_node"));
+    std::string output;
+    EXPECT_FALSE(cache.get("aaaaa", output));
+    cache.put("aaaaa", "AAAAA", 250us);
+    EXPECT_TRUE(cache.get("aaaaa", output));
+    EXPECT_TRUE(cache.get("aaaaa", output));
+    auto metrics = registry.collect();
+    EXPECT_THAT(metrics, testing::HasSubstr(METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_HITS + std::string("{name=\"example_graph_name\",node=\"llm_node\"} 2")));
+    EXPECT_THAT(metrics, testing::HasSubstr(METRIC_NAME_LLM_CHAT_TEMPLATE_CACHE_MISSES + std::string("{name=\"example_graph_name\",node=\"llm_node\"} 1")));
+    EXPECT_THAT(metrics, testing::HasSubstr(METRIC_NAME_LLM_CHAT_TEMPLATE_RENDER_TIME_SAVED + std::string("{name=\"example_graph_name\",node=\"llm_node\"} 500")));
+}
@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "src/llm/language_model/continuous_batching/replica_router.hpp"
+
+using namespace ovms;
+
+TEST(LLMReplicaRouter, RoutesToReplicaWithLeastOutstandingTokens) {
+    auto router = std::make_shared<LLMReplicaRouter>(3, 0, 0);
+    auto first = router->route(std::nullopt, 100);
+    auto second = router->route(std::nullopt, 50);
+    auto third = router->route(std::nullopt, 10);
+    EXPECT_EQ(first->getReplica(), 0);
+    EXPECT_EQ(second->getReplica(), 1);
+    EXPECT_EQ(third->getReplica(), 2);
+    auto fourth = router->route(std::nullopt, 30);
+    EXPECT_EQ(fourth->getReplica(), 2);
+    EXPECT_EQ(router->getOutstandingTokens(2), 40);
+    EXPECT_EQ(router->getOutstandingRequests(2), 2);
+    auto fifth = router->route(std::nullopt, 10);
+    EXPECT_EQ(fifth->getReplica(), 2);
+    // ties are broken by the number of requests
+    auto sixth = router->route(std::nullopt, 0);
+    EXPECT_EQ(sixth->getReplica(), 1);
+}
+
+TEST(LLMReplicaRouter, ReleasesTokensWhenRouteIsDestroyed) {
+    auto router = std::make_shared<LLMReplicaRouter>(2, 0, 0);
+    auto route = router->route(std::nullopt, 100);
+    EXPECT_EQ(router->getOutstandingTokens(0), 100);
+    route.reset();
+    EXPECT_EQ(router->getOutstandingTokens(0), 0);
+    EXPECT_EQ(router->getOutstandingRequests(0), 0);
+}
+
+TEST(LLMReplicaRouter, PrefixHash) {
+    std::vector<int64_t> prompt{1, 2, 3, 4, 5};
+    std::vector<int64_t> samePrefix{1, 2, 3, 4, 6};
+    std::vector<int64_t> otherPrefix{1, 2, 7, 4, 5};
+    auto router = std::make_shared<LLMReplicaRouter>(2, 4, 0);
+    EXPECT_EQ(router->getPrefixHash(prompt.data(), 0), std::nullopt);
+    EXPECT_EQ(router->getPrefixHash(prompt.data(), prompt.size()), router->getPrefixHash(samePrefix.data(), samePrefix.size()));
+    EXPECT_NE(router->getPrefixHash(prompt.data(), prompt.size()), router->getPrefixHash(otherPrefix.data(), otherPrefix.size()));
+    EXPECT_NE(router->getPrefixHash(prompt.data(), 3), router->getPrefixHash(prompt.data(), prompt.size()));
+    auto disabled = std::make_shared<LLMReplicaRouter>(2, 0, 0);
+    EXPECT_EQ(disabled->getPrefixHash(prompt.data(), prompt.size()), std::nullopt);
+}
+
+TEST(LLMReplicaRouter, RoutesSamePrefixToTheSameReplica) {
+    auto router = std::make_shared<LLMReplicaRouter>(2, 4, 100);
+    auto first = router->route(1, 50);
+    auto other = router->route(2, 10);
+    EXPECT_FALSE(first->isAffinityHit());
+    EXPECT_NE(first->getReplica(), other->getReplica());
+    // least loaded replica is the other one, but the difference is within tolerance
+    auto second = router->route(1, 10);
+    EXPECT_TRUE(second->isAffinityHit());
+    EXPECT_EQ(second->getReplica(), first->getReplica());
+}
+
+TEST(LLMReplicaRouter, IgnoresAffinityOfOverloadedReplica) {
+    auto router = std::make_shared<LLMReplicaRouter>(2, 4, 100);
+    auto first = router->route(1, 500);
+    auto second = router->route(1, 10);
+    EXPECT_FALSE(second->isAffinityHit());
+    EXPECT_NE(second->getReplica(), first->getReplica());
+    // the most recent replica is remembered for the prefix
+    first.reset();
+    auto third = router->route(1, 10);
+    EXPECT_TRUE(third->isAffinityHit());
+    EXPECT_EQ(third->getReplica(), second->getReplica());
+}
+
+TEST(LLMReplicaRouter, ForgetsTheOldestPrefixes) {
+    auto router = std::make_shared<LLMReplicaRouter>(2, 4, 1000);
+    router->route(0, 10);
+    for (uint64_t prefix = 1; prefix <= LLMReplicaRouter::AFFINITY_CAPACITY; ++prefix) {
+        router->route(prefix, 0);
+    }
+    EXPECT_FALSE(router->route(0, 0)->isAffinityHit());
+    EXPECT_TRUE(router->route(LLMReplicaRouter::AFFINITY_CAPACITY, 0)->isAffinityHit());
+}
@@ -4431,6 +4431,75 @@ node: {
     EXPECT_EQ(def.getMediapipeGraphConfig().getInitialQueueSize(), 4);
 }
 
+TEST(MediapipeGraphQueueSizeDirective, NoMinSizeDirectiveKeepsFixedSize) {
+    EnvGuard guard;
+    guard.unset("OVMS_GRAPH_QUEUE_OFF");
+    std::string pbtxt = makePbtxtWithDirective("# OVMS_GRAPH_QUEUE_MAX_SIZE: 1");
+    ovms::MediapipeGraphConfig mgc;
+    DummyMediapipeGraphDefinition def("test", mgc, pbtxt);
+    ovms::ModelManager manager;
+    auto status = def.validate(manager);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_EQ(def.getMediapipeGraphConfig().getGraphQueueMinSize(), 1);
+    EXPECT_EQ(def.getMediapipeGraphConfig().getGraphQueueIdleTimeoutMs(), ovms::MediapipeGraphConfig::DEFAULT_GRAPH_QUEUE_IDLE_TIMEOUT_MS);
+}
+
+TEST(MediapipeGraphQueueSizeDirective, MinSizeAndIdleTimeout) {
+    unsigned int maxThreads = std::thread::hardware_concurrency();
+    if (maxThreads < 2) {
+        GTEST_SKIP() << "Elastic graph queue requires at least 2 hardware threads";
+    }
+    EnvGuard guard;
+    guard.unset("OVMS_GRAPH_QUEUE_OFF");
+    std::string pbtxt = makePbtxtWithDirective("# OVMS_GRAPH_QUEUE_MAX_SIZE: 2\n# OVMS_GRAPH_QUEUE_MIN_SIZE: 1\n# OVMS_GRAPH_QUEUE_IDLE_TIMEOUT_MS: 500");
+    ovms::MediapipeGraphConfig mgc;
+    DummyMediapipeGraphDefinition def("test", mgc, pbtxt);
+    ovms::ModelManager manager;
+    auto status = def.validate(manager);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_EQ(def.getMediapipeGraphConfig().getInitialQueueSize(), 2);
+    EXPECT_EQ(def.getMediapipeGraphConfig().getGraphQueueMinSize(), 1);
+    EXPECT_EQ(def.getMediapipeGraphConfig().getGraphQueueIdleTimeoutMs(), 500);
+}
+
+TEST(MediapipeGraphQueueSizeDirective, MinSizeAboveMaxSizeClamped) {
+    EnvGuard guard;
+    guard.unset("OVMS_GRAPH_QUEUE_OFF");
+    std::string pbtxt = makePbtxtWithDirective("# OVMS_GRAPH_QUEUE_MAX_SIZE: 1\n# OVMS_GRAPH_QUEUE_MIN_SIZE: 8");
+    ovms::MediapipeGraphConfig mgc;
+    DummyMediapipeGraphDefinition def("test", mgc, pbtxt);
+    ovms::ModelManager manager;
+    auto status = def.validate(manager);
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_EQ(def.getMediapipeGraphConfig().getGraphQueueMinSize(), 1);
+}
+
+TEST(MediapipeGraphQueueSizeDirective, InvalidMinSizeRejected) {
+    EnvGuard guard;
+    guard.unset("OVMS_GRAPH_QUEUE_OFF");
+    for (const std::string value : {"0", "-1", "abc"}) {
+        std::string pbtxt = makePbtxtWithDirective("# OVMS_GRAPH_QUEUE_MAX_SIZE: 1\n# OVMS_GRAPH_QUEUE_MIN_SIZE: " + value);
+        ovms::MediapipeGraphConfig mgc;
+        DummyMediapipeGraphDefinition def("test", mgc, pbtxt);
+        ovms::ModelManager manager;
+        auto status = def.validate(manager);
+        EXPECT_EQ(status, ovms::StatusCode::MEDIAPIPE_GRAPH_CONFIG_FILE_INVALID) << value;
+    }
+}
+
+TEST(MediapipeGraphQueueSizeDirective, InvalidIdleTimeoutRejected) {
+    EnvGuard guard;
+    guard.unset("OVMS_GRAPH_QUEUE_OFF");
+    for (const std::string value : {"0", "-1", "abc"}) {
+        std::string pbtxt = makePbtxtWithDirective("# OVMS_GRAPH_QUEUE_MAX_SIZE: 1\n# OVMS_GRAPH_QUEUE_IDLE_TIMEOUT_MS: " + value);
+        ovms::MediapipeGraphConfig mgc;
+        DummyMediapipeGraphDefinition def("test", mgc, pbtxt);
+        ovms::ModelManager manager;
+        auto status = def.validate(manager);
+        EXPECT_EQ(status, ovms::StatusCode::MEDIAPIPE_GRAPH_CONFIG_FILE_INVALID) << value;
+    }
+}
+
 // --- Graph queue reinit guard tests ---
 
 class UnaryQueueReinitTest : public ::testing::Test {
@@ -4484,8 +4553,8 @@ TEST_F(UnaryQueueReinitTest, GraphIsReinitializedAfterCalculatorError) {
         ASSERT_FALSE(status.ok());
         EXPECT_EQ(status.getCode(), StatusCode::MEDIAPIPE_EXECUTION_ERROR);
     }
-    // Executor destroyed → GraphIdGuard returns graph to pool.
-    // The reinit guard rebuilt the graph before returning the error.
+    // Executor destroyed → GraphIdGuard hands errored graph to the queue.
+    // Graph is rebuilt in background and returned to pool afterwards.
     // Second request with valid (positive) input should succeed.
     {
         GraphIdGuard guard(queue);
@@ -4500,3 +4569,103 @@ TEST_F(UnaryQueueReinitTest, GraphIsReinitializedAfterCalculatorError) {
         ASSERT_TRUE(status.ok());
     }
 }
+
+TEST_F(UnaryQueueReinitTest, ErroredGraphIsReplacedWithSpareGraph) {
+    queue->setSpareGraphsCount(1);
+    // spare graph is built in background
+    ASSERT_TRUE(queue->waitForSpareGraphs(std::chrono::seconds(5)));
+    ASSERT_EQ(queue->getSpareGraphsCount(), 1);
+    KFSRequest request;
+    KFSResponse response;
+    {
+        GraphIdGuard guard(queue);
+        MediapipeGraphExecutor executor{
+            name, version, config,
+            {{"in", mediapipe_packet_type_enum::OVTENSOR}},
+            {{"out", mediapipe_packet_type_enum::OVTENSOR}},
+            {"in"}, {"out"}, *sidePackets, nullptr, reporter.get(),
+            std::move(guard)};
+        prepareInferRequest(request, -1.0f);
+        auto status = executor.infer<KFSRequest, KFSResponse>(&request, &response, executionContext);
+        ASSERT_FALSE(status.ok());
+    }
+    // spare graph took the slot of errored graph, no need to wait for rebuild
+    auto id = queue->tryToGetIdleStream();
+    ASSERT_TRUE(id.has_value());
+    queue->returnStream(id.value());
+    {
+        GraphIdGuard guard(queue);
+        MediapipeGraphExecutor executor{
+            name, version, config,
+            {{"in", mediapipe_packet_type_enum::OVTENSOR}},
+            {{"out", mediapipe_packet_type_enum::OVTENSOR}},
+            {"in"}, {"out"}, *sidePackets, nullptr, reporter.get(),
+            std::move(guard)};
+        prepareInferRequest(request, 2.0f);
+        auto status = executor.infer<KFSRequest, KFSResponse>(&request, &response, executionContext);
+        ASSERT_TRUE(status.ok());
+    }
+    // errored graph is rebuilt in background and becomes spare
+    ASSERT_TRUE(queue->waitForSpareGraphs(std::chrono::seconds(5)));
+    EXPECT_EQ(queue->getSpareGraphsCount(), 1);
+}
+
+TEST(ElasticGraphQueue, GrowsUnderLoadAndEvictsIdleGraphs) {
+    const std::string pbTxt{R"(
+input_stream: "in"
+output_stream: "out"
+node {
+  calculator: "ErrorOnNegativeTestCalculator"
+  input_stream: "in"
+  output_stream: "out"
+}
+    )"};
+    ::mediapipe::CalculatorGraphConfig config;
+    ASSERT_TRUE(::google::protobuf::TextFormat::ParseFromString(pbTxt, &config));
+    auto sidePackets = std::make_shared<GraphSidePackets>();
+    // idle timeout long enough so that eviction thread does not interfere with the test
+    auto queue = std::make_shared<GraphQueue>(config, sidePackets, 1, 3, std::chrono::hours(1));
+    ASSERT_TRUE(queue->isElastic());
+    EXPECT_EQ(queue->getGraphsCount(), 1);
+    {
+        GraphIdGuard first(queue);
+        GraphIdGuard second(queue);
+        GraphIdGuard third(queue);
+        EXPECT_EQ(queue->getGraphsCount(), 3);
+        EXPECT_NE(first.id, second.id);
+        EXPECT_NE(second.id, third.id);
+        EXPECT_NE(first.id, third.id);
+        // graphs in use are never evicted
+        EXPECT_EQ(queue->evictIdleGraphs(), 0);
+    }
+    // peak usage of previous interval is kept
+    EXPECT_EQ(queue->evictIdleGraphs(), 0);
+    EXPECT_EQ(queue->getGraphsCount(), 3);
+    // no load in last interval, pool shrinks to minimal size
+    EXPECT_EQ(queue->evictIdleGraphs(), 2);
+    EXPECT_EQ(queue->getGraphsCount(), 1);
+    {
+        GraphIdGuard first(queue);
+        GraphIdGuard second(queue);
+        EXPECT_EQ(queue->getGraphsCount(), 2);
+    }
+}
+
+TEST(ElasticGraphQueue, FixedSizeQueueIsNotElastic) {
+    const std::string pbTxt{R"(
+input_stream: "in"
+output_stream: "out"
+node {
+  calculator: "ErrorOnNegativeTestCalculator"
+  input_stream: "in"
+  output_stream: "out"
+}
+    )"};
+    ::mediapipe::CalculatorGraphConfig config;
+    ASSERT_TRUE(::google::protobuf::TextFormat::ParseFromString(pbTxt, &config));
+    auto queue = std::make_shared<GraphQueue>(config, std::make_shared<GraphSidePackets>(), 2);
+    EXPECT_FALSE(queue->isElastic());
+    EXPECT_EQ(queue->getGraphsCount(), 2);
+    EXPECT_EQ(queue->evictIdleGraphs(), 0);
+    EXPECT_EQ(queue->getGraphsCount(), 2);
+}
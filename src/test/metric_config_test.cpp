@@ -520,6 +520,105 @@ TEST_F(ModelMetricReporterTest, MetricReporterConstructorTest) {
     ASSERT_TRUE(reporter5.requestFailGrpcModelMetadata != nullptr);
 }
 
+TEST_F(ModelMetricReporterTest, MediapipeCalculatorMetricReporter) {
+    MetricRegistry registry;
+    MetricConfig metricConfig;
+    MediapipeServableMetricReporter disabledReporter(&metricConfig, &registry, "example_graph_name");
+    ASSERT_FALSE(disabledReporter.hasCalculatorMetrics());
+    ASSERT_EQ(disabledReporter.getCalculatorMetricReporter("calculator"), nullptr);
+
+    std::stringstream ss;
+    ss << METRIC_NAME_GRAPH_CALCULATOR_PROCESS_TIME << ", " << METRIC_NAME_GRAPH_CALCULATOR_INPUT_WAIT_TIME;
+    ASSERT_TRUE(metricConfig.loadFromCLIString(true, ss.str()).ok());
+    MediapipeServableMetricReporter reporter(&metricConfig, &registry, "example_graph_name");
+    ASSERT_TRUE(reporter.hasCalculatorMetrics());
+    auto* calculatorReporter = reporter.getCalculatorMetricReporter("calculator");
+    ASSERT_NE(calculatorReporter, nullptr);
+    ASSERT_NE(calculatorReporter->processTime, nullptr);
+    ASSERT_NE(calculatorReporter->inputWaitTime, nullptr);
+    ASSERT_EQ(reporter.getCalculatorMetricReporter("calculator"), calculatorReporter);
+    ASSERT_NE(reporter.getCalculatorMetricReporter("other_calculator"), calculatorReporter);
+
+    calculatorReporter->processTime->observe(100);
+    auto metrics = registry.collect();
+    ASSERT_THAT(metrics, testing::HasSubstr(METRIC_NAME_GRAPH_CALCULATOR_PROCESS_TIME + std::string("_count{calculator=\"calculator\",name=\"example_graph_name\"} 1")));
+}
+
+TEST_F(ModelMetricReporterTest, LLMNodeMetricReporter) {
+    MetricRegistry registry;
+    MetricConfig metricConfig;
+    MediapipeServableMetricReporter disabledReporter(&metricConfig, &registry, "example_graph_name");
+    ASSERT_FALSE(disabledReporter.hasLLMMetrics());
+    ASSERT_EQ(disabledReporter.createLLMNodeMetricReporter("llm_node"), nullptr);
+
+    std::stringstream ss;
+    ss << METRIC_NAME_LLM_TIME_TO_FIRST_TOKEN << ", " << METRIC_NAME_LLM_GENERATED_TOKENS << ", " << METRIC_NAME_LLM_KV_CACHE_USAGE_PERCENT;
+    ASSERT_TRUE(metricConfig.loadFromCLIString(true, ss.str()).ok());
+    MediapipeServableMetricReporter reporter(&metricConfig, &registry, "example_graph_name");
+    ASSERT_TRUE(reporter.hasLLMMetrics());
+    auto nodeReporter = reporter.createLLMNodeMetricReporter("llm_node");
+    ASSERT_NE(nodeReporter, nullptr);
+    ASSERT_NE(nodeReporter->timeToFirstToken, nullptr);
+    ASSERT_NE(nodeReporter->generatedTokens, nullptr);
+    ASSERT_NE(nodeReporter->kvCacheUsagePercent, nullptr);
+    ASSERT_EQ(nodeReporter->timePerOutputToken, nullptr);
+    ASSERT_EQ(nodeReporter->runningRequests, nullptr);
+
+    nodeReporter->generatedTokens->increment(5);
+    nodeReporter->kvCacheUsagePercent->set(12.5);
+    auto metrics = registry.collect();
+    ASSERT_THAT(metrics, testing::HasSubstr(METRIC_NAME_LLM_GENERATED_TOKENS + std::string("{name=\"example_graph_name\",node=\"llm_node\"} 5")));
+    ASSERT_THAT(metrics, testing::HasSubstr(METRIC_NAME_LLM_KV_CACHE_USAGE_PERCENT + std::string("{name=\"example_graph_name\",node=\"llm_node\"} 12.5")));
+}
+
+TEST_F(ModelMetricReporterTest, LLMNodeClassTimeToFirstToken) {
+    MetricRegistry registry;
+    MetricConfig metricConfig;
+    ASSERT_TRUE(metricConfig.loadFromCLIString(true, METRIC_NAME_LLM_CLASS_TIME_TO_FIRST_TOKEN).ok());
+    MediapipeServableMetricReporter reporter(&metricConfig, &registry, "example_graph_name");
+    ASSERT_TRUE(reporter.hasLLMMetrics());
+    auto nodeReporter = reporter.createLLMNodeMetricReporter("llm_node");
+    ASSERT_NE(nodeReporter, nullptr);
+    auto interactive = nodeReporter->getClassTimeToFirstToken("interactive");
+    ASSERT_NE(interactive, nullptr);
+    ASSERT_EQ(nodeReporter->getClassTimeToFirstToken("interactive"), interactive);
+    ASSERT_NE(nodeReporter->getClassTimeToFirstToken("batch"), interactive);
+    interactive->observe(1500);
+    auto metrics = registry.collect();
+    ASSERT_THAT(metrics, testing::HasSubstr(METRIC_NAME_LLM_CLASS_TIME_TO_FIRST_TOKEN + std::string("_count{name=\"example_graph_name\",node=\"llm_node\",priority_class=\"interactive\"} 1")));
+    ASSERT_THAT(metrics, testing::HasSubstr(METRIC_NAME_LLM_CLASS_TIME_TO_FIRST_TOKEN + std::string("_count{name=\"example_graph_name\",node=\"llm_node\",priority_class=\"batch\"} 0")));
+}
+
+TEST_F(ModelMetricReporterTest, LLMNodeReplicaMetricReporter) {
+    MetricRegistry registry;
+    MetricConfig metricConfigWithoutReplicas;
+    ASSERT_TRUE(metricConfigWithoutReplicas.loadFromCLIString(true, METRIC_NAME_LLM_TIME_TO_FIRST_TOKEN).ok());
+    MediapipeServableMetricReporter reporterWithoutReplicas(&metricConfigWithoutReplicas, &registry, "example_graph_name");
+    ASSERT_EQ(reporterWithoutReplicas.createLLMNodeMetricReporter("llm_node")->getReplicaMetricReporter(0), nullptr);
+
+    MetricConfig metricConfig;
+    std::stringstream ss;
+    ss << METRIC_NAME_LLM_REPLICA_ROUTED_REQUESTS << ", " << METRIC_NAME_LLM_REPLICA_OUTSTANDING_TOKENS;
+    ASSERT_TRUE(metricConfig.loadFromCLIString(true, ss.str()).ok());
+    MetricRegistry replicaRegistry;
+    MediapipeServableMetricReporter reporter(&metricConfig, &replicaRegistry, "example_graph_name");
+    ASSERT_TRUE(reporter.hasLLMMetrics());
+    auto nodeReporter = reporter.createLLMNodeMetricReporter("llm_node");
+    ASSERT_NE(nodeReporter, nullptr);
+    auto replicaReporter = nodeReporter->getReplicaMetricReporter(1);
+    ASSERT_NE(replicaReporter, nullptr);
+    ASSERT_EQ(nodeReporter->getReplicaMetricReporter(1), replicaReporter);
+    ASSERT_NE(nodeReporter->getReplicaMetricReporter(0), replicaReporter);
+    ASSERT_NE(replicaReporter->routedRequests, nullptr);
+    ASSERT_NE(replicaReporter->outstandingTokens, nullptr);
+    ASSERT_EQ(replicaReporter->kvCacheUsagePercent, nullptr);
+    replicaReporter->routedRequests->increment();
+    replicaReporter->outstandingTokens->set(300);
+    auto metrics = replicaRegistry.collect();
+    ASSERT_THAT(metrics, testing::HasSubstr(METRIC_NAME_LLM_REPLICA_ROUTED_REQUESTS + std::string("{name=\"example_graph_name\",node=\"llm_node\",replica=\"1\"} 1")));
+    ASSERT_THAT(metrics, testing::HasSubstr(METRIC_NAME_LLM_REPLICA_OUTSTANDING_TOKENS + std::string("{name=\"example_graph_name\",node=\"llm_node\",replica=\"1\"} 300")));
+}
+
 class MetricsCli : public ::testing::Test {
 };
 
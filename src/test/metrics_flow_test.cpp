@@ -16,19 +16,25 @@
 #include <atomic>
 #include <condition_variable>
 #include <fstream>
+#include <functional>
+#include <future>
 #include <mutex>
 #include <optional>
 #include <set>
 #include <sstream>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "../config.hpp"
+#include "../execution_context.hpp"
 #include "../http_rest_api_handler.hpp"
 #include "../kfs_frontend/kfs_grpc_inference_service.hpp"
+#include "../modelinstance.hpp"
+#include "../ovinferrequestsqueue.hpp"
 #include "src/metrics/metric_config.hpp"
 #include "src/metrics/metric_module.hpp"
 #include "../precision.hpp"
@@ -290,6 +296,94 @@ TEST_F(MetricFlowTest, GrpcModelInfer) {
     EXPECT_THAT(server.collect(), Not(HasSubstr(METRIC_NAME_INFER_REQ_QUEUE_SIZE + std::string{"{name=\""} + dagName + std::string{"\",version=\"1\"} "})));
 }
 
+TEST_F(MetricFlowTest, GrpcModelInferWithCallback) {
+    KFSInferenceServiceImpl impl(server);
+    ::KFSRequest request;
+    ::KFSResponse response;
+    auto inferWithCallback = [&impl, &request, &response]() {
+        std::promise<Status> completed;
+        auto future = completed.get_future();
+        impl.ModelInferWithCallbackImpl(nullptr, &request, &response, ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer},
+            [&completed](const Status& status, ServableMetricReporter* reporter) {
+                completed.set_value(status);
+            });
+        return future.get();
+    };
+
+    for (int i = 0; i < numberOfSuccessRequests; i++) {
+        request.Clear();
+        response.Clear();
+        inputs_info_t inputsMeta{{DUMMY_MODEL_INPUT_NAME, {DUMMY_MODEL_SHAPE, correctPrecision}}};
+        preparePredictRequest(request, inputsMeta);
+        request.mutable_model_name()->assign(modelName);
+        request.set_id("request_" + std::to_string(i));
+        ASSERT_EQ(inferWithCallback(), StatusCode::OK);
+        EXPECT_EQ(response.id(), request.id());
+        ASSERT_EQ(response.outputs_size(), 1);
+        EXPECT_EQ(response.outputs(0).name(), DUMMY_MODEL_OUTPUT_NAME);
+    }
+
+    for (int i = 0; i < numberOfFailedRequests; i++) {
+        request.Clear();
+        response.Clear();
+        inputs_info_t inputsMeta{{DUMMY_MODEL_INPUT_NAME, {DUMMY_MODEL_SHAPE, wrongPrecision}}};
+        preparePredictRequest(request, inputsMeta);
+        request.mutable_model_name()->assign(modelName);
+        ASSERT_EQ(inferWithCallback(), StatusCode::INVALID_PRECISION);
+    }
+
+    for (int i = 0; i < numberOfSuccessRequests; i++) {
+        request.Clear();
+        response.Clear();
+        inputs_info_t inputsMeta{{DUMMY_MODEL_INPUT_NAME, {ovms::signed_shape_t{dynamicBatch, 1, DUMMY_MODEL_INPUT_SIZE}, correctPrecision}}};
+        preparePredictRequest(request, inputsMeta);
+        request.mutable_model_name()->assign(dagName);
+        ASSERT_EQ(inferWithCallback(), StatusCode::OK);
+    }
+
+    checkRequestsCounter(server.collect(), METRIC_NAME_REQUESTS_SUCCESS, modelName, 1, "gRPC", "ModelInfer", "KServe", dynamicBatch * numberOfSuccessRequests + numberOfSuccessRequests);
+    checkRequestsCounter(server.collect(), METRIC_NAME_REQUESTS_FAIL, modelName, 1, "gRPC", "ModelInfer", "KServe", numberOfFailedRequests);
+    checkRequestsCounter(server.collect(), METRIC_NAME_REQUESTS_SUCCESS, dagName, 1, "gRPC", "ModelInfer", "KServe", numberOfSuccessRequests);
+    EXPECT_THAT(server.collect(), HasSubstr(METRIC_NAME_INFERENCE_TIME + std::string{"_count{name=\""} + modelName + std::string{"\",version=\"1\"} "} + std::to_string(dynamicBatch * numberOfSuccessRequests + numberOfSuccessRequests)));
+}
+
+TEST_F(MetricFlowTest, GrpcModelInferWithCallbackDoesNotBlockWaitingForInferRequest) {
+    KFSInferenceServiceImpl impl(server);
+    auto instance = server.getManager().findModelInstance(modelName);
+    ASSERT_NE(instance, nullptr);
+    auto& inferRequestsQueue = instance->getInferRequestsQueue();
+    std::vector<int> heldStreams;
+    for (size_t i = 0; i < inferRequestsQueue.getStreamsCount(); ++i) {
+        heldStreams.push_back(inferRequestsQueue.acquireIdleStream());
+    }
+    ::KFSRequest request;
+    ::KFSResponse response;
+    inputs_info_t inputsMeta{{DUMMY_MODEL_INPUT_NAME, {DUMMY_MODEL_SHAPE, correctPrecision}}};
+    preparePredictRequest(request, inputsMeta);
+    request.mutable_model_name()->assign(modelName);
+
+    std::promise<Status> completed;
+    auto future = completed.get_future();
+    std::function<void()> scheduledJob;
+    impl.ModelInferWithCallbackImpl(
+        nullptr, &request, &response, ExecutionContext{ExecutionContext::Interface::GRPC, ExecutionContext::Method::ModelInfer},
+        [&completed](const Status& status, ServableMetricReporter* reporter) {
+            completed.set_value(status);
+        },
+        [&scheduledJob](std::function<void()> job) { scheduledJob = std::move(job); });
+    // caller returns while all infer requests are in use, inference is scheduled once one is returned
+    EXPECT_EQ(future.wait_for(std::chrono::milliseconds(0)), std::future_status::timeout);
+    EXPECT_FALSE(scheduledJob);
+    for (int streamId : heldStreams) {
+        inferRequestsQueue.returnStream(streamId);
+    }
+    ASSERT_TRUE(scheduledJob);
+    scheduledJob();
+    ASSERT_EQ(future.get(), StatusCode::OK);
+    ASSERT_EQ(response.outputs_size(), 1);
+    EXPECT_EQ(response.outputs(0).name(), DUMMY_MODEL_OUTPUT_NAME);
+}
+
 #if (MEDIAPIPE_DISABLE == 0)
 TEST_F(MetricFlowTest, GrpcPredictGraphError) {
     KFSInferenceServiceImpl impl(server);
@@ -0,0 +1,85 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <openvino/runtime/core.hpp>
+
+#include "../model_warmup.hpp"
+#include "../modelinstance.hpp"
+#include "../shape.hpp"
+#include "../tensorinfo.hpp"
+#include "test_models_configs.hpp"
+
+using namespace ovms;
+
+TEST(ModelWarmup, StaticShapesCreateSingleShapeSet) {
+    tensor_map_t inputs;
+    inputs["a"] = std::make_shared<const TensorInfo>("a", Precision::FP32, Shape{1, 10});
+    inputs["b"] = std::make_shared<const TensorInfo>("b", Precision::I32, Shape{2, 3});
+    auto shapes = createWarmupShapes(inputs);
+    ASSERT_EQ(shapes.size(), 1);
+    EXPECT_EQ(shapes[0].at("a"), ov::Shape({1, 10}));
+    EXPECT_EQ(shapes[0].at("b"), ov::Shape({2, 3}));
+}
+
+TEST(ModelWarmup, DynamicShapesUseRangeBounds) {
+    tensor_map_t inputs;
+    inputs["a"] = std::make_shared<const TensorInfo>("a", Precision::FP32, Shape{Dimension(1, 8), Dimension::any(), 10});
+    auto shapes = createWarmupShapes(inputs);
+    ASSERT_EQ(shapes.size(), 2);
+    EXPECT_EQ(shapes[0].at("a"), ov::Shape({1, 1, 10}));
+    EXPECT_EQ(shapes[1].at("a"), ov::Shape({8, 1, 10}));
+}
+
+TEST(ModelWarmup, TensorIsZeroFilledWithoutData) {
+    TensorInfo info("a", Precision::I32, Shape{2, 3});
+    auto tensor = createWarmupTensor(info, ov::Shape{2, 3}, "");
+    ASSERT_EQ(tensor.get_element_type(), ov::element::i32);
+    ASSERT_EQ(tensor.get_shape(), ov::Shape({2, 3}));
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        EXPECT_EQ(tensor.data<int32_t>()[i], 0);
+    }
+}
+
+TEST(ModelWarmup, DataIsRepeatedToFillTensor) {
+    TensorInfo info("a", Precision::U8, Shape{1, 5});
+    auto tensor = createWarmupTensor(info, ov::Shape{1, 5}, std::string("\x01\x02", 2));
+    const uint8_t expected[] = {1, 2, 1, 2, 1};
+    for (size_t i = 0; i < tensor.get_size(); ++i) {
+        EXPECT_EQ(tensor.data<uint8_t>()[i], expected[i]) << "index: " << i;
+    }
+}
+
+TEST(ModelWarmup, WarmupTimeIsReportedInModelStatus) {
+    ov::Core ieCore;
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.setNireq(2);
+    config.setWarmupIterations(2);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    EXPECT_EQ(modelInstance.getStatus().getState(), ModelVersionState::AVAILABLE);
+    EXPECT_GT(modelInstance.getStatus().getWarmupTimeUs(), 0);
+}
+
+TEST(ModelWarmup, DisabledByDefault) {
+    ov::Core ieCore;
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, ieCore);
+    ASSERT_EQ(modelInstance.loadModel(DUMMY_MODEL_CONFIG), StatusCode::OK);
+    EXPECT_EQ(modelInstance.getStatus().getWarmupTimeUs(), 0);
+}
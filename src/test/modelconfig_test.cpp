@@ -1377,3 +1377,41 @@ TEST(ModelConfig, ConfigParseNodeWithValidShapeFormatArray) {
     ASSERT_TRUE(shapes.find("input") != shapes.end());
     EXPECT_EQ(shapes["input"].shape, (ovms::Shape{1, 3, 600, 600}));
 }
+
+TEST(ModelConfig, ConfigParseNodeWithDynamicBatching) {
+    std::string config = R"#(
+        {
+        "model_config_list": [
+            {
+                "config": {
+                    "name": "alpha",
+                    "base_path": "/tmp/models/dummy1",
+                    "max_batch_size": 8,
+                    "max_queue_delay_us": 500
+                }
+            }
+        ]
+    }
+    )#";
+
+    adjustConfigForTargetPlatform(config);
+    rapidjson::Document configJson;
+    rapidjson::ParseResult parsingSucceeded = configJson.Parse(config.c_str());
+    ASSERT_EQ(parsingSucceeded.Code(), 0);
+
+    const auto modelConfigList = configJson.FindMember("model_config_list");
+    ASSERT_NE(modelConfigList, configJson.MemberEnd());
+    const auto& configs = modelConfigList->value.GetArray();
+    ASSERT_EQ(configs.Size(), 1);
+    ovms::ModelConfig modelConfig;
+    auto status = modelConfig.parseNode(configs[0]["config"]);
+
+    ASSERT_EQ(status, ovms::StatusCode::OK);
+    EXPECT_EQ(modelConfig.getMaxBatchSize(), 8);
+    EXPECT_EQ(modelConfig.getMaxQueueDelayUs(), 500);
+    EXPECT_TRUE(modelConfig.isDynamicBatchingEnabled());
+
+    ovms::ModelConfig defaultConfig;
+    EXPECT_FALSE(defaultConfig.isDynamicBatchingEnabled());
+    EXPECT_TRUE(modelConfig.isReloadRequired(defaultConfig));
+}
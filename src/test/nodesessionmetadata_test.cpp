@@ -32,15 +32,29 @@ class NodeSessionMetadataTest : public ::testing::Test {};
 
 TEST_F(NodeSessionMetadataTest, GenerateSessionKeyWhenNoSubsessions) {
     NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
-    EXPECT_EQ(meta.getSessionKey(), "");
+    EXPECT_TRUE(meta.getSessionKey().empty());
+    EXPECT_EQ(meta.getSessionKeyString(), "");
 }
 
 TEST_F(NodeSessionMetadataTest, GenerateSubsession) {
     NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
     auto demultiplexedMetas = meta.generateSubsessions("request", 2);
     ASSERT_EQ(demultiplexedMetas.size(), 2);
-    EXPECT_EQ(demultiplexedMetas[0].getSessionKey(), "request_0");
-    EXPECT_EQ(demultiplexedMetas[1].getSessionKey(), "request_1");
+    EXPECT_EQ(demultiplexedMetas[0].getSessionKey(), session_key_t({0}));
+    EXPECT_EQ(demultiplexedMetas[1].getSessionKey(), session_key_t({1}));
+    EXPECT_NE(demultiplexedMetas[0].getSessionKey().hash(), demultiplexedMetas[1].getSessionKey().hash());
+    EXPECT_EQ(demultiplexedMetas[0].getSessionKeyString(), "request_0");
+    EXPECT_EQ(demultiplexedMetas[1].getSessionKeyString(), "request_1");
+}
+
+TEST_F(NodeSessionMetadataTest, GenerateSubsessionsUpToMaxSessionKeyDepth) {
+    NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
+    for (size_t level = 0; level < SessionKey::MAX_DEPTH; ++level) {
+        meta = meta.generateSubsessions("demultiplexer_" + std::to_string(level), 2)[1];
+    }
+    EXPECT_EQ(meta.getSessionKey().size(), SessionKey::MAX_DEPTH);
+    EXPECT_EQ(meta.getSessionKey().prefix(1), session_key_t({1}));
+    EXPECT_THROW(meta.generateSubsessions("one_too_many", 2), std::logic_error);
 }
 
 TEST_F(NodeSessionMetadataTest, GenerateTwoLevelsOfSubsession) {
@@ -55,11 +69,14 @@ TEST_F(NodeSessionMetadataTest, GenerateTwoLevelsOfSubsession) {
         std::move(newLevelMetas.begin(), newLevelMetas.end(), secondLevelMetas.begin() + demMetaId * secondLevelDemultiplexSize);
     }
     for (size_t demMetaId = 0; demMetaId != demultiplexedMetas.size(); ++demMetaId) {
-        EXPECT_EQ(demultiplexedMetas[demMetaId].getSessionKey(), std::string("request_") + std::to_string(demMetaId));
+        EXPECT_EQ(demultiplexedMetas[demMetaId].getSessionKeyString(), std::string("request_") + std::to_string(demMetaId));
+        EXPECT_EQ(demultiplexedMetas[demMetaId].getSessionKey(), session_key_t({static_cast<session_id_t>(demMetaId)}));
     }
     for (size_t demMetaId = 0; demMetaId != firstLevelDemultiplexSize; ++demMetaId) {
         for (size_t demMetaLev2Id = 0; demMetaLev2Id != secondLevelDemultiplexSize; ++demMetaLev2Id) {
-            auto hash = secondLevelMetas[demMetaLev2Id + demMetaId * secondLevelDemultiplexSize].getSessionKey();
+            const auto& secondLevelMeta = secondLevelMetas[demMetaLev2Id + demMetaId * secondLevelDemultiplexSize];
+            EXPECT_EQ(secondLevelMeta.getSessionKey(), session_key_t({static_cast<session_id_t>(demMetaId), static_cast<session_id_t>(demMetaLev2Id)}));
+            auto hash = secondLevelMeta.getSessionKeyString();
             EXPECT_THAT(hash, HasSubstr(std::string("request_") + std::to_string(demMetaId)));
             EXPECT_THAT(hash, HasSubstr(std::string("2ndDemultiplexer_") + std::to_string(demMetaLev2Id)));
         }
@@ -75,7 +92,7 @@ TEST_F(NodeSessionMetadataTest, GenerateThreeLevelsOfSubsession) {
                                      .generateSubsessions("request", firstLevelDemultiplexSize)[2]
                                      .generateSubsessions("extract1st", secondLevelDemultiplexSize)[0]
                                      .generateSubsessions("extract2nd", thirdLevelDemultiplexSize)[2];
-    auto hash = demultiplexedMetaLev3.getSessionKey();
+    auto hash = demultiplexedMetaLev3.getSessionKeyString();
     EXPECT_THAT(hash, HasSubstr("request_2"));
     EXPECT_THAT(hash, HasSubstr("extract1st_0"));
     EXPECT_THAT(hash, HasSubstr("extract2nd_2"));
@@ -89,7 +106,7 @@ TEST_F(NodeSessionMetadataTest, GenerateSubsessionWithEmptyNameShouldThrow) {
 TEST_F(NodeSessionMetadataTest, CanGenerateEmptySubsession) {
     NodeSessionMetadata startMeta{DEFAULT_TEST_CONTEXT};
     auto meta = startMeta.generateSubsessions("someName", 0);
-    EXPECT_EQ(meta.size(), 0) << meta[0].getSessionKey();
+    EXPECT_EQ(meta.size(), 0);
 }
 
 TEST_F(NodeSessionMetadataTest, GenerateTwoSubsessionsWithTheSameNameShouldThrow) {
@@ -108,16 +125,18 @@ TEST_F(NodeSessionMetadataTest, CollapseSubsession1Level) {
                                      .generateSubsessions("request", firstLevelDemultiplexSize)[2]
                                      .generateSubsessions("extract1st", secondLevelDemultiplexSize)[0]
                                      .generateSubsessions("extract2nd", thirdLevelDemultiplexSize)[2];
-    auto hash = demultiplexedMetaLev3.getSessionKey();
+    auto hash = demultiplexedMetaLev3.getSessionKeyString();
     ASSERT_THAT(hash, HasSubstr("request_2"));
     ASSERT_THAT(hash, HasSubstr("extract1st_0"));
     ASSERT_THAT(hash, HasSubstr("extract2nd_2"));
     NodeSessionMetadata metaCollapsedOnExtract1st{DEFAULT_TEST_CONTEXT};
     CollapseDetails collapsingDetails;
     std::tie(metaCollapsedOnExtract1st, collapsingDetails) = demultiplexedMetaLev3.getCollapsedSessionMetadata({"extract2nd"});
-    auto hashCollapsed = metaCollapsedOnExtract1st.getSessionKey();
     // need to ensure that generated collapsed session key before collapsing and after are the same
-    EXPECT_EQ(hashCollapsed, demultiplexedMetaLev3.getSessionKey({std::string("extract2nd")}));
+    EXPECT_EQ(metaCollapsedOnExtract1st.getSessionKey(), demultiplexedMetaLev3.getSessionKey({std::string("extract2nd")}));
+    EXPECT_EQ(metaCollapsedOnExtract1st.getSessionKey(), session_key_t({2, 0}));
+    auto hashCollapsed = metaCollapsedOnExtract1st.getSessionKeyString();
+    EXPECT_EQ(hashCollapsed, demultiplexedMetaLev3.getSessionKeyString({std::string("extract2nd")}));
 
     ASSERT_THAT(hashCollapsed, HasSubstr("request_2"));
     ASSERT_THAT(hashCollapsed, HasSubstr("extract1st_0"));
@@ -137,7 +156,7 @@ TEST_F(NodeSessionMetadataTest, CollapseSubsession1LevelNotInLIFOOrderShouldThro
                                      .generateSubsessions("request", firstLevelDemultiplexSize)[2]
                                      .generateSubsessions("extract1st", secondLevelDemultiplexSize)[0]
                                      .generateSubsessions("extract2nd", thirdLevelDemultiplexSize)[2];
-    auto hash = demultiplexedMetaLev3.getSessionKey();
+    auto hash = demultiplexedMetaLev3.getSessionKeyString();
     ASSERT_THAT(hash, HasSubstr("request_2"));
     ASSERT_THAT(hash, HasSubstr("extract1st_0"));
     ASSERT_THAT(hash, HasSubstr("extract2nd_2"));
@@ -155,7 +174,7 @@ TEST_F(NodeSessionMetadataTest, CollapseSubsessions2LevelsAtOnce) {
                                      .generateSubsessions("request", firstLevelDemultiplexSize)[12]
                                      .generateSubsessions("extract1st", secondLevelDemultiplexSize)[32]
                                      .generateSubsessions("extract2nd", thirdLevelDemultiplexSize)[512];
-    auto hash = demultiplexedMetaLev3.getSessionKey();
+    auto hash = demultiplexedMetaLev3.getSessionKeyString();
     ASSERT_THAT(hash, HasSubstr("request_12"));
     ASSERT_THAT(hash, HasSubstr("extract1st_32"));
     ASSERT_THAT(hash, HasSubstr("extract2nd_512"));
@@ -163,7 +182,8 @@ TEST_F(NodeSessionMetadataTest, CollapseSubsessions2LevelsAtOnce) {
     NodeSessionMetadata metaCollapsed{DEFAULT_TEST_CONTEXT};
     CollapseDetails collapsingDetails;
     std::tie(metaCollapsed, collapsingDetails) = demultiplexedMetaLev3.getCollapsedSessionMetadata({"extract1st", "extract2nd"});
-    auto hashCollapsed = metaCollapsed.getSessionKey();
+    EXPECT_EQ(metaCollapsed.getSessionKey(), session_key_t({12}));
+    auto hashCollapsed = metaCollapsed.getSessionKeyString();
     ASSERT_THAT(hashCollapsed, HasSubstr("request_12"));
     ASSERT_THAT(hashCollapsed, Not(HasSubstr("extract1st")));
     ASSERT_THAT(hashCollapsed, Not(HasSubstr("extract2nd")));
@@ -192,7 +212,8 @@ TEST_F(NodeSessionMetadataTest, GenerateCollapsedSubsessionKey) {
     NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
     auto subsessionMeta = meta.generateSubsessions("request", 2)[0]
                               .generateSubsessions("anotherSession", 5)[1];
-    auto hash = subsessionMeta.getSessionKey({"anotherSession"});
+    EXPECT_EQ(subsessionMeta.getSessionKey({"anotherSession"}), session_key_t({0}));
+    auto hash = subsessionMeta.getSessionKeyString({"anotherSession"});
     ASSERT_THAT(hash, HasSubstr("request_0"));
     ASSERT_THAT(hash, Not(HasSubstr("anotherSession")));
 }
@@ -202,7 +223,8 @@ TEST_F(NodeSessionMetadataTest, GenerateCollapsedSeveralSubsessionsAtOnceKey) {
     auto subsessionMeta = meta.generateSubsessions("request", 2)[0]
                               .generateSubsessions("anotherSession", 5)[1]
                               .generateSubsessions("yetAnotherSession", 3)[2];
-    auto hash = subsessionMeta.getSessionKey({"anotherSession", "yetAnotherSession"});
+    EXPECT_EQ(subsessionMeta.getSessionKey({"anotherSession", "yetAnotherSession"}), session_key_t({0}));
+    auto hash = subsessionMeta.getSessionKeyString({"anotherSession", "yetAnotherSession"});
     ASSERT_THAT(hash, HasSubstr("request"));
     ASSERT_THAT(hash, Not(HasSubstr("anotherSession")));
     ASSERT_THAT(hash, Not(HasSubstr("yetAnotherSession")));
@@ -212,6 +234,7 @@ TEST_F(NodeSessionMetadataTest, GenerateCollapsedSubsessionKeyShouldThrowWhenNon
     NodeSessionMetadata meta{DEFAULT_TEST_CONTEXT};
     auto subsessionMeta = meta.generateSubsessions("request", 2)[1];
     EXPECT_THROW(subsessionMeta.getSessionKey({"NonExistingSubsession"}), std::logic_error);
+    EXPECT_THROW(subsessionMeta.getSessionKeyString({"NonExistingSubsession"}), std::logic_error);
 }
 
 TEST_F(NodeSessionMetadataTest, GenerateCollapsedSeveralSubsessionKeyShouldThrowWhenJustOneNonExisting) {
@@ -14,16 +14,21 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
 #include <chrono>
 #include <filesystem>
+#include <mutex>
+#include <optional>
 #include <random>
 #include <string>
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include "../ovinferrequestsqueue.hpp"
+#include "../queue.hpp"
 #include "../timer.hpp"
 
 #include <openvino/runtime/core.hpp>
@@ -132,3 +137,157 @@ TEST(OVInferRequestQueue, AsyncGetInferRequest) {
     const int secondStreamId = secondStreamRequest.get();
     EXPECT_EQ(firstStreamId, secondStreamId);
 }
+
+TEST(IdleStreamsQueue, StreamReadyCallbackCalledOnlyForWaitingCaller) {
+    ovms::Queue<int> queue(1);
+    int callbackCalls = 0;
+    auto first = queue.getIdleStream([&callbackCalls]() { callbackCalls++; });
+    ASSERT_EQ(std::future_status::ready, first.wait_for(std::chrono::microseconds(0)));
+    auto second = queue.getIdleStream([&callbackCalls]() { callbackCalls++; });
+    ASSERT_EQ(std::future_status::timeout, second.wait_for(std::chrono::microseconds(0)));
+    EXPECT_EQ(callbackCalls, 0);
+    queue.returnStream(first.get());
+    EXPECT_EQ(callbackCalls, 1);
+    EXPECT_EQ(second.get(), 0);
+}
+
+TEST(IdleStreamsQueue, AcquireReturnsStreamsInOrder) {
+    ovms::Queue<int> queue(3);
+    EXPECT_EQ(queue.acquireIdleStream(), 0);
+    EXPECT_EQ(queue.acquireIdleStream(), 1);
+    EXPECT_EQ(queue.acquireIdleStream(), 2);
+    EXPECT_EQ(queue.tryToGetIdleStream(), std::nullopt);
+    queue.returnStream(1);
+    EXPECT_EQ(queue.tryToGetIdleStream(), 1);
+}
+
+TEST(IdleStreamsQueue, AcquireWaitsForReturnedStream) {
+    ovms::Queue<int> queue(1);
+    const int streamId = queue.acquireIdleStream();
+    std::thread releaser([&queue, streamId]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        queue.returnStream(streamId);
+    });
+    ovms::Timer<TIMER_END> timer;
+    timer.start(QUEUE);
+    EXPECT_EQ(queue.acquireIdleStream(), streamId);
+    timer.stop(QUEUE);
+    EXPECT_GT(timer.elapsed<std::chrono::microseconds>(QUEUE), 90'000);
+    releaser.join();
+}
+
+TEST(IdleStreamsQueue, MixedWaitersShareStreamsExclusively) {
+    const int nireq = 3;
+    const int clients = 64;
+    const int iterations = 2000;
+    ovms::Queue<int> queue(nireq);
+    std::vector<std::atomic<int>> owners(nireq);
+    std::atomic<int> violations{0};
+    std::vector<std::thread> threads;
+    for (int client = 0; client < clients; ++client) {
+        threads.emplace_back([&, client]() {
+            for (int i = 0; i < iterations; ++i) {
+                // alternate between future based and blocking acquisition
+                int streamId = ((client + i) % 2) ? queue.getIdleStream().get() : queue.acquireIdleStream();
+                if (owners[streamId].fetch_add(1) != 0) {
+                    violations++;
+                }
+                owners[streamId].fetch_sub(1);
+                queue.returnStream(streamId);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(violations, 0);
+    int idleStreams = 0;
+    while (queue.tryToGetIdleStream().has_value()) {
+        ++idleStreams;
+    }
+    EXPECT_EQ(idleStreams, nireq);
+}
+
+TEST(IdleStreamsQueue, AcquireBeforeDeadlineTimesOut) {
+    ovms::Queue<int> queue(1);
+    const int streamId = queue.acquireIdleStream();
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(50);
+    EXPECT_EQ(queue.acquireIdleStreamBefore(deadline), std::nullopt);
+    EXPECT_GE(std::chrono::steady_clock::now(), deadline);
+    queue.returnStream(streamId);
+    EXPECT_EQ(queue.tryToGetIdleStream(), streamId);
+}
+
+TEST(IdleStreamsQueue, EarliestDeadlineIsServedFirst) {
+    ovms::Queue<int> queue(1);
+    const int streamId = queue.acquireIdleStream();
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<int> servedOrder;
+    std::mutex servedOrderMutex;
+    std::vector<std::thread> waiters;
+    // register waiters with latest deadline first
+    for (int i = 3; i > 0; --i) {
+        waiters.emplace_back([&, i]() {
+            auto acquired = queue.acquireIdleStreamBefore(now + std::chrono::seconds(10 * i));
+            ASSERT_TRUE(acquired.has_value());
+            {
+                std::unique_lock<std::mutex> lock(servedOrderMutex);
+                servedOrder.push_back(i);
+            }
+            queue.returnStream(acquired.value());
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    queue.returnStream(streamId);
+    for (auto& waiter : waiters) {
+        waiter.join();
+    }
+    EXPECT_THAT(servedOrder, ElementsAre(1, 2, 3));
+}
+
+TEST(IdleStreamsQueue, AcquireOrNotifyCallsBackWhenStreamIsReturned) {
+    ovms::Queue<int> queue(1);
+    std::vector<std::optional<int>> notified;
+    auto first = queue.acquireIdleStreamOrNotify(std::chrono::steady_clock::time_point::max(), [&notified](std::optional<int> streamId) { notified.push_back(streamId); });
+    ASSERT_EQ(first, 0);
+    auto second = queue.acquireIdleStreamOrNotify(std::chrono::steady_clock::time_point::max(), [&notified](std::optional<int> streamId) { notified.push_back(streamId); });
+    EXPECT_EQ(second, std::nullopt);
+    EXPECT_TRUE(notified.empty());
+    EXPECT_EQ(queue.getWaitersCount(), 1);
+    queue.returnStream(first.value());
+    EXPECT_THAT(notified, ElementsAre(std::optional<int>(0)));
+    EXPECT_EQ(queue.getWaitersCount(), 0);
+    EXPECT_EQ(queue.tryToGetIdleStream(), std::nullopt);
+}
+
+TEST(IdleStreamsQueue, AcquireOrNotifyServesEarliestDeadlineAndDropsPassedDeadline) {
+    ovms::Queue<int> queue(1);
+    const int streamId = queue.acquireIdleStream();
+    const auto now = std::chrono::steady_clock::now();
+    std::vector<std::pair<int, std::optional<int>>> notified;
+    auto waitFor = [&](int waiter, std::chrono::steady_clock::time_point deadline) {
+        return queue.acquireIdleStreamOrNotify(deadline, [&notified, waiter](std::optional<int> acquired) { notified.emplace_back(waiter, acquired); });
+    };
+    ASSERT_EQ(waitFor(1, std::chrono::steady_clock::time_point::max()), std::nullopt);
+    ASSERT_EQ(waitFor(2, now + std::chrono::seconds(20)), std::nullopt);
+    ASSERT_EQ(waitFor(3, now + std::chrono::seconds(10)), std::nullopt);
+    ASSERT_EQ(waitFor(4, now - std::chrono::seconds(1)), std::nullopt);
+    queue.returnStream(streamId);
+    EXPECT_THAT(notified, ElementsAre(std::make_pair(4, std::optional<int>()), std::make_pair(3, std::optional<int>(streamId))));
+    queue.returnStream(streamId);
+    queue.returnStream(streamId);
+    EXPECT_THAT(notified, ElementsAre(std::make_pair(4, std::optional<int>()), std::make_pair(3, std::optional<int>(streamId)),
+                              std::make_pair(2, std::optional<int>(streamId)), std::make_pair(1, std::optional<int>(streamId))));
+    EXPECT_EQ(queue.getWaitersCount(), 0);
+}
+
+TEST(IdleStreamsQueue, AcquireOrNotifyReturnsStreamWhenAllWaitersWithDeadlineAreDropped) {
+    ovms::Queue<int> queue(1);
+    const int streamId = queue.acquireIdleStream();
+    std::optional<int> dropped = streamId;
+    ASSERT_EQ(queue.acquireIdleStreamOrNotify(std::chrono::steady_clock::now() - std::chrono::seconds(1), [&dropped](std::optional<int> acquired) { dropped = acquired; }), std::nullopt);
+    queue.returnStream(streamId);
+    EXPECT_EQ(dropped, std::nullopt);
+    EXPECT_EQ(queue.getWaitersCount(), 0);
+    EXPECT_EQ(queue.tryToGetIdleStream(), streamId);
+}
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "../utils/parallel_for.hpp"
+
+using ovms::parallelFor;
+
+TEST(ParallelFor, SingleWorkerRunsInOrderInCallingThread) {
+    std::vector<size_t> order;
+    auto callingThread = std::this_thread::get_id();
+    parallelFor(5, 1, [&](size_t i) {
+        EXPECT_EQ(std::this_thread::get_id(), callingThread);
+        order.push_back(i);
+    });
+    EXPECT_EQ(order, std::vector<size_t>({0, 1, 2, 3, 4}));
+}
+
+TEST(ParallelFor, RunsEachTaskExactlyOnce) {
+    const size_t tasksCount = 100;
+    std::vector<std::atomic<int>> runs(tasksCount);
+    parallelFor(tasksCount, 8, [&](size_t i) { runs[i]++; });
+    for (size_t i = 0; i < tasksCount; ++i) {
+        EXPECT_EQ(runs[i].load(), 1) << "task: " << i;
+    }
+}
+
+TEST(ParallelFor, DoesNotExceedWorkersLimit) {
+    std::atomic<int> running{0};
+    std::atomic<int> maxRunning{0};
+    parallelFor(32, 3, [&](size_t) {
+        int current = ++running;
+        int previous = maxRunning.load();
+        while (current > previous && !maxRunning.compare_exchange_weak(previous, current)) {
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        --running;
+    });
+    EXPECT_LE(maxRunning.load(), 3);
+}
+
+TEST(ParallelFor, RethrowsTaskExceptionAfterAllTasksFinish) {
+    std::atomic<int> finished{0};
+    EXPECT_THROW(parallelFor(10, 4, [&](size_t i) {
+        if (i == 3) {
+            throw std::runtime_error("task failed");
+        }
+        finished++;
+    }),
+        std::runtime_error);
+    EXPECT_EQ(finished.load(), 9);
+}
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "../dags/node.hpp"
+#include "../dags/nodesession.hpp"
+#include "../dags/pipelineeventqueue.hpp"
+#include "../status.hpp"
+
+using namespace ovms;
+
+namespace {
+class NoopNode : public Node {
+public:
+    NoopNode() :
+        Node("noop") {}
+    Status execute(const session_key_t& sessionKey, PipelineEventQueue& notifyEndQueue) override {
+        notifyEndQueue.push({*this, sessionKey});
+        return StatusCode::OK;
+    }
+
+protected:
+    Status fetchResults(NodeSession& nodeSession, SessionResults& nodeSessionOutputs) override {
+        return StatusCode::OK;
+    }
+};
+}  // namespace
+
+TEST(PipelineEventQueue, FinishedNodeSessionsAreDeliveredBeforeStreamReady) {
+    auto queue = std::make_shared<PipelineEventQueue>();
+    queue->notifyStreamReady();
+    NoopNode node;
+    node.execute(session_key_t({1}), *queue);
+    node.execute(session_key_t({2}), *queue);
+    auto event = queue->pull();
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->second, session_key_t({1}));
+    event = queue->pull();
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->second, session_key_t({2}));
+    EXPECT_FALSE(queue->pull().has_value());
+    EXPECT_EQ(queue->size(), 0);
+}
+
+TEST(PipelineEventQueue, StreamReadyNotificationsAreCoalesced) {
+    auto queue = std::make_shared<PipelineEventQueue>();
+    auto callback = queue->createStreamReadyCallback();
+    callback();
+    callback();
+    EXPECT_FALSE(queue->pull().has_value());
+    NoopNode node;
+    node.execute(session_key_t({1}), *queue);
+    auto event = queue->pull();
+    ASSERT_TRUE(event.has_value());
+    EXPECT_EQ(event->second, session_key_t({1}));
+}
+
+TEST(PipelineEventQueue, PullIsWokenUpByStreamReadyCallback) {
+    auto queue = std::make_shared<PipelineEventQueue>();
+    auto callback = queue->createStreamReadyCallback();
+    std::thread notifier([&callback]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        callback();
+    });
+    EXPECT_FALSE(queue->pull().has_value());
+    notifier.join();
+}
+
+TEST(PipelineEventQueue, CallbackOutlivingQueueIsNoop) {
+    std::function<void()> callback;
+    {
+        auto queue = std::make_shared<PipelineEventQueue>();
+        callback = queue->createStreamReadyCallback();
+    }
+    callback();
+}
@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2026 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <stdexcept>
+
+#include <gtest/gtest.h>
+
+#include "../rest_router.hpp"
+
+using namespace ovms;
+
+class RestRouterTest : public ::testing::Test {
+protected:
+    RestRouter router = createRestApiRouter();
+    RestRouteMatch match;
+};
+
+TEST_F(RestRouterTest, ServerEndpoints) {
+    ASSERT_EQ(router.match("GET", "/v2", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, KFS_GetServerMetadata);
+    ASSERT_EQ(router.match("GET", "/v2/health/live", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, KFS_GetServerLive);
+    ASSERT_EQ(router.match("GET", "/v2/health/ready", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, KFS_GetServerReady);
+    ASSERT_EQ(router.match("GET", "/v1/config", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, ConfigStatus);
+    ASSERT_EQ(router.match("POST", "/v1/config/reload", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, ConfigReload);
+    EXPECT_EQ(router.match("GET", "/v2/", match), RestRouteLookup::NOT_FOUND);
+    EXPECT_EQ(router.match("GET", "/v2/health", match), RestRouteLookup::NOT_FOUND);
+}
+
+TEST_F(RestRouterTest, ModelEndpointsCaptureNameAndVersion) {
+    ASSERT_EQ(router.match("GET", "/v2/models/dummy/versions/12/ready", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, KFS_GetModelReady);
+    EXPECT_EQ(match.modelName, "dummy");
+    EXPECT_EQ(match.modelVersion, "12");
+    ASSERT_EQ(router.match("POST", "/v2/models/dummy/infer", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, KFS_Infer);
+    EXPECT_EQ(match.modelName, "dummy");
+    EXPECT_EQ(match.modelVersion, "");
+    ASSERT_EQ(router.match("GET", "/v2/models/ready", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, KFS_GetModelMetadata);
+    EXPECT_EQ(match.modelName, "ready");
+    ASSERT_EQ(router.match("GET", "/v2/models/dummy/versions/1/", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, KFS_GetModelMetadata);
+    EXPECT_EQ(match.modelVersion, "1");
+    EXPECT_EQ(router.match("GET", "/v2/models/dummy/versions/x", match), RestRouteLookup::NOT_FOUND);
+    EXPECT_EQ(router.match("GET", "/v2/models/dummy/ready/", match), RestRouteLookup::NOT_FOUND);
+    EXPECT_EQ(router.match("POST", "/v2/models//infer", match), RestRouteLookup::NOT_FOUND);
+}
+
+TEST_F(RestRouterTest, RetrieveModelCapturesRemainderOfPath) {
+    ASSERT_EQ(router.match("GET", "/v3/models/meta-llama/Llama-3.1-8B", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, V3_RetrieveModel);
+    EXPECT_EQ(match.modelName, "meta-llama/Llama-3.1-8B");
+    ASSERT_EQ(router.match("GET", "/v3/v1/models/my/graph", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.modelName, "my/graph");
+    ASSERT_EQ(router.match("GET", "/v1/models", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, V3_ListModels);
+    EXPECT_EQ(router.match("GET", "/v3/models/", match), RestRouteLookup::NOT_FOUND);
+}
+
+TEST_F(RestRouterTest, PrefixRoute) {
+    ASSERT_EQ(router.match("POST", "/v3/chat/completions", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, V3);
+    ASSERT_EQ(router.match("POST", "/v1/completions", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, V3);
+    ASSERT_EQ(router.match("POST", "/v3/", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(router.match("POST", "/v3", match), RestRouteLookup::NOT_FOUND);
+    EXPECT_EQ(router.match("GET", "/v3/chat/completions", match), RestRouteLookup::NOT_FOUND);
+    // specific route takes precedence over prefix route with matching method
+    EXPECT_EQ(router.match("POST", "/v1/pipelines/my_pipeline/profile", match), RestRouteLookup::METHOD_NOT_ALLOWED);
+    EXPECT_EQ(router.match("POST", "/v3/models", match), RestRouteLookup::METHOD_NOT_ALLOWED);
+}
+
+TEST_F(RestRouterTest, QueryIsAcceptedOnlyByMetrics) {
+    ASSERT_EQ(router.match("GET", "/metrics?name=ovms_requests_success", match), RestRouteLookup::FOUND);
+    EXPECT_EQ(match.type, Metrics);
+    EXPECT_EQ(match.query, "name=ovms_requests_success");
+    EXPECT_EQ(router.match("POST", "/metrics?name=value", match), RestRouteLookup::METHOD_NOT_ALLOWED);
+    EXPECT_EQ(router.match("GET", "/v2/health/live?verbose", match), RestRouteLookup::NOT_FOUND);
+}
+
+TEST_F(RestRouterTest, MethodNotAllowed) {
+    EXPECT_EQ(router.match("POST", "/v2/models/dummy/ready", match), RestRouteLookup::METHOD_NOT_ALLOWED);
+    EXPECT_EQ(router.match("GET", "/v2/models/dummy/versions/1/infer", match), RestRouteLookup::METHOD_NOT_ALLOWED);
+    EXPECT_EQ(router.match("GET", "/v1/config/reload", match), RestRouteLookup::METHOD_NOT_ALLOWED);
+    EXPECT_EQ(router.match("POST", "/v2", match), RestRouteLookup::METHOD_NOT_ALLOWED);
+}
+
+TEST_F(RestRouterTest, InvalidPaths) {
+    EXPECT_EQ(router.match("GET", "", match), RestRouteLookup::NOT_FOUND);
+    EXPECT_EQ(router.match("GET", "/", match), RestRouteLookup::NOT_FOUND);
+    EXPECT_EQ(router.match("GET", "v2", match), RestRouteLookup::NOT_FOUND);
+    EXPECT_EQ(router.match("GET", "/v4/models", match), RestRouteLookup::NOT_FOUND);
+}
+
+TEST(RestRouter, InvalidPattern) {
+    RestRouter router;
+    EXPECT_THROW(router.addRoute("GET", "v2", KFS_GetServerMetadata), std::invalid_argument);
+    EXPECT_THROW(router.addRoute("GET", "/v2//models", KFS_GetServerMetadata), std::invalid_argument);
+    EXPECT_THROW(router.addRoute("GET", "/v2/{unknown}", KFS_GetServerMetadata), std::invalid_argument);
+    EXPECT_THROW(router.addRoute("GET", "/v3/{*}/models", V3), std::invalid_argument);
+}
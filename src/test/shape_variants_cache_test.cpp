@@ -0,0 +1,190 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include <chrono>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <openvino/runtime/core.hpp>
+
+#include "../executingstreamidguard.hpp"
+#include "../metrics/metric_config.hpp"
+#include "../metrics/metric_registry.hpp"
+#include "../modelinstance.hpp"
+#include "../modelinstanceunloadguard.hpp"
+#include "../shape_variants_cache.hpp"
+#include "test_models_configs.hpp"
+
+using namespace ovms;
+using testing::HasSubstr;
+
+namespace {
+std::shared_ptr<ModelShapeVariant> createVariant(const std::string& inputName) {
+    auto variant = std::make_shared<ModelShapeVariant>();
+    variant->inputsInfo[inputName] = nullptr;
+    return variant;
+}
+}  // namespace
+
+TEST(ShapeVariantsCache, KeyDependsOnBatchAndShapes) {
+    EXPECT_EQ(ShapeVariantsCache::createKey(2, {}), ShapeVariantsCache::createKey(2, {}));
+    EXPECT_NE(ShapeVariantsCache::createKey(2, {}), ShapeVariantsCache::createKey(3, {}));
+    std::map<std::string, shape_t> first{{"a", {1, 10}}, {"b", {2, 10}}};
+    std::map<std::string, shape_t> second{{"a", {1, 10}}, {"b", {3, 10}}};
+    EXPECT_EQ(ShapeVariantsCache::createKey(std::nullopt, first), ShapeVariantsCache::createKey(std::nullopt, first));
+    EXPECT_NE(ShapeVariantsCache::createKey(std::nullopt, first), ShapeVariantsCache::createKey(std::nullopt, second));
+}
+
+TEST(ShapeVariantsCache, TakeRemovesVariant) {
+    ShapeVariantsCache cache(2);
+    cache.put("a", createVariant("a"));
+    ASSERT_TRUE(cache.contains("a"));
+    auto variant = cache.take("a");
+    ASSERT_NE(variant, nullptr);
+    EXPECT_EQ(variant->inputsInfo.count("a"), 1);
+    EXPECT_FALSE(cache.contains("a"));
+    EXPECT_EQ(cache.take("a"), nullptr);
+}
+
+TEST(ShapeVariantsCache, EvictsLeastRecentlyUsed) {
+    ShapeVariantsCache cache(2);
+    cache.put("a", createVariant("a"));
+    cache.put("b", createVariant("b"));
+    cache.put("a", cache.take("a"));
+    cache.put("c", createVariant("c"));
+    EXPECT_EQ(cache.size(), 2);
+    EXPECT_TRUE(cache.contains("a"));
+    EXPECT_FALSE(cache.contains("b"));
+    EXPECT_TRUE(cache.contains("c"));
+    cache.setCapacity(1);
+    EXPECT_EQ(cache.size(), 1);
+    EXPECT_TRUE(cache.contains("c"));
+}
+
+TEST(ShapeVariantsCache, DisabledWithZeroCapacity) {
+    ShapeVariantsCache cache;
+    cache.put("a", createVariant("a"));
+    EXPECT_EQ(cache.size(), 0);
+}
+
+class ShapeVariantsModelInstance : public ::testing::Test {
+protected:
+    std::unique_ptr<ov::Core> ieCore;
+    MetricRegistry registry;
+    MetricConfig metricConfig;
+    void SetUp() override {
+        ieCore = std::make_unique<ov::Core>();
+        ASSERT_EQ(metricConfig.loadFromCLIString(true, METRIC_NAME_SHAPE_VARIANT_HITS + "," + METRIC_NAME_SHAPE_VARIANT_MISSES + "," + METRIC_NAME_SHAPE_VARIANT_COMPILE_TIME), StatusCode::OK);
+    }
+    void reload(ModelInstance& instance, size_t batch) {
+        std::unique_ptr<ModelInstanceUnloadGuard> unloadGuard;
+        std::map<std::string, shape_t> requestShapes = {{DUMMY_MODEL_INPUT_NAME, {batch, DUMMY_MODEL_INPUT_SIZE}}};
+        ASSERT_EQ(instance.reloadModel(std::nullopt, requestShapes, unloadGuard), StatusCode::OK);
+        ASSERT_EQ(ModelVersionState::AVAILABLE, instance.getStatus().getState());
+        ASSERT_EQ(instance.getInputsInfo().at(DUMMY_MODEL_INPUT_NAME)->getShape(), Shape(shape_t{batch, DUMMY_MODEL_INPUT_SIZE}));
+    }
+};
+
+TEST_F(ShapeVariantsModelInstance, SwitchingBackToCompiledShapeUsesCachedVariant) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.parseShapeParameter("auto");
+    config.setShapeVariantsCacheSize(2);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+
+    reload(modelInstance, 2);
+    reload(modelInstance, 3);
+    reload(modelInstance, 2);
+    reload(modelInstance, 3);
+    auto metrics = registry.collect();
+    EXPECT_THAT(metrics, HasSubstr(METRIC_NAME_SHAPE_VARIANT_MISSES + "{name=\"UNUSED_NAME\",version=\"42\"} 2"));
+    EXPECT_THAT(metrics, HasSubstr(METRIC_NAME_SHAPE_VARIANT_HITS + "{name=\"UNUSED_NAME\",version=\"42\"} 2"));
+    EXPECT_THAT(metrics, HasSubstr(METRIC_NAME_SHAPE_VARIANT_COMPILE_TIME + "_count{name=\"UNUSED_NAME\",version=\"42\"} 2"));
+}
+
+TEST_F(ShapeVariantsModelInstance, SwitchingBackToInitiallyLoadedShapeUsesCachedVariant) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.parseShapeParameter("auto");
+    config.setShapeVariantsCacheSize(2);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+
+    reload(modelInstance, 2);
+    reload(modelInstance, 1);
+    auto metrics = registry.collect();
+    EXPECT_THAT(metrics, HasSubstr(METRIC_NAME_SHAPE_VARIANT_MISSES + "{name=\"UNUSED_NAME\",version=\"42\"} 1"));
+    EXPECT_THAT(metrics, HasSubstr(METRIC_NAME_SHAPE_VARIANT_HITS + "{name=\"UNUSED_NAME\",version=\"42\"} 1"));
+}
+
+TEST_F(ShapeVariantsModelInstance, CachedVariantIsLoadedWithoutWaitingForInFlightRequests) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.parseShapeParameter("auto");
+    config.setShapeVariantsCacheSize(2);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+    reload(modelInstance, 2);
+    reload(modelInstance, 3);
+
+    auto inFlightRequest = std::make_unique<ModelInstanceUnloadGuard>(modelInstance);
+    auto inFlightStream = std::make_unique<StreamIdGuard>(modelInstance.getInferRequestsQueue());
+    auto swapped = std::async(std::launch::async, [this, &modelInstance]() { reload(modelInstance, 2); });
+    EXPECT_EQ(swapped.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    // in-flight request finishes on previously loaded variant
+    EXPECT_EQ(inFlightRequest->getShapeVariant().inputsInfo.at(DUMMY_MODEL_INPUT_NAME)->getShape(), Shape(shape_t{3, DUMMY_MODEL_INPUT_SIZE}));
+    EXPECT_EQ(inFlightStream->getInferRequest().get_input_tensor().get_shape(), ov::Shape({3, DUMMY_MODEL_INPUT_SIZE}));
+    EXPECT_NE(inFlightRequest->getShapeVariant().inferRequestsQueue.get(), &modelInstance.getInferRequestsQueue());
+    inFlightStream.reset();
+    inFlightRequest.reset();
+    swapped.get();
+    EXPECT_THAT(registry.collect(), HasSubstr(METRIC_NAME_SHAPE_VARIANT_HITS + "{name=\"UNUSED_NAME\",version=\"42\"} 1"));
+}
+
+TEST_F(ShapeVariantsModelInstance, LeastRecentlyUsedVariantIsRecompiled) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.parseShapeParameter("auto");
+    config.setShapeVariantsCacheSize(1);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+
+    reload(modelInstance, 2);
+    reload(modelInstance, 3);
+    reload(modelInstance, 4);
+    reload(modelInstance, 2);
+    reload(modelInstance, 4);
+    auto metrics = registry.collect();
+    EXPECT_THAT(metrics, HasSubstr(METRIC_NAME_SHAPE_VARIANT_MISSES + "{name=\"UNUSED_NAME\",version=\"42\"} 4"));
+    EXPECT_THAT(metrics, HasSubstr(METRIC_NAME_SHAPE_VARIANT_HITS + "{name=\"UNUSED_NAME\",version=\"42\"} 1"));
+}
+
+TEST_F(ShapeVariantsModelInstance, ConfigReloadDropsCachedVariants) {
+    ModelConfig config = DUMMY_MODEL_CONFIG;
+    config.parseShapeParameter("auto");
+    config.setShapeVariantsCacheSize(2);
+    ModelInstance modelInstance("UNUSED_NAME", UNUSED_MODEL_VERSION, *ieCore, &registry, &metricConfig);
+    ASSERT_EQ(modelInstance.loadModel(config), StatusCode::OK);
+
+    reload(modelInstance, 2);
+    reload(modelInstance, 3);
+    ASSERT_EQ(modelInstance.reloadModel(config), StatusCode::OK);
+    reload(modelInstance, 2);
+    auto metrics = registry.collect();
+    EXPECT_THAT(metrics, HasSubstr(METRIC_NAME_SHAPE_VARIANT_MISSES + "{name=\"UNUSED_NAME\",version=\"42\"} 3"));
+    EXPECT_THAT(metrics, HasSubstr(METRIC_NAME_SHAPE_VARIANT_HITS + "{name=\"UNUSED_NAME\",version=\"42\"} 0"));
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <thread>
+#include <vector>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
@@ -34,3 +35,27 @@ TEST(SystemInfo, getCoreCount) {
     EXPECT_GE(cpuCount, 1);
     EXPECT_LE(cpuCount, std::thread::hardware_concurrency());
 }
+
+#ifdef __linux__
+TEST(SystemInfo, parseCpuList) {
+    std::vector<uint16_t> cpus;
+    ASSERT_TRUE(ovms::parseCpuList("0-3,8,10-11\n", cpus));
+    EXPECT_THAT(cpus, ElementsAre(0, 1, 2, 3, 8, 10, 11));
+    ASSERT_TRUE(ovms::parseCpuList("", cpus));
+    EXPECT_TRUE(cpus.empty());
+    EXPECT_FALSE(ovms::parseCpuList("3-1", cpus));
+    EXPECT_FALSE(ovms::parseCpuList("0-a", cpus));
+    EXPECT_FALSE(ovms::parseCpuList("-1", cpus));
+    EXPECT_FALSE(ovms::parseCpuList("1x", cpus));
+}
+
+TEST(SystemInfo, getNumaNodesCpus) {
+    auto nodesCpus = ovms::getNumaNodesCpus();
+    size_t cpusCount = 0;
+    for (const auto& cpus : nodesCpus) {
+        EXPECT_FALSE(cpus.empty());
+        cpusCount += cpus.size();
+    }
+    EXPECT_LE(cpusCount, ovms::getCpuAffinityCount());
+}
+#endif
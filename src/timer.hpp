@@ -42,6 +42,11 @@ public:
         stopTimestamps[i] = std::chrono::high_resolution_clock::now();
     }
 
+    // false when measurement was not started or not stopped after last start
+    bool isMeasured(SIZE_TYPE i) const {
+        return startTimestamps[i] != std::chrono::high_resolution_clock::time_point() && stopTimestamps[i] >= startTimestamps[i];
+    }
+
     template <typename T>
     double elapsed(SIZE_TYPE i) {
         static_assert(is_chrono_duration_type<T>::value, "Non supported type.");
@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#include "parallel_for.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ovms {
+void parallelFor(size_t tasksCount, uint32_t maxWorkers, const std::function<void(size_t)>& task) {
+    const size_t workersCount = std::min<size_t>(maxWorkers, tasksCount);
+    if (workersCount < 2) {
+        for (size_t i = 0; i < tasksCount; ++i) {
+            task(i);
+        }
+        return;
+    }
+    std::atomic<size_t> nextTask{0};
+    std::exception_ptr firstException;
+    std::mutex exceptionMutex;
+    auto worker = [&]() {
+        for (size_t i = nextTask.fetch_add(1); i < tasksCount; i = nextTask.fetch_add(1)) {
+            try {
+                task(i);
+            } catch (...) {
+                std::unique_lock<std::mutex> lock(exceptionMutex);
+                if (!firstException) {
+                    firstException = std::current_exception();
+                }
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    workers.reserve(workersCount - 1);
+    for (size_t i = 1; i < workersCount; ++i) {
+        workers.emplace_back(worker);
+    }
+    // calling thread is one of the workers
+    worker();
+    for (auto& thread : workers) {
+        thread.join();
+    }
+    if (firstException) {
+        std::rethrow_exception(firstException);
+    }
+}
+}  // namespace ovms
@@ -0,0 +1,30 @@
+//*****************************************************************************
+// Copyright 2025 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+namespace ovms {
+/**
+ * @brief Runs task for each index in [0, tasksCount) using at most maxWorkers threads and waits for all of them.
+ *
+ * With maxWorkers lower than 2 tasks are run sequentially in the calling thread, in index order.
+ * First exception thrown by any task is rethrown after all workers finish.
+ */
+void parallelFor(size_t tasksCount, uint32_t maxWorkers, const std::function<void(size_t)>& task);
+}  // namespace ovms